@@ -0,0 +1,59 @@
+#include "my_algorithm.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <cstdlib>
+#include <algorithm>
+
+struct Record {
+    std::uint64_t key;
+    std::uint64_t payload;
+};
+
+template <typename F>
+double timeMs(F fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+template <typename T, typename Gen, typename KeyOf = MyIdentityKey>
+void run(const char* name, std::size_t n, unsigned threads, Gen gen, KeyOf key = {}) {
+    std::mt19937_64 rng(1);
+    MyVector<T> base(n);
+    for (T& x : base) {
+        x = gen(rng);
+    }
+    MyRadixSorter sorter(threads);
+    MyVector<T> a = base;
+    double stdMs = timeMs([&] {
+        std::sort(a.begin(), a.end(), [&](const T& x, const T& y) { return key(x) < key(y); });
+    });
+    MyVector<T> b = base;
+    sorter.sort(b, key);
+    // 第二次排序复用辅助缓冲区
+    b = base;
+    double lsdMs = timeMs([&] { sorter.sort(b, key); });
+    MyVector<T> c = base;
+    double msdMs = timeMs([&] { sorter.sort_msd(c, key); });
+    std::cout << std::left << std::setw(10) << name << std::right << std::fixed << std::setprecision(1)
+              << " std::sort " << std::setw(8) << stdMs << " ms   LSD " << std::setw(7) << lsdMs << " ms ("
+              << std::setprecision(2) << stdMs / lsdMs << "x)   MSD " << std::setprecision(1) << std::setw(7) << msdMs
+              << " ms (" << std::setprecision(2) << stdMs / msdMs << "x)" << std::endl;
+}
+
+// 对 n 个随机键排序，比较 std::sort 与 MyRadixSorter 的 LSD / MSD，参数为元素个数与线程数
+int main(int argc, char** argv) {
+    std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 20000000;
+    unsigned threads = argc > 2 ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10)) : 1;
+    std::cout << "elements: " << n << ", threads: " << threads << std::endl;
+    run<std::uint32_t>("uint32", n, threads, [](std::mt19937_64& r) { return static_cast<std::uint32_t>(r()); });
+    run<std::uint64_t>("uint64", n, threads, [](std::mt19937_64& r) { return r(); });
+    run<std::int64_t>("int64", n, threads, [](std::mt19937_64& r) { return static_cast<std::int64_t>(r()); });
+    run<float>("float", n, threads, [](std::mt19937_64& r) { return static_cast<float>(static_cast<std::int32_t>(r())) * 1e-3f; });
+    run<Record>("key+value", n, threads, [](std::mt19937_64& r) { return Record{r(), r()}; },
+                [](const Record& x) { return x.key; });
+    return 0;
+}
@@ -0,0 +1,451 @@
+#ifndef MY_ALGORITHM_H
+#define MY_ALGORITHM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <atomic>
+#include <thread>
+#include <exception>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#include "../MyVector/my_vector.hpp"
+#include "../MyAllocator/my_allocator.hpp"
+
+// 默认的键提取器：元素本身就是键
+struct MyIdentityKey {
+    template <typename T>
+    constexpr const T& operator()(const T& x) const noexcept { return x; }
+};
+
+// 把整数或浮点数映射为按无符号比较时顺序不变的整数
+// 有符号整数翻转符号位；浮点数为负时按位取反，否则只翻转符号位（-0.0 排在 +0.0 之前，NaN 按位模式排在两端）
+template <typename K>
+constexpr auto my_radix_key(K k) noexcept {
+    static_assert(std::is_arithmetic_v<K> && !std::is_same_v<K, bool>, "my_radix_key: key must be an integer or floating-point type");
+    if constexpr(std::is_floating_point_v<K>) {
+        static_assert(sizeof(K) == 4 || sizeof(K) == 8, "my_radix_key: unsupported floating-point type");
+        using U = std::conditional_t<sizeof(K) == 4, std::uint32_t, std::uint64_t>;
+        U bits = 0;
+        std::memcpy(&bits, &k, sizeof(K));
+        constexpr U sign = U(1) << (sizeof(U) * 8 - 1);
+        return (bits & sign) ? U(~bits) : U(bits | sign);
+    } else {
+        using U = std::make_unsigned_t<K>;
+        if constexpr(std::is_signed_v<K>) {
+            return U(U(k) ^ (U(1) << (sizeof(U) * 8 - 1)));
+        } else {
+            return U(k);
+        }
+    }
+}
+
+namespace my_algorithm_detail {
+
+template <typename T, typename KeyOf>
+using radix_key_t = decltype(my_radix_key(std::declval<KeyOf&>()(std::declval<const T&>())));
+
+// 元素在缓冲区之间逐个复制构造；要求平凡可复制构造且平凡析构，覆盖旧对象时不必先析构
+template <typename T>
+constexpr bool relocatable = std::is_trivially_copy_constructible_v<T> && std::is_trivially_destructible_v<T>;
+
+// 无分支的比较交换：b 的键小于 a 时交换
+// 整数的 min / max 与 my_radix_key 的顺序一致；浮点数的 ±0.0 与 NaN 不一致，走键比较
+template <typename T, typename KeyOf>
+inline void compare_exchange(T& a, T& b, KeyOf& key) {
+    if constexpr(std::is_integral_v<T> && std::is_same_v<KeyOf, MyIdentityKey>) {
+        T lo = std::min(a, b);
+        T hi = std::max(a, b);
+        a = lo;
+        b = hi;
+    } else {
+        bool swap = my_radix_key(key(b)) < my_radix_key(key(a));
+        T lo = swap ? b : a;
+        T hi = swap ? a : b;
+        ::new(static_cast<void*>(&a)) T(lo);
+        ::new(static_cast<void*>(&b)) T(hi);
+    }
+}
+
+// 插入排序，稳定，用于 LSD 排序的小数组
+template <typename T, typename KeyOf>
+void insertion_sort(T* first, T* last, KeyOf& key) {
+    if(first == last) {
+        return;
+    }
+    for(T* i = first + 1; i != last; ++i) {
+        T v = *i;
+        auto k = my_radix_key(key(v));
+        T* j = i;
+        for(; j != first && k < my_radix_key(key(j[-1])); --j) {
+            ::new(static_cast<void*>(j)) T(j[-1]);
+        }
+        ::new(static_cast<void*>(j)) T(v);
+    }
+}
+
+// 在 threads 个线程上运行 fn(t)，t = 0 在当前线程；任一线程抛出时等待全部结束后重新抛出
+template <typename F>
+void run_parallel(unsigned threads, F fn) {
+    if(threads <= 1) {
+        fn(0u);
+        return;
+    }
+    MyVector<std::exception_ptr> errors(threads);
+    MyVector<std::thread> workers;
+    workers.reserve(threads - 1);
+    auto guarded = [&](unsigned t) {
+        try {
+            fn(t);
+        } catch(...) {
+            errors[t] = std::current_exception();
+        }
+    };
+    unsigned started = 1;
+    try {
+        for(; started < threads; ++started) {
+            workers.push_back(std::thread(guarded, started));
+        }
+    } catch(...) {
+        // 线程创建失败时剩余的份额在当前线程完成
+    }
+    guarded(0);
+    for(unsigned t = started; t < threads; ++t) {
+        guarded(t);
+    }
+    for(std::thread& w : workers) {
+        w.join();
+    }
+    for(std::exception_ptr& e : errors) {
+        if(e) {
+            std::rethrow_exception(e);
+        }
+    }
+}
+
+} // namespace my_algorithm_detail
+
+// 排序网络：Batcher 奇偶归并网络，适用于任意长度，所有比较交换都没有分支，
+// 同一层中下标连续的比较交换彼此独立，编译器可以对算术类型向量化
+// 比较次数为 O(n log² n)，不稳定，用于 MSD 排序中不超过 my_small_sort_limit 个元素的小分区；
+// LSD 排序的小数组改用稳定的插入排序
+constexpr std::size_t my_small_sort_limit = 32;
+
+template <typename T, typename KeyOf = MyIdentityKey>
+void my_sort_small(T* first, T* last, KeyOf key = {}) {
+    static_assert(my_algorithm_detail::relocatable<T>, "my_sort_small: element must be trivially copyable and destructible");
+    std::size_t n = static_cast<std::size_t>(last - first);
+    for(std::size_t p = 1; p < n; p *= 2) {
+        for(std::size_t k = p; k >= 1; k /= 2) {
+            for(std::size_t j = k % p; j + k < n; j += 2 * k) {
+                std::size_t m = std::min(k, n - j - k);
+                for(std::size_t i = 0; i < m; ++i) {
+                    if((i + j) / (2 * p) == (i + j + k) / (2 * p)) {
+                        my_algorithm_detail::compare_exchange(first[i + j], first[i + j + k], key);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// 基数排序器，按 8 位一个数字排序，键由 KeyOf 从元素中取出，经 my_radix_key 变换为无符号整数
+// - sort：LSD，稳定，需要与数据等大的辅助缓冲区；辅助缓冲区保存在排序器中，多次调用之间复用
+// - sort_msd：MSD（American flag sort），原地、不稳定，不需要辅助缓冲区
+// threads 大于 1 时大数组按线程切块并行统计与分发（LSD），或在首个数字分桶后并行排序各桶（MSD）
+// 元素要求平凡可复制构造且平凡析构，如整数、浮点数与由它们组成的键值结构体
+class MyRadixSorter {
+public:
+    using size_type = std::size_t;
+
+    static constexpr size_type radix_bits = 8;
+    static constexpr size_type buckets = size_type(1) << radix_bits;
+    static constexpr size_type min_elements_per_thread = size_type(1) << 16;
+
+    // threads 为 0 时使用 std::thread::hardware_concurrency()
+    explicit MyRadixSorter(unsigned threads = 1) : m_threads(threads) {}
+    MyRadixSorter(const MyRadixSorter&) = delete;
+    MyRadixSorter& operator=(const MyRadixSorter&) = delete;
+    ~MyRadixSorter() { release(); }
+
+    unsigned threads() const noexcept { return m_threads; }
+    void set_threads(unsigned threads) noexcept { m_threads = threads; }
+    size_type scratch_bytes() const noexcept { return m_scratch_bytes; }
+    void release() noexcept {
+        if(m_scratch) {
+            MyAlignedAllocator<unsigned char>().deallocate(m_scratch, m_scratch_bytes);
+            m_scratch = nullptr;
+            m_scratch_bytes = 0;
+        }
+    }
+
+    template <typename T, typename KeyOf = MyIdentityKey>
+    void sort(T* first, T* last, KeyOf key = {}) {
+        static_assert(my_algorithm_detail::relocatable<T>, "MyRadixSorter: element must be trivially copyable and destructible");
+        size_type n = static_cast<size_type>(last - first);
+        if(n <= my_small_sort_limit) {
+            my_algorithm_detail::insertion_sort(first, last, key);
+            return;
+        }
+        T* tmp = static_cast<T*>(scratch(n * sizeof(T)));
+        unsigned t = thread_count(n);
+        if(t > 1) {
+            lsd_parallel(first, tmp, n, key, t);
+        } else {
+            lsd(first, tmp, n, key);
+        }
+    }
+    template <typename T, typename Allocator, typename KeyOf = MyIdentityKey>
+    void sort(MyVector<T, Allocator>& vec, KeyOf key = {}) {
+        sort(vec.data(), vec.data() + vec.size(), key);
+    }
+
+    template <typename T, typename KeyOf = MyIdentityKey>
+    void sort_msd(T* first, T* last, KeyOf key = {}) {
+        static_assert(my_algorithm_detail::relocatable<T>, "MyRadixSorter: element must be trivially copyable and destructible");
+        using U = my_algorithm_detail::radix_key_t<T, KeyOf>;
+        size_type n = static_cast<size_type>(last - first);
+        unsigned t = thread_count(n);
+        if(t <= 1 || n <= my_small_sort_limit) {
+            msd(first, n, sizeof(U) - 1, key);
+            return;
+        }
+        // 先按最高位分桶，再由各线程从共享计数器领取桶继续排序
+        size_type bounds[buckets + 1];
+        int digit = partition(first, n, sizeof(U) - 1, key, bounds);
+        if(digit < 0) {
+            return;
+        }
+        std::atomic<size_type> next{0};
+        my_algorithm_detail::run_parallel(t, [&](unsigned) {
+            for(size_type b = next++; b < buckets; b = next++) {
+                if(digit > 0) {
+                    msd(first + bounds[b], bounds[b + 1] - bounds[b], static_cast<size_type>(digit - 1), key);
+                }
+            }
+        });
+    }
+    template <typename T, typename Allocator, typename KeyOf = MyIdentityKey>
+    void sort_msd(MyVector<T, Allocator>& vec, KeyOf key = {}) {
+        sort_msd(vec.data(), vec.data() + vec.size(), key);
+    }
+
+private:
+    unsigned m_threads;
+    unsigned char* m_scratch = nullptr;
+    size_type m_scratch_bytes = 0;
+
+    void* scratch(size_type bytes) {
+        if(bytes > m_scratch_bytes) {
+            release();
+            m_scratch = MyAlignedAllocator<unsigned char>().allocate(bytes);
+            m_scratch_bytes = bytes;
+        }
+        return m_scratch;
+    }
+
+    unsigned thread_count(size_type n) const {
+        unsigned t = m_threads ? m_threads : std::max(1u, std::thread::hardware_concurrency());
+        return static_cast<unsigned>(std::max<size_type>(1, std::min<size_type>(t, n / min_elements_per_thread)));
+    }
+
+    template <typename T, typename KeyOf>
+    static size_type digit_of(const T& x, KeyOf& key, size_type d) {
+        return static_cast<size_type>((my_radix_key(key(x)) >> (d * radix_bits)) & (buckets - 1));
+    }
+
+    // 把 src[first, last) 按第 d 个数字分发到 dst，next[b] 为第 b 个桶下一个写入位置
+    // 软件写合并：每个桶先在一条缓存行大小的缓冲区中攒满，再整行写出，减轻 256 路分散写入对缓存与 TLB 的压力
+    template <typename T, typename KeyOf>
+    static void scatter(const T* src, size_type first, size_type last, T* dst, size_type* next, KeyOf& key, size_type d) {
+        constexpr size_type per_line = 64 / sizeof(T);
+        if constexpr(per_line < 4) {
+            for(size_type i = first; i < last; ++i) {
+                ::new(static_cast<void*>(dst + next[digit_of(src[i], key, d)]++)) T(src[i]);
+            }
+        } else {
+            struct alignas(64) Line {
+                unsigned char bytes[64];
+            };
+            Line lines[buckets];
+            unsigned char fill[buckets] = {};
+            for(size_type i = first; i < last; ++i) {
+                size_type b = digit_of(src[i], key, d);
+                ::new(static_cast<void*>(lines[b].bytes + fill[b] * sizeof(T))) T(src[i]);
+                if(++fill[b] == per_line) {
+                    const T* line = std::launder(reinterpret_cast<const T*>(lines[b].bytes));
+                    for(size_type k = 0; k < per_line; ++k) {
+                        ::new(static_cast<void*>(dst + next[b] + k)) T(line[k]);
+                    }
+                    next[b] += per_line;
+                    fill[b] = 0;
+                }
+            }
+            for(size_type b = 0; b < buckets; ++b) {
+                const T* line = std::launder(reinterpret_cast<const T*>(lines[b].bytes));
+                for(size_type k = 0; k < fill[b]; ++k) {
+                    ::new(static_cast<void*>(dst + next[b] + k)) T(line[k]);
+                }
+                next[b] += fill[b];
+            }
+        }
+    }
+
+    // 一趟统计所有数字的直方图，跳过所有元素该位相同的趟，在 src 与 tmp 之间来回分发
+    template <typename T, typename KeyOf>
+    static void lsd(T* data, T* tmp, size_type n, KeyOf& key) {
+        using U = my_algorithm_detail::radix_key_t<T, KeyOf>;
+        constexpr size_type digits = sizeof(U);
+        size_type count[digits][buckets] = {};
+        for(size_type i = 0; i < n; ++i) {
+            U k = my_radix_key(key(data[i]));
+            for(size_type d = 0; d < digits; ++d) {
+                ++count[d][(k >> (d * radix_bits)) & (buckets - 1)];
+            }
+        }
+        T* src = data;
+        T* dst = tmp;
+        for(size_type d = 0; d < digits; ++d) {
+            size_type* c = count[d];
+            if(c[digit_of(src[0], key, d)] == n) {
+                continue;
+            }
+            size_type sum = 0;
+            for(size_type b = 0; b < buckets; ++b) {
+                size_type cnt = c[b];
+                c[b] = sum;
+                sum += cnt;
+            }
+            scatter(src, 0, n, dst, c, key, d);
+            std::swap(src, dst);
+        }
+        if(src != data) {
+            for(size_type i = 0; i < n; ++i) {
+                ::new(static_cast<void*>(data + i)) T(src[i]);
+            }
+        }
+    }
+
+    // 每趟分两步：各线程统计自己那块的直方图；按（数字，线程）顺序求前缀和后各线程分发自己那块，结果仍然稳定
+    template <typename T, typename KeyOf>
+    static void lsd_parallel(T* data, T* tmp, size_type n, KeyOf& key, unsigned t) {
+        using U = my_algorithm_detail::radix_key_t<T, KeyOf>;
+        constexpr size_type digits = sizeof(U);
+        MyVector<size_type> count(size_type(t) * buckets);
+        T* src = data;
+        T* dst = tmp;
+        auto chunk = [n, t](unsigned i) { return n / t * i + std::min<size_type>(n % t, i); };
+        for(size_type d = 0; d < digits; ++d) {
+            my_algorithm_detail::run_parallel(t, [&](unsigned w) {
+                size_type* c = count.data() + size_type(w) * buckets;
+                std::fill(c, c + buckets, size_type(0));
+                for(size_type i = chunk(w), e = chunk(w + 1); i < e; ++i) {
+                    ++c[digit_of(src[i], key, d)];
+                }
+            });
+            size_type sum = 0;
+            bool trivial = false;
+            for(size_type b = 0; b < buckets; ++b) {
+                size_type total = 0;
+                for(unsigned w = 0; w < t; ++w) {
+                    size_type cnt = count[size_type(w) * buckets + b];
+                    count[size_type(w) * buckets + b] = sum + total;
+                    total += cnt;
+                }
+                trivial |= total == n;
+                sum += total;
+            }
+            if(trivial) {
+                continue;
+            }
+            my_algorithm_detail::run_parallel(t, [&](unsigned w) {
+                size_type* c = count.data() + size_type(w) * buckets;
+                scatter(src, chunk(w), chunk(w + 1), dst, c, key, d);
+            });
+            std::swap(src, dst);
+        }
+        if(src != data) {
+            my_algorithm_detail::run_parallel(t, [&](unsigned w) {
+                for(size_type i = chunk(w), e = chunk(w + 1); i < e; ++i) {
+                    ::new(static_cast<void*>(data + i)) T(src[i]);
+                }
+            });
+        }
+    }
+
+    // 按第 d 个数字原地分桶，bounds[b] 为第 b 个桶的起点；从第 d 位起所有元素都相同的位跳过，
+    // 返回实际分桶所用的数字，全部键相同时返回 -1
+    template <typename T, typename KeyOf>
+    static int partition(T* a, size_type n, size_type d, KeyOf& key, size_type* bounds) {
+        size_type count[buckets];
+        for(;;) {
+            std::fill(count, count + buckets, size_type(0));
+            for(size_type i = 0; i < n; ++i) {
+                ++count[digit_of(a[i], key, d)];
+            }
+            if(count[digit_of(a[0], key, d)] != n) {
+                break;
+            }
+            if(d == 0) {
+                return -1;
+            }
+            --d;
+        }
+        size_type next[buckets];
+        size_type sum = 0;
+        for(size_type b = 0; b < buckets; ++b) {
+            bounds[b] = next[b] = sum;
+            sum += count[b];
+        }
+        bounds[buckets] = n;
+        // 依次把每个桶中不属于它的元素沿置换环送回各自的桶
+        for(size_type b = 0; b < buckets; ++b) {
+            while(next[b] < bounds[b + 1]) {
+                T v = a[next[b]];
+                size_type vd = digit_of(v, key, d);
+                while(vd != b) {
+                    T u = a[next[vd]];
+                    ::new(static_cast<void*>(a + next[vd]++)) T(v);
+                    v = u;
+                    vd = digit_of(v, key, d);
+                }
+                ::new(static_cast<void*>(a + next[b]++)) T(v);
+            }
+        }
+        return static_cast<int>(d);
+    }
+
+    template <typename T, typename KeyOf>
+    static void msd(T* a, size_type n, size_type d, KeyOf& key) {
+        if(n <= my_small_sort_limit) {
+            my_sort_small(a, a + n, key);
+            return;
+        }
+        size_type bounds[buckets + 1];
+        int digit = partition(a, n, d, key, bounds);
+        if(digit <= 0) {
+            return;
+        }
+        for(size_type b = 0; b < buckets; ++b) {
+            if(bounds[b + 1] - bounds[b] > 1) {
+                msd(a + bounds[b], bounds[b + 1] - bounds[b], static_cast<size_type>(digit - 1), key);
+            }
+        }
+    }
+};
+
+// 使用临时排序器的便捷接口
+template <typename T, typename Allocator, typename KeyOf = MyIdentityKey>
+void my_radix_sort(MyVector<T, Allocator>& vec, KeyOf key = {}) {
+    MyRadixSorter().sort(vec, key);
+}
+
+template <typename T, typename Allocator, typename KeyOf = MyIdentityKey>
+void my_radix_sort_msd(MyVector<T, Allocator>& vec, KeyOf key = {}) {
+    MyRadixSorter().sort_msd(vec, key);
+}
+
+#endif // MY_ALGORITHM_H
@@ -0,0 +1,199 @@
+#include "my_algorithm.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <utility>
+
+// 键值对：按 key 排序，value 记录原始位置，用于检查稳定性
+struct Record {
+    std::uint64_t key;
+    std::uint32_t value;
+};
+
+template <typename T>
+bool sameAsStd(const MyVector<T>& vec, std::vector<T> ref) {
+    std::sort(ref.begin(), ref.end());
+    if (vec.size() != ref.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < ref.size(); ++i) {
+        // 浮点数 -0.0 与 +0.0 相等，NaN 单独比较位模式
+        if (!(vec[i] == ref[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+MyVector<T> toMy(const std::vector<T>& ref) {
+    MyVector<T> vec;
+    vec.reserve(ref.size());
+    for (const T& x : ref) {
+        vec.push_back(x);
+    }
+    return vec;
+}
+
+template <typename T, typename Gen>
+void checkType(std::mt19937_64& rng, Gen gen) {
+    for (std::size_t n : {0u, 1u, 2u, 31u, 32u, 33u, 100u, 1000u, 65536u, 300000u}) {
+        std::vector<T> ref(n);
+        for (T& x : ref) {
+            x = gen(rng);
+        }
+        MyRadixSorter lsd, par(4);
+        MyVector<T> a = toMy(ref), b = toMy(ref), c = toMy(ref), d = toMy(ref);
+        lsd.sort(a);
+        par.sort(b);
+        lsd.sort_msd(c);
+        par.sort_msd(d);
+        assert(sameAsStd(a, ref) && sameAsStd(b, ref) && sameAsStd(c, ref) && sameAsStd(d, ref));
+    }
+}
+
+int main() {
+    std::mt19937_64 rng(46);
+
+    std::cout << "===== 1) 键变换保持顺序 =====" << std::endl;
+    {
+        assert(my_radix_key(std::int32_t(-1)) < my_radix_key(std::int32_t(0)));
+        assert(my_radix_key(std::numeric_limits<std::int64_t>::min()) == 0);
+        assert(my_radix_key(-2.5f) < my_radix_key(-1.0f) && my_radix_key(-1.0f) < my_radix_key(0.0f));
+        assert(my_radix_key(0.0) < my_radix_key(1e-300) && my_radix_key(1e300) < my_radix_key(std::numeric_limits<double>::infinity()));
+        assert(my_radix_key(-std::numeric_limits<double>::infinity()) < my_radix_key(-1e300));
+        assert(my_radix_key(std::uint16_t(7)) == 7);
+    }
+
+    std::cout << "===== 2) 排序网络 =====" << std::endl;
+    {
+        for (std::size_t n = 0; n <= 40; ++n) {
+            for (int round = 0; round < 50; ++round) {
+                std::vector<int> ref(n);
+                for (int& x : ref) {
+                    x = static_cast<int>(rng() % 20) - 10;
+                }
+                MyVector<int> vec = toMy(ref);
+                my_sort_small(vec.data(), vec.data() + vec.size());
+                assert(sameAsStd(vec, ref));
+            }
+        }
+        MyVector<Record> recs;
+        for (std::uint32_t i = 0; i < 25; ++i) {
+            recs.push_back({rng() % 10, i});
+        }
+        my_sort_small(recs.data(), recs.data() + recs.size(), [](const Record& r) { return r.key; });
+        for (std::size_t i = 1; i < recs.size(); ++i) {
+            assert(recs[i - 1].key <= recs[i].key);
+        }
+    }
+
+    std::cout << "===== 3) 各种键类型对比 std::sort =====" << std::endl;
+    {
+        checkType<std::uint32_t>(rng, [](std::mt19937_64& r) { return static_cast<std::uint32_t>(r()); });
+        checkType<std::uint64_t>(rng, [](std::mt19937_64& r) { return r() >> (r() % 64); });
+        checkType<std::int32_t>(rng, [](std::mt19937_64& r) { return static_cast<std::int32_t>(r()); });
+        checkType<std::int64_t>(rng, [](std::mt19937_64& r) { return static_cast<std::int64_t>(r() % 2001) - 1000; });
+        checkType<std::uint8_t>(rng, [](std::mt19937_64& r) { return static_cast<std::uint8_t>(r()); });
+        checkType<float>(rng, [](std::mt19937_64& r) { return static_cast<float>(static_cast<std::int64_t>(r() % 200001) - 100000) * 0.37f; });
+        checkType<double>(rng, [](std::mt19937_64& r) {
+            double x = std::ldexp(static_cast<double>(r() % 1000000), static_cast<int>(r() % 200) - 100);
+            return r() % 2 ? -x : x;
+        });
+    }
+
+    std::cout << "===== 4) 浮点数 ±0.0 与 NaN 的顺序与数组长度无关 =====" << std::endl;
+    {
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        for (std::size_t n : {8u, 32u, 33u, 200u}) {
+            std::vector<double> ref;
+            for (std::size_t i = 0; i < n; ++i) {
+                double specials[] = {0.0, -0.0, nan, -nan, 1.5, -1.5};
+                ref.push_back(specials[rng() % 6]);
+            }
+            MyRadixSorter sorter;
+            MyVector<double> a = toMy(ref), b = toMy(ref), c = toMy(ref);
+            sorter.sort(a);
+            sorter.sort_msd(b);
+            my_sort_small(c.data(), c.data() + c.size());
+            for (std::size_t i = 1; i < n; ++i) {
+                assert(my_radix_key(a[i - 1]) <= my_radix_key(a[i]));
+                assert(my_radix_key(b[i - 1]) <= my_radix_key(b[i]));
+                assert(my_radix_key(c[i - 1]) <= my_radix_key(c[i]));
+            }
+        }
+    }
+
+    std::cout << "===== 5) 键值对与稳定性 =====" << std::endl;
+    {
+        for (unsigned threads : {1u, 3u}) {
+            MyVector<Record> recs;
+            for (std::uint32_t i = 0; i < 400000; ++i) {
+                recs.push_back({(rng() % 5000) << 20, i});
+            }
+            MyRadixSorter sorter(threads);
+            sorter.sort(recs, [](const Record& r) { return r.key; });
+            for (std::size_t i = 1; i < recs.size(); ++i) {
+                assert(recs[i - 1].key < recs[i].key || (recs[i - 1].key == recs[i].key && recs[i - 1].value < recs[i].value));
+            }
+            sorter.sort_msd(recs, [](const Record& r) { return ~r.key; });
+            for (std::size_t i = 1; i < recs.size(); ++i) {
+                assert(recs[i - 1].key >= recs[i].key);
+            }
+        }
+        // 不超过 my_small_sort_limit 的小数组同样稳定
+        for (std::size_t n = 2; n <= my_small_sort_limit; ++n) {
+            for (int round = 0; round < 20; ++round) {
+                MyVector<Record> small;
+                for (std::uint32_t i = 0; i < n; ++i) {
+                    small.push_back({rng() % 3, i});
+                }
+                MyRadixSorter().sort(small, [](const Record& r) { return r.key; });
+                for (std::size_t i = 1; i < small.size(); ++i) {
+                    assert(small[i - 1].key < small[i].key || (small[i - 1].key == small[i].key && small[i - 1].value < small[i].value));
+                }
+            }
+        }
+        MyVector<std::pair<std::int32_t, std::uint32_t>> pairs;
+        for (std::uint32_t i = 0; i < 1000; ++i) {
+            pairs.push_back({static_cast<std::int32_t>(rng() % 21) - 10, i});
+        }
+        my_radix_sort(pairs, [](const std::pair<std::int32_t, std::uint32_t>& p) { return p.first; });
+        for (std::size_t i = 1; i < pairs.size(); ++i) {
+            assert(pairs[i - 1].first < pairs[i].first || (pairs[i - 1].first == pairs[i].first && pairs[i - 1].second < pairs[i].second));
+        }
+    }
+
+    std::cout << "===== 6) 辅助缓冲区复用 =====" << std::endl;
+    {
+        MyRadixSorter sorter;
+        assert(sorter.scratch_bytes() == 0);
+        MyVector<std::uint32_t> big(100000);
+        for (auto& x : big) {
+            x = static_cast<std::uint32_t>(rng());
+        }
+        sorter.sort(big);
+        std::size_t bytes = sorter.scratch_bytes();
+        assert(bytes == 100000 * sizeof(std::uint32_t));
+        MyVector<std::uint64_t> small(1000, 3);
+        sorter.sort(small);
+        assert(sorter.scratch_bytes() == bytes);
+        // 原地的 MSD 不使用辅助缓冲区
+        MyRadixSorter inplace;
+        inplace.sort_msd(big);
+        assert(inplace.scratch_bytes() == 0 && std::is_sorted(big.begin(), big.end()));
+        sorter.release();
+        assert(sorter.scratch_bytes() == 0);
+        MyVector<std::uint64_t> same(5000, 42);
+        my_radix_sort_msd(same);
+        assert(same[0] == 42 && same[4999] == 42);
+    }
+
+    std::cout << "All MyAlgorithm tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,46 @@
+#include "my_allocator.hpp"
+#include "../MyVector/my_vector.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+
+std::uint64_t g_sink = 0;
+
+// 在 n 个元素上做 lookups 次依赖链式的随机读取，每次访问的位置由上一次读到的值决定
+template <typename Vector>
+double randomWalkNs(std::size_t n, std::size_t lookups) {
+    Vector v(n);
+    std::uint64_t x = 88172645463325252ull;
+    for (std::size_t i = 0; i < n; ++i) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        v[i] = x;
+    }
+    auto start = std::chrono::steady_clock::now();
+    std::uint64_t pos = 0;
+    for (std::size_t i = 0; i < lookups; ++i) {
+        pos = (v[pos % n] + i) % n;
+    }
+    auto stop = std::chrono::steady_clock::now();
+    g_sink += pos;
+    return std::chrono::duration<double, std::nano>(stop - start).count() / lookups;
+}
+
+int main(int argc, char** argv) {
+    std::size_t mb = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1024;
+    std::size_t n = mb * (1 << 20) / sizeof(std::uint64_t);
+    std::size_t lookups = 1 << 24;
+
+    double base = randomWalkNs<MyVector<std::uint64_t>>(n, lookups);
+    double huge = randomWalkNs<MyVector<std::uint64_t, MyHugePageAllocator<std::uint64_t>>>(n, lookups);
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "buffer: " << mb << " MB, dependent random reads" << std::endl;
+    std::cout << "std::allocator:      " << base << " ns/read" << std::endl;
+    std::cout << "MyHugePageAllocator: " << huge << " ns/read" << std::endl;
+    std::cout << "speedup:             " << std::setprecision(2) << base / huge << "x" << std::endl;
+    return g_sink == 1 ? 1 : 0;
+}
@@ -0,0 +1,360 @@
+#ifndef MY_ALLOCATOR_H
+#define MY_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <limits>
+#include <algorithm>
+#include <thread>
+#include <string>
+#include <fstream>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+// 按 Align 字节对齐的分配器，Align 不小于 alignof(T) 且为 2 的幂
+// 例如 MyVector<float, MyAlignedAllocator<float, 64>> 的 data() 总是 64 字节对齐，可以直接用于对齐的 AVX-512 加载
+template <typename T, std::size_t Align = 64>
+class MyAlignedAllocator {
+    static_assert((Align & (Align - 1)) == 0, "MyAlignedAllocator: alignment must be a power of two");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    static constexpr std::size_t alignment = std::max(Align, alignof(T));
+
+    template <typename U>
+    struct rebind {
+        using other = MyAlignedAllocator<U, Align>;
+    };
+
+    MyAlignedAllocator() noexcept = default;
+    template <typename U>
+    MyAlignedAllocator(const MyAlignedAllocator<U, Align>&) noexcept {}
+
+    T* allocate(size_type n) {
+        if(n > std::numeric_limits<size_type>::max() / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignment)));
+    }
+    void deallocate(T* p, size_type) noexcept {
+        ::operator delete(p, std::align_val_t(alignment));
+    }
+};
+
+template <typename T, typename U, std::size_t Align>
+bool operator==(const MyAlignedAllocator<T, Align>&, const MyAlignedAllocator<U, Align>&) noexcept {
+    return true;
+}
+
+template <typename T, typename U, std::size_t Align>
+bool operator!=(const MyAlignedAllocator<T, Align>&, const MyAlignedAllocator<U, Align>&) noexcept {
+    return false;
+}
+
+// 大块内存使用 2 MB 大页的分配器：不小于 Threshold 字节的请求直接向内核映射 2 MB 对齐的匿名内存，
+// 优先使用预留的 hugetlb 大页（MAP_HUGETLB），失败时退回普通映射并以 madvise(MADV_HUGEPAGE) 请求透明大页；
+// 较小的请求与非 Linux 平台按 Align 字节对齐从堆上分配
+// 大页把随机访问大数组时的 TLB 覆盖范围扩大 512 倍
+template <typename T, std::size_t Align = 64, std::size_t Threshold = (std::size_t(1) << 21)>
+class MyHugePageAllocator {
+    static_assert((Align & (Align - 1)) == 0, "MyHugePageAllocator: alignment must be a power of two");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    static constexpr std::size_t alignment = std::max(Align, alignof(T));
+    static constexpr std::size_t huge_page_size = std::size_t(1) << 21;
+    static constexpr std::size_t threshold = Threshold;
+
+    template <typename U>
+    struct rebind {
+        using other = MyHugePageAllocator<U, Align, Threshold>;
+    };
+
+    MyHugePageAllocator() noexcept = default;
+    template <typename U>
+    MyHugePageAllocator(const MyHugePageAllocator<U, Align, Threshold>&) noexcept {}
+
+    T* allocate(size_type n) {
+        if(n > (std::numeric_limits<size_type>::max() - huge_page_size) / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        size_type bytes = n * sizeof(T);
+#if defined(__linux__)
+        if(bytes >= Threshold) {
+            return static_cast<T*>(map_huge(round_up(bytes)));
+        }
+#endif
+        return static_cast<T*>(::operator new(bytes, std::align_val_t(alignment)));
+    }
+    // n 必须与 allocate 时相同，据此判断内存来自映射还是堆
+    void deallocate(T* p, size_type n) noexcept {
+#if defined(__linux__)
+        size_type bytes = n * sizeof(T);
+        if(bytes >= Threshold) {
+            ::munmap(p, round_up(bytes));
+            return;
+        }
+#endif
+        ::operator delete(p, std::align_val_t(alignment));
+    }
+
+    // 是否会为 n 个元素使用大页映射
+    static constexpr bool uses_huge_pages(size_type n) noexcept {
+#if defined(__linux__)
+        return n * sizeof(T) >= Threshold;
+#else
+        (void)n;
+        return false;
+#endif
+    }
+
+private:
+    static constexpr size_type round_up(size_type bytes) noexcept {
+        return (bytes + huge_page_size - 1) & ~(huge_page_size - 1);
+    }
+
+#if defined(__linux__)
+    static void* map_huge(size_type bytes) {
+#if defined(MAP_HUGETLB)
+        void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if(p != MAP_FAILED) {
+            return p;
+        }
+#endif
+        // 多映射一个大页再裁掉首尾，使起始地址按 2 MB 对齐，透明大页才能覆盖整个缓冲区
+        size_type mapped = bytes + huge_page_size;
+        void* raw = ::mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if(raw == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(raw);
+        std::uintptr_t aligned = (begin + huge_page_size - 1) & ~std::uintptr_t(huge_page_size - 1);
+        if(aligned > begin) {
+            ::munmap(raw, aligned - begin);
+        }
+        std::uintptr_t end = begin + mapped;
+        if(end > aligned + bytes) {
+            ::munmap(reinterpret_cast<void*>(aligned + bytes), end - (aligned + bytes));
+        }
+#if defined(MADV_HUGEPAGE)
+        ::madvise(reinterpret_cast<void*>(aligned), bytes, MADV_HUGEPAGE);
+#endif
+        return reinterpret_cast<void*>(aligned);
+    }
+#endif
+};
+
+template <typename T, typename U, std::size_t Align, std::size_t Threshold>
+bool operator==(const MyHugePageAllocator<T, Align, Threshold>&, const MyHugePageAllocator<U, Align, Threshold>&) noexcept {
+    return true;
+}
+
+template <typename T, typename U, std::size_t Align, std::size_t Threshold>
+bool operator!=(const MyHugePageAllocator<T, Align, Threshold>&, const MyHugePageAllocator<U, Align, Threshold>&) noexcept {
+    return false;
+}
+
+// NUMA 放置策略
+enum class MyNumaPolicy {
+    local,      // 每个线程绑定到一个节点并首次写入自己负责的一段，页面落在该线程所在节点
+    interleave, // 页面按页轮流分布在所有在线节点上
+    bind        // 页面全部放在指定节点上
+};
+
+// 并行构造选项，用于 MyVector 的并行构造与 resize
+struct MyParallelOptions {
+    unsigned threads = 0;                                   // 线程数，0 表示 std::thread::hardware_concurrency()
+    MyNumaPolicy policy = MyNumaPolicy::local;
+    int node = 0;                                           // policy 为 bind 时的目标节点
+    std::size_t min_bytes_per_thread = std::size_t(1) << 22; // 每个线程至少负责的字节数，小数组不值得开线程
+};
+
+namespace my_numa_detail {
+
+// 解析 "0-3,8,10-11" 形式的列表
+inline void parse_list(const std::string& text, int* out, std::size_t max, std::size_t& count) {
+    count = 0;
+    std::size_t i = 0;
+    while(i < text.size()) {
+        if(text[i] < '0' || text[i] > '9') {
+            ++i;
+            continue;
+        }
+        int lo = 0;
+        for(; i < text.size() && text[i] >= '0' && text[i] <= '9'; ++i) {
+            lo = lo * 10 + (text[i] - '0');
+        }
+        int hi = lo;
+        if(i < text.size() && text[i] == '-') {
+            hi = 0;
+            for(++i; i < text.size() && text[i] >= '0' && text[i] <= '9'; ++i) {
+                hi = hi * 10 + (text[i] - '0');
+            }
+        }
+        for(int v = lo; v <= hi && count < max; ++v) {
+            out[count++] = v;
+        }
+    }
+}
+
+inline std::string read_line(const std::string& path) {
+    std::ifstream in(path);
+    std::string line;
+    std::getline(in, line);
+    return line;
+}
+
+constexpr int mpol_preferred = 1;
+constexpr int mpol_bind = 2;
+constexpr int mpol_interleave = 3;
+constexpr unsigned mpol_mf_move = 1u << 1;
+constexpr std::size_t max_nodes = 1024;
+constexpr std::size_t max_cpus = 4096;
+
+#if defined(__linux__) && defined(SYS_mbind)
+// 把 [p, p + bytes) 内完整的页设为 mode 策略，flags 含 mpol_mf_move 时同时迁移已有的页
+inline bool mbind_range(void* p, std::size_t bytes, int mode, const unsigned long* mask, unsigned flags) {
+    std::uintptr_t page = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+    std::uintptr_t begin = (reinterpret_cast<std::uintptr_t>(p) + page - 1) & ~(page - 1);
+    std::uintptr_t end = (reinterpret_cast<std::uintptr_t>(p) + bytes) & ~(page - 1);
+    if(end <= begin) {
+        return true;
+    }
+    return ::syscall(SYS_mbind, begin, end - begin, mode, mask, mask ? max_nodes + 1 : 0, flags) == 0;
+}
+#endif
+
+} // namespace my_numa_detail
+
+// 在线 NUMA 节点数（最大节点编号 + 1），无法获取时为 1
+inline int my_numa_node_count() {
+#if defined(__linux__)
+    static const int count = [] {
+        int nodes[my_numa_detail::max_nodes];
+        std::size_t n = 0;
+        my_numa_detail::parse_list(my_numa_detail::read_line("/sys/devices/system/node/online"), nodes, my_numa_detail::max_nodes, n);
+        return n == 0 ? 1 : nodes[n - 1] + 1;
+    }();
+    return count;
+#else
+    return 1;
+#endif
+}
+
+// 调用线程当前所在的节点
+inline int my_numa_current_node() {
+#if defined(__linux__) && defined(SYS_getcpu)
+    unsigned cpu = 0, node = 0;
+    if(::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+        return static_cast<int>(node);
+    }
+#endif
+    return 0;
+}
+
+// 把调用线程绑定到 node 的 CPU 上，失败时返回 false 且不改变亲和性
+inline bool my_numa_run_on_node(int node) {
+#if defined(__linux__)
+    int cpus[my_numa_detail::max_cpus];
+    std::size_t n = 0;
+    my_numa_detail::parse_list(my_numa_detail::read_line("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"), cpus, my_numa_detail::max_cpus, n);
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    std::size_t added = 0;
+    for(std::size_t i = 0; i < n; ++i) {
+        if(cpus[i] < CPU_SETSIZE) {
+            CPU_SET(cpus[i], &set);
+            ++added;
+        }
+    }
+    return added > 0 && ::sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    (void)node;
+    return false;
+#endif
+}
+
+// 设置 [p, p + bytes) 的放置策略并迁移已驻留的页；local 迁移到调用线程所在节点
+// 只作用于完整的页，内核不支持或没有权限时返回 false
+inline bool my_numa_set_placement(void* p, std::size_t bytes, MyNumaPolicy policy, int node = 0) {
+#if defined(__linux__) && defined(SYS_mbind)
+    unsigned long mask[my_numa_detail::max_nodes / (8 * sizeof(unsigned long))] = {};
+    int mode = my_numa_detail::mpol_bind;
+    if(policy == MyNumaPolicy::interleave) {
+        mode = my_numa_detail::mpol_interleave;
+        for(int i = 0; i < my_numa_node_count(); ++i) {
+            mask[i / (8 * sizeof(unsigned long))] |= 1ul << (i % (8 * sizeof(unsigned long)));
+        }
+    } else {
+        if(policy == MyNumaPolicy::local) {
+            // preferred 只是倾向，之后在别处触发的缺页仍可落在其他节点
+            mode = my_numa_detail::mpol_preferred;
+            node = my_numa_current_node();
+        }
+        if(node < 0 || static_cast<std::size_t>(node) >= my_numa_detail::max_nodes) {
+            return false;
+        }
+        mask[node / (8 * sizeof(unsigned long))] |= 1ul << (node % (8 * sizeof(unsigned long)));
+    }
+    return my_numa_detail::mbind_range(p, bytes, mode, mask, my_numa_detail::mpol_mf_move);
+#else
+    (void)p, (void)bytes, (void)policy, (void)node;
+    return false;
+#endif
+}
+
+// 统计 [p, p + bytes) 中已驻留的页在各节点上的数量，写入 pages_per_node[0, my_numa_node_count())
+// 返回驻留页总数，尚未访问过的页不计入；无法查询时返回 0
+inline std::size_t my_numa_placement(const void* p, std::size_t bytes, std::size_t* pages_per_node) {
+    int nodes = my_numa_node_count();
+    std::fill(pages_per_node, pages_per_node + nodes, std::size_t(0));
+    std::size_t resident = 0;
+#if defined(__linux__) && defined(SYS_move_pages)
+    std::uintptr_t page = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+    std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(p) & ~(page - 1);
+    std::uintptr_t end = reinterpret_cast<std::uintptr_t>(p) + bytes;
+    constexpr std::size_t batch = 1024;
+    void* pages[batch];
+    int status[batch];
+    while(addr < end) {
+        std::size_t n = 0;
+        for(; n < batch && addr < end; ++n, addr += page) {
+            pages[n] = reinterpret_cast<void*>(addr);
+        }
+        // nodes 为空时 move_pages 只查询每页所在的节点，未驻留的页状态为负的错误码
+        if(::syscall(SYS_move_pages, 0, n, pages, nullptr, status, 0) != 0) {
+            return 0;
+        }
+        for(std::size_t i = 0; i < n; ++i) {
+            if(status[i] >= 0 && status[i] < nodes) {
+                ++pages_per_node[status[i]];
+                ++resident;
+            }
+        }
+    }
+#else
+    (void)p, (void)bytes;
+#endif
+    return resident;
+}
+
+// 按选项为 bytes 字节的构造任务确定线程数
+inline unsigned my_parallel_threads(const MyParallelOptions& opt, std::size_t bytes) {
+    unsigned threads = opt.threads ? opt.threads : std::max(1u, std::thread::hardware_concurrency());
+    std::size_t by_size = bytes / std::max<std::size_t>(opt.min_bytes_per_thread, 1);
+    return static_cast<unsigned>(std::max<std::size_t>(1, std::min<std::size_t>(threads, by_size)));
+}
+
+#endif // MY_ALLOCATOR_H
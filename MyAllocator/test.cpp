@@ -0,0 +1,140 @@
+#include "my_allocator.hpp"
+#include "../MyVector/my_vector.hpp"
+#include <iostream>
+#include <fstream>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+template <typename T>
+bool alignedTo(const T* p, std::size_t align) {
+    return reinterpret_cast<std::uintptr_t>(p) % align == 0;
+}
+
+// 读取 /proc/self/smaps_rollup 中的透明大页用量（KB），不可用时返回 -1
+long anonHugePagesKb() {
+    std::ifstream in("/proc/self/smaps_rollup");
+    std::string key;
+    long value;
+    std::string unit;
+    while (in >> key) {
+        if (key == "AnonHugePages:") {
+            in >> value >> unit;
+            return value;
+        }
+        in.ignore(1 << 16, '\n');
+    }
+    return -1;
+}
+
+int main() {
+    std::cout << "===== 1) MyAlignedAllocator 直接分配 =====" << std::endl;
+    {
+        MyAlignedAllocator<char, 64> a64;
+        MyAlignedAllocator<double, 4096> a4k;
+        for (std::size_t n : {1u, 3u, 64u, 1000u, 100000u}) {
+            char* p = a64.allocate(n);
+            double* q = a4k.allocate(n);
+            assert(alignedTo(p, 64) && alignedTo(q, 4096));
+            p[n - 1] = 'x';
+            q[n - 1] = 1.0;
+            a64.deallocate(p, n);
+            a4k.deallocate(q, n);
+        }
+        using Rebound = std::allocator_traits<MyAlignedAllocator<char, 128>>::rebind_alloc<long>;
+        static_assert(std::is_same_v<Rebound, MyAlignedAllocator<long, 128>>);
+        assert(MyAlignedAllocator<int>() == MyAlignedAllocator<long>());
+    }
+
+    std::cout << "===== 2) 对齐存储的 MyVector =====" << std::endl;
+    {
+        MyVector<float, MyAlignedAllocator<float, 64>> v;
+        for (int i = 0; i < 10000; ++i) {
+            v.push_back(static_cast<float>(i));
+            assert(alignedTo(v.data(), 64));
+        }
+        v.insert(v.begin() + 3, 100, -1.0f);
+        v.shrink_to_fit();
+        assert(alignedTo(v.data(), 64) && v.size() == 10100 && v[3] == -1.0f && v[103] == 3.0f);
+
+        MyVector<std::string, MyAlignedAllocator<std::string, 256>> s = {"a", "b", "c"};
+        auto t = s;
+        t.push_back(std::string(100, 'z'));
+        assert(alignedTo(t.data(), 256) && t.size() == 4 && t[0] == "a");
+        auto u = std::move(t);
+        assert(u.size() == 4 && u.back().size() == 100);
+    }
+
+    std::cout << "===== 3) MyHugePageAllocator =====" << std::endl;
+    {
+        using Alloc = MyHugePageAllocator<std::uint64_t>;
+        static_assert(!Alloc::uses_huge_pages(1000));
+        MyVector<std::uint64_t, Alloc> v;
+        v.push_back(1);
+        assert(alignedTo(v.data(), 64));
+        // 容量达到 2 MB 后改用 2 MB 对齐的映射
+        for (std::uint64_t i = 1; i < (1u << 22); ++i) {
+            v.push_back(i * i);
+            if (Alloc::uses_huge_pages(v.capacity())) {
+                assert(alignedTo(v.data(), Alloc::huge_page_size));
+            }
+        }
+        std::uint64_t sum = 0;
+        for (std::uint64_t x : v) {
+            sum += x;
+        }
+        assert(v.size() == (1u << 22) && v[3] == 9 && sum != 0);
+        long huge = anonHugePagesKb();
+        std::cout << "capacity " << v.capacity() * sizeof(std::uint64_t) / (1 << 20) << " MB, AnonHugePages "
+                  << huge << " kB" << std::endl;
+        // 缩小到阈值以下又回到堆上
+        v.resize(100);
+        v.shrink_to_fit();
+        assert(!Alloc::uses_huge_pages(v.capacity()) && v[99] == 99 * 99);
+
+        MyHugePageAllocator<char, 64, 4096> small;
+        char* p = small.allocate(5000);
+        assert(alignedTo(p, MyHugePageAllocator<char>::huge_page_size));
+        p[4999] = 1;
+        small.deallocate(p, 5000);
+    }
+
+    std::cout << "===== 4) NUMA 放置 =====" << std::endl;
+    {
+        int nodes = my_numa_node_count();
+        int here = my_numa_current_node();
+        assert(nodes >= 1 && here >= 0 && here < nodes);
+        assert(my_parallel_threads(MyParallelOptions{4, MyNumaPolicy::local, 0, 1}, 100) == 4);
+        assert(my_parallel_threads(MyParallelOptions{4, MyNumaPolicy::local, 0, 64}, 100) == 1);
+        assert(my_parallel_threads(MyParallelOptions{4, MyNumaPolicy::local, 0, 64}, 10) == 1);
+
+        std::size_t bytes = std::size_t(16) << 20;
+        MyHugePageAllocator<char> alloc;
+        char* p = alloc.allocate(bytes);
+        MyVector<std::size_t> pages(static_cast<std::size_t>(nodes));
+        // 尚未写入的页不驻留，不计入统计
+        assert(my_numa_placement(p, bytes, pages.data()) == 0);
+        bool interleaved = my_numa_set_placement(p, bytes, MyNumaPolicy::interleave);
+        for (std::size_t i = 0; i < bytes; i += 4096) {
+            p[i] = 1;
+        }
+        std::size_t resident = my_numa_placement(p, bytes, pages.data());
+        std::size_t total = 0;
+        for (std::size_t c : pages) {
+            total += c;
+        }
+        assert(total == resident && resident <= bytes / 4096);
+        bool moved = my_numa_set_placement(p, bytes, MyNumaPolicy::bind, here);
+        std::cout << nodes << " node(s), interleave " << (interleaved ? "ok" : "unsupported") << ", bind "
+                  << (moved ? "ok" : "unsupported") << ", resident pages " << resident << std::endl;
+        if (moved && resident > 0) {
+            assert(my_numa_placement(p, bytes, pages.data()) == pages[here]);
+        }
+        alloc.deallocate(p, bytes);
+    }
+
+    std::cout << "All MyAllocator tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,52 @@
+#include "my_bit_vector.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <cstdlib>
+
+std::size_t g_sink = 0;
+
+template <typename F>
+double timeMs(F fn, int rounds) {
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        fn();
+    }
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count() / rounds;
+}
+
+// 求两个位图交集的置位数：逐字节的 MyVector<bool> 与按字的 MyBitVector
+int main(int argc, char** argv) {
+    std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : (std::size_t(1) << 27);
+    int rounds = 10;
+    std::mt19937_64 rng(1);
+    MyVector<bool> ba(n), bb(n);
+    MyBitVector wa(n), wb(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        std::uint64_t r = rng();
+        ba[i] = wa[i] = (r & 3) == 0;
+        bb[i] = wb[i] = (r & 12) != 0;
+    }
+
+    double byteMs = timeMs([&] {
+        std::size_t cnt = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            ba[i] = ba[i] & bb[i];
+            cnt += ba[i];
+        }
+        g_sink += cnt;
+    }, rounds);
+    double wordMs = timeMs([&] {
+        wa &= wb;
+        g_sink += wa.count();
+    }, rounds);
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "flags: " << n << ", a &= b; count(a)" << std::endl;
+    std::cout << "MyVector<bool>: " << byteMs << " ms/round, " << n / (1 << 20) << " MiB per bitmap" << std::endl;
+    std::cout << "MyBitVector:    " << wordMs << " ms/round, " << n / 8 / (1 << 20) << " MiB per bitmap" << std::endl;
+    std::cout << "speedup:        " << byteMs / wordMs << "x" << std::endl;
+    return g_sink == 1 ? 1 : 0;
+}
@@ -0,0 +1,384 @@
+#ifndef MY_BIT_VECTOR_H
+#define MY_BIT_VECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "../MyVector/my_vector.hpp"
+
+// 位压缩的布尔数组：每个元素占 1 位，按 64 位字存放在 MyVector 中
+// 批量操作（区间置位、计数、查找、位运算）均按字进行，编译时启用 AVX2 则每次处理 256 位
+class MyBitVector {
+public:
+    // 类型别名
+    using value_type = bool;
+    using size_type = std::size_t;
+    using word_type = std::uint64_t;
+    using const_reference = bool;
+
+    static constexpr size_type word_bits = 64;
+    static constexpr size_type npos = static_cast<size_type>(-1);
+
+    // 单个位的代理引用
+    class reference {
+    public:
+        operator bool() const noexcept { return (*m_word & m_mask) != 0; }
+        reference& operator=(bool val) noexcept {
+            if(val) {
+                *m_word |= m_mask;
+            } else {
+                *m_word &= ~m_mask;
+            }
+            return *this;
+        }
+        reference& operator=(const reference& o) noexcept { return *this = static_cast<bool>(o); }
+        bool operator~() const noexcept { return !static_cast<bool>(*this); }
+        void flip() noexcept { *m_word ^= m_mask; }
+
+    private:
+        friend class MyBitVector;
+        reference(word_type* word, word_type mask) noexcept : m_word(word), m_mask(mask) {}
+
+        word_type* m_word;
+        word_type m_mask;
+    };
+
+    // 构造函数
+    MyBitVector() = default;
+    explicit MyBitVector(size_type cnt, bool value = false) : m_words(words_for(cnt), value ? ~word_type(0) : 0), m_size(cnt) {
+        clear_tail();
+    }
+    MyBitVector(std::initializer_list<bool> list) {
+        reserve(list.size());
+        for(bool b : list) {
+            push_back(b);
+        }
+    }
+
+    // 容量
+    size_type size() const noexcept { return m_size; }
+    size_type capacity() const noexcept { return m_words.capacity() * word_bits; }
+    bool empty() const noexcept { return m_size == 0; }
+    void reserve(size_type n) { m_words.reserve(words_for(n)); }
+    void shrink_to_fit() { m_words.shrink_to_fit(); }
+
+    // 元素访问
+    reference operator[](size_type pos) noexcept { return reference(&m_words[pos / word_bits], bit(pos)); }
+    const_reference operator[](size_type pos) const noexcept { return (m_words[pos / word_bits] & bit(pos)) != 0; }
+    bool test(size_type pos) const {
+        check_pos(pos, "MyBitVector::test");
+        return (*this)[pos];
+    }
+    reference at(size_type pos) {
+        check_pos(pos, "MyBitVector::at");
+        return (*this)[pos];
+    }
+    const_reference at(size_type pos) const {
+        check_pos(pos, "MyBitVector::at");
+        return (*this)[pos];
+    }
+    // 底层字数组，末尾字中超出 size() 的位恒为 0
+    const word_type* data() const noexcept { return m_words.data(); }
+    size_type word_count() const noexcept { return m_words.size(); }
+
+    // 修改器
+    void push_back(bool val) {
+        if(m_size % word_bits == 0) {
+            m_words.push_back(0);
+        }
+        if(val) {
+            m_words[m_size / word_bits] |= bit(m_size);
+        }
+        ++m_size;
+    }
+    void pop_back() {
+        if(m_size > 0) {
+            --m_size;
+            m_words[m_size / word_bits] &= ~bit(m_size);
+            if(m_size % word_bits == 0) {
+                m_words.pop_back();
+            }
+        }
+    }
+    void resize(size_type n, bool val = false) {
+        size_type old = m_size;
+        m_words.resize(words_for(n), 0);
+        m_size = n;
+        if(n > old && val) {
+            set_range(old, n);
+        } else {
+            clear_tail();
+        }
+    }
+    void clear() noexcept {
+        m_words.clear();
+        m_size = 0;
+    }
+
+    // 单个位操作
+    MyBitVector& set(size_type pos, bool val = true) {
+        check_pos(pos, "MyBitVector::set");
+        (*this)[pos] = val;
+        return *this;
+    }
+    MyBitVector& reset(size_type pos) { return set(pos, false); }
+    MyBitVector& flip(size_type pos) {
+        check_pos(pos, "MyBitVector::flip");
+        m_words[pos / word_bits] ^= bit(pos);
+        return *this;
+    }
+
+    // 区间 [first, last) 操作，首尾两个字使用掩码，中间整字写入
+    MyBitVector& set_range(size_type first, size_type last, bool val = true) {
+        check_range(first, last, "MyBitVector::set_range");
+        if(val) {
+            for_each_word(first, last, [](word_type& w, word_type mask) { w |= mask; });
+        } else {
+            for_each_word(first, last, [](word_type& w, word_type mask) { w &= ~mask; });
+        }
+        return *this;
+    }
+    MyBitVector& reset_range(size_type first, size_type last) { return set_range(first, last, false); }
+    MyBitVector& flip_range(size_type first, size_type last) {
+        check_range(first, last, "MyBitVector::flip_range");
+        for_each_word(first, last, [](word_type& w, word_type mask) { w ^= mask; });
+        return *this;
+    }
+
+    // 全体操作
+    MyBitVector& set() noexcept {
+        std::fill(m_words.begin(), m_words.end(), ~word_type(0));
+        clear_tail();
+        return *this;
+    }
+    MyBitVector& reset() noexcept {
+        std::fill(m_words.begin(), m_words.end(), word_type(0));
+        return *this;
+    }
+    MyBitVector& flip() noexcept {
+        for(word_type& w : m_words) {
+            w = ~w;
+        }
+        clear_tail();
+        return *this;
+    }
+
+    // 统计与查找
+    size_type count() const noexcept { return popcount_words(m_words.data(), m_words.size()); }
+    bool all() const noexcept { return count() == m_size; }
+    bool any() const noexcept { return find_first() != npos; }
+    bool none() const noexcept { return !any(); }
+    // 第一个置位的位置，不存在时返回 npos
+    size_type find_first() const noexcept { return find_from(0); }
+    // pos 之后第一个置位的位置，不存在时返回 npos
+    size_type find_next(size_type pos) const noexcept { return pos + 1 >= m_size ? npos : find_from(pos + 1); }
+
+    // 位运算，两个操作数长度必须相同
+    MyBitVector& operator&=(const MyBitVector& o) {
+        check_same_size(o, "MyBitVector::operator&=");
+        combine_words<word_op::bit_and>(m_words.data(), o.m_words.data(), m_words.size());
+        return *this;
+    }
+    MyBitVector& operator|=(const MyBitVector& o) {
+        check_same_size(o, "MyBitVector::operator|=");
+        combine_words<word_op::bit_or>(m_words.data(), o.m_words.data(), m_words.size());
+        return *this;
+    }
+    MyBitVector& operator^=(const MyBitVector& o) {
+        check_same_size(o, "MyBitVector::operator^=");
+        combine_words<word_op::bit_xor>(m_words.data(), o.m_words.data(), m_words.size());
+        return *this;
+    }
+    // *this &= ~o
+    MyBitVector& and_not(const MyBitVector& o) {
+        check_same_size(o, "MyBitVector::and_not");
+        combine_words<word_op::bit_and_not>(m_words.data(), o.m_words.data(), m_words.size());
+        return *this;
+    }
+    MyBitVector operator~() const {
+        MyBitVector r(*this);
+        r.flip();
+        return r;
+    }
+
+    // 交换
+    void swap(MyBitVector& o) noexcept {
+        m_words.swap(o.m_words);
+        std::swap(m_size, o.m_size);
+    }
+
+    friend bool operator==(const MyBitVector& lhs, const MyBitVector& rhs) {
+        return lhs.m_size == rhs.m_size && lhs.m_words == rhs.m_words;
+    }
+    friend bool operator!=(const MyBitVector& lhs, const MyBitVector& rhs) { return !(lhs == rhs); }
+
+private:
+    MyVector<word_type> m_words;
+    size_type m_size = 0;
+
+    static constexpr size_type words_for(size_type bits) noexcept { return (bits + word_bits - 1) / word_bits; }
+    static constexpr word_type bit(size_type pos) noexcept { return word_type(1) << (pos % word_bits); }
+
+    static int popcount(word_type w) noexcept { return __builtin_popcountll(w); }
+    static int ctz(word_type w) noexcept { return __builtin_ctzll(w); }
+
+    void check_pos(size_type pos, const char* what) const {
+        if(pos >= m_size) {
+            throw std::out_of_range(what);
+        }
+    }
+    void check_range(size_type first, size_type last, const char* what) const {
+        if(first > last || last > m_size) {
+            throw std::out_of_range(what);
+        }
+    }
+    void check_same_size(const MyBitVector& o, const char* what) const {
+        if(m_size != o.m_size) {
+            throw std::invalid_argument(what);
+        }
+    }
+    // 保持末尾字中超出 size() 的位为 0
+    void clear_tail() noexcept {
+        if(m_size % word_bits != 0) {
+            m_words[m_size / word_bits] &= bit(m_size) - 1;
+        }
+    }
+
+    // 对 [first, last) 覆盖的每个字调用 op(word, mask)，mask 为该字中落在区间内的位
+    template <typename Op>
+    void for_each_word(size_type first, size_type last, Op op) noexcept {
+        if(first == last) {
+            return;
+        }
+        size_type fw = first / word_bits;
+        size_type lw = (last - 1) / word_bits;
+        word_type head = ~word_type(0) << (first % word_bits);
+        word_type tail = ~word_type(0) >> (word_bits - 1 - (last - 1) % word_bits);
+        if(fw == lw) {
+            op(m_words[fw], head & tail);
+            return;
+        }
+        op(m_words[fw], head);
+        for(size_type i = fw + 1; i < lw; ++i) {
+            op(m_words[i], ~word_type(0));
+        }
+        op(m_words[lw], tail);
+    }
+
+    // 第一个不小于 pos 的置位位置，全零的字整块跳过
+    size_type find_from(size_type pos) const noexcept {
+        if(pos >= m_size) {
+            return npos;
+        }
+        const word_type* w = m_words.data();
+        size_type n = m_words.size();
+        size_type i = pos / word_bits;
+        word_type cur = w[i] & (~word_type(0) << (pos % word_bits));
+        if(cur) {
+            return i * word_bits + ctz(cur);
+        }
+        ++i;
+#if defined(__AVX2__)
+        for(; i + 4 <= n; i += 4) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w + i));
+            if(!_mm256_testz_si256(v, v)) {
+                break;
+            }
+        }
+#endif
+        for(; i < n; ++i) {
+            if(w[i]) {
+                return i * word_bits + ctz(w[i]);
+            }
+        }
+        return npos;
+    }
+
+    // 字级批量内核
+    static size_type popcount_words(const word_type* w, size_type n) noexcept {
+        size_type i = 0;
+        size_type total = 0;
+#if defined(__AVX2__)
+        // 以 4 位为索引查表求每字节的置位数，再用 sad 按 64 位累加
+        const __m256i lut = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                             0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i low = _mm256_set1_epi8(0x0f);
+        __m256i acc = _mm256_setzero_si256();
+        for(; i + 4 <= n; i += 4) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w + i));
+            __m256i lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(v, low));
+            __m256i hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(v, 4), low));
+            acc = _mm256_add_epi64(acc, _mm256_sad_epu8(_mm256_add_epi8(lo, hi), _mm256_setzero_si256()));
+        }
+        total = static_cast<size_type>(_mm256_extract_epi64(acc, 0) + _mm256_extract_epi64(acc, 1) +
+                                       _mm256_extract_epi64(acc, 2) + _mm256_extract_epi64(acc, 3));
+#endif
+        for(; i < n; ++i) {
+            total += popcount(w[i]);
+        }
+        return total;
+    }
+
+    enum class word_op { bit_and, bit_or, bit_xor, bit_and_not };
+
+    template <word_op Op>
+    static word_type apply(word_type a, word_type b) noexcept {
+        if constexpr(Op == word_op::bit_and) {
+            return a & b;
+        } else if constexpr(Op == word_op::bit_or) {
+            return a | b;
+        } else if constexpr(Op == word_op::bit_xor) {
+            return a ^ b;
+        } else {
+            return a & ~b;
+        }
+    }
+#if defined(__AVX2__)
+    template <word_op Op>
+    static __m256i apply(__m256i a, __m256i b) noexcept {
+        if constexpr(Op == word_op::bit_and) {
+            return _mm256_and_si256(a, b);
+        } else if constexpr(Op == word_op::bit_or) {
+            return _mm256_or_si256(a, b);
+        } else if constexpr(Op == word_op::bit_xor) {
+            return _mm256_xor_si256(a, b);
+        } else {
+            return _mm256_andnot_si256(b, a);
+        }
+    }
+#endif
+    // dst[i] = dst[i] Op src[i]
+    template <word_op Op>
+    static void combine_words(word_type* dst, const word_type* src, size_type n) noexcept {
+        size_type i = 0;
+#if defined(__AVX2__)
+        for(; i + 4 <= n; i += 4) {
+            __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+            __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), apply<Op>(a, b));
+        }
+#endif
+        for(; i < n; ++i) {
+            dst[i] = apply<Op>(dst[i], src[i]);
+        }
+    }
+};
+
+// 全局运算符重载
+inline MyBitVector operator&(MyBitVector lhs, const MyBitVector& rhs) { return lhs &= rhs; }
+inline MyBitVector operator|(MyBitVector lhs, const MyBitVector& rhs) { return lhs |= rhs; }
+inline MyBitVector operator^(MyBitVector lhs, const MyBitVector& rhs) { return lhs ^= rhs; }
+
+inline void swap(MyBitVector& lhs, MyBitVector& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+#endif // MY_BIT_VECTOR_H
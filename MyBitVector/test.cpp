@@ -0,0 +1,223 @@
+#include "my_bit_vector.hpp"
+#include <iostream>
+#include <cassert>
+#include <vector>
+#include <random>
+#include <string>
+
+// 辅助函数，用于输出 MyBitVector 的内容
+void printMyBitVector(const MyBitVector& bits, const std::string& message = "") {
+    if (!message.empty()) {
+        std::cout << message << ": ";
+    }
+    for (std::size_t i = 0; i < bits.size(); ++i) {
+        std::cout << (bits[i] ? '1' : '0');
+    }
+    std::cout << std::endl;
+}
+
+bool sameAs(const MyBitVector& bits, const std::vector<bool>& ref) {
+    if (bits.size() != ref.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < ref.size(); ++i) {
+        if (bits[i] != ref[i]) {
+            return false;
+        }
+    }
+    // 末尾字中超出 size() 的位必须为 0
+    if (bits.size() % 64 != 0 && (bits.data()[bits.word_count() - 1] >> (bits.size() % 64)) != 0) {
+        return false;
+    }
+    return bits.word_count() == (bits.size() + 63) / 64;
+}
+
+std::size_t refCount(const std::vector<bool>& ref) {
+    std::size_t n = 0;
+    for (bool b : ref) {
+        n += b;
+    }
+    return n;
+}
+
+MyBitVector randomBits(std::mt19937& rng, std::size_t n, unsigned density, std::vector<bool>& ref) {
+    MyBitVector bits(n);
+    ref.assign(n, false);
+    for (std::size_t i = 0; i < n; ++i) {
+        if (rng() % 100 < density) {
+            bits[i] = true;
+            ref[i] = true;
+        }
+    }
+    return bits;
+}
+
+int main() {
+    std::cout << "===== 1) 构造与访问 =====" << std::endl;
+    {
+        MyBitVector a;
+        assert(a.empty() && a.count() == 0 && a.find_first() == MyBitVector::npos);
+        MyBitVector b(130, true);
+        assert(b.size() == 130 && b.count() == 130 && b.all() && b.word_count() == 3);
+        MyBitVector c = {true, false, true, true};
+        assert(c.size() == 4 && c[0] && !c[1] && c.count() == 3);
+        printMyBitVector(c, "c");
+        c[1] = c[0];
+        assert(c[1] && c.all());
+        c[3].flip();
+        assert(!c.test(3) && ~c[3]);
+
+        bool thrown = false;
+        try {
+            c.at(4);
+        } catch (const std::out_of_range&) {
+            thrown = true;
+        }
+        assert(thrown);
+        thrown = false;
+        try {
+            b.set_range(10, 131);
+        } catch (const std::out_of_range&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+
+    std::cout << "===== 2) push_back / pop_back / resize =====" << std::endl;
+    {
+        MyBitVector bits;
+        std::vector<bool> ref;
+        for (int i = 0; i < 200; ++i) {
+            bits.push_back(i % 3 == 0);
+            ref.push_back(i % 3 == 0);
+        }
+        assert(sameAs(bits, ref));
+        for (int i = 0; i < 73; ++i) {
+            bits.pop_back();
+            ref.pop_back();
+        }
+        assert(sameAs(bits, ref));
+        bits.resize(300, true);
+        ref.resize(300, true);
+        assert(sameAs(bits, ref));
+        bits.resize(65);
+        ref.resize(65);
+        assert(sameAs(bits, ref));
+        bits.resize(128);
+        ref.resize(128);
+        assert(sameAs(bits, ref));
+        assert(bits.capacity() >= 128);
+        bits.clear();
+        assert(bits.empty() && bits.word_count() == 0);
+    }
+
+    std::cout << "===== 3) 区间 set_range / reset_range / flip_range =====" << std::endl;
+    {
+        MyBitVector bits(500);
+        bits.set_range(3, 5);
+        assert(bits.count() == 2 && bits[3] && bits[4] && !bits[5]);
+        bits.set_range(60, 70);
+        assert(bits.count() == 12);
+        bits.set_range(100, 400);
+        assert(bits.count() == 312);
+        bits.reset_range(150, 350);
+        assert(bits.count() == 112 && bits[149] && !bits[150] && !bits[349] && bits[350]);
+        bits.flip_range(0, 500);
+        assert(bits.count() == 388);
+        bits.set_range(7, 7);
+        assert(bits.count() == 388);
+        bits.flip();
+        assert(bits.count() == 112);
+        bits.set();
+        assert(bits.all());
+        bits.reset();
+        assert(bits.none());
+    }
+
+    std::cout << "===== 4) find_first / find_next =====" << std::endl;
+    {
+        MyBitVector bits(2000);
+        std::vector<std::size_t> expect = {0, 63, 64, 127, 1000, 1999};
+        for (std::size_t p : expect) {
+            bits.set(p);
+        }
+        std::vector<std::size_t> found;
+        for (std::size_t p = bits.find_first(); p != MyBitVector::npos; p = bits.find_next(p)) {
+            found.push_back(p);
+        }
+        assert(found == expect);
+        bits.reset(0);
+        assert(bits.find_first() == 63);
+        assert(bits.find_next(1999) == MyBitVector::npos);
+        assert(bits.find_next(1000) == 1999);
+    }
+
+    std::cout << "===== 5) 位运算 =====" << std::endl;
+    {
+        MyBitVector a = {true, true, false, false};
+        MyBitVector b = {true, false, true, false};
+        assert((a & b) == MyBitVector({true, false, false, false}));
+        assert((a | b) == MyBitVector({true, true, true, false}));
+        assert((a ^ b) == MyBitVector({false, true, true, false}));
+        MyBitVector c = a;
+        c.and_not(b);
+        assert(c == MyBitVector({false, true, false, false}));
+        assert(~a == MyBitVector({false, false, true, true}));
+        assert((~a).count() == 2);
+
+        bool thrown = false;
+        try {
+            a &= MyBitVector(5);
+        } catch (const std::invalid_argument&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+
+    std::cout << "===== 6) 随机对比 std::vector<bool> =====" << std::endl;
+    {
+        std::mt19937 rng(7);
+        for (std::size_t n : {1u, 63u, 64u, 65u, 255u, 256u, 257u, 1000u, 4099u}) {
+            for (unsigned density : {0u, 3u, 50u, 97u}) {
+                std::vector<bool> ra, rb;
+                MyBitVector a = randomBits(rng, n, density, ra);
+                MyBitVector b = randomBits(rng, n, 50, rb);
+                assert(sameAs(a, ra) && a.count() == refCount(ra));
+
+                std::size_t pos = a.find_first();
+                for (std::size_t i = 0; i < n; ++i) {
+                    if (ra[i]) {
+                        assert(pos == i);
+                        pos = a.find_next(pos);
+                    }
+                }
+                assert(pos == MyBitVector::npos);
+
+                std::vector<bool> rand_(n), ror(n), rxor(n), randn(n);
+                for (std::size_t i = 0; i < n; ++i) {
+                    rand_[i] = ra[i] && rb[i];
+                    ror[i] = ra[i] || rb[i];
+                    rxor[i] = ra[i] != rb[i];
+                    randn[i] = ra[i] && !rb[i];
+                }
+                assert(sameAs(a & b, rand_) && (a & b).count() == refCount(rand_));
+                assert(sameAs(a | b, ror));
+                assert(sameAs(a ^ b, rxor));
+                MyBitVector d = a;
+                d.and_not(b);
+                assert(sameAs(d, randn));
+
+                std::size_t first = rng() % (n + 1);
+                std::size_t last = first + rng() % (n - first + 1);
+                a.flip_range(first, last);
+                for (std::size_t i = first; i < last; ++i) {
+                    ra[i] = !ra[i];
+                }
+                assert(sameAs(a, ra));
+            }
+        }
+    }
+
+    std::cout << "All MyBitVector tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,94 @@
+#include "my_concurrent_list.hpp"
+#include "../MyList/my_list.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+
+// 互斥锁保护的 MyList，作为对照组
+class LockedList {
+public:
+    bool insert(int key) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(std::find(m_list.begin(), m_list.end(), key) != m_list.end()) {
+            return false;
+        }
+        m_list.push_back(key);
+        return true;
+    }
+    bool erase(int key) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = std::find(m_list.begin(), m_list.end(), key);
+        if(it == m_list.end()) {
+            return false;
+        }
+        m_list.erase(it);
+        return true;
+    }
+    bool contains(int key) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return std::find(m_list.begin(), m_list.end(), key) != m_list.end();
+    }
+private:
+    std::mutex m_mutex;
+    MyList<int> m_list;
+};
+
+long g_sink = 0;
+
+// 每个线程执行 ops 次操作：90% 查找，5% 插入，5% 删除
+template <typename List>
+double run(List& list, int threads, int ops, int keys) {
+    for(int k = 0; k < keys; k += 2) {
+        list.insert(k);
+    }
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> pool;
+    std::atomic<long> hits{0};
+    for(int t = 0; t < threads; ++t) {
+        pool.emplace_back([&list, &hits, t, ops, keys] {
+            unsigned seed = 2654435761u * (t + 1);
+            long found = 0;
+            for(int i = 0; i < ops; ++i) {
+                seed = seed * 1103515245u + 12345u;
+                int key = static_cast<int>((seed >> 8) % keys);
+                unsigned op = (seed >> 24) % 20;
+                if(op == 0) {
+                    found += list.insert(key);
+                } else if(op == 1) {
+                    found += list.erase(key);
+                } else {
+                    found += list.contains(key);
+                }
+            }
+            // 使用结果，防止查找被优化掉
+            hits += found;
+        });
+    }
+    for(auto& th : pool) {
+        th.join();
+    }
+    g_sink += hits;
+    double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return threads * static_cast<double>(ops) / sec / 1e6;
+}
+
+int main(int argc, char** argv) {
+    int max_threads = argc > 1 ? std::atoi(argv[1]) : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    const int ops = 200000, keys = 1024;
+    std::cout << "threads  MyConcurrentList(Mops/s)  mutex+MyList(Mops/s)" << std::endl;
+    for(int threads = 1; threads <= max_threads; threads *= 2) {
+        MyConcurrentList<int> lockfree;
+        LockedList locked;
+        double a = run(lockfree, threads, ops, keys);
+        double b = run(locked, threads, ops, keys);
+        std::cout << std::setw(7) << threads << std::setw(26) << std::fixed << std::setprecision(2) << a
+                  << std::setw(22) << b << std::endl;
+    }
+    return g_sink < 0;
+}
@@ -0,0 +1,324 @@
+#ifndef MY_CONCURRENT_LIST_H
+#define MY_CONCURRENT_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+#include "../MyVector/my_vector.hpp"
+
+// 全局纪元回收域：线程在临界区内读取共享节点，被删除的节点延迟到所有线程都离开删除时所在纪元后再释放
+// 每次操作只需进出临界区各一次，遍历时不必逐节点发布保护
+class MyEpochDomain {
+public:
+    static constexpr std::size_t max_threads = 256;
+
+    static MyEpochDomain& instance() {
+        static MyEpochDomain domain;
+        return domain;
+    }
+
+    // 临界区守卫，可以嵌套
+    class Guard {
+    public:
+        Guard() { enter(); }
+        ~Guard() { leave(); }
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+    };
+
+    static void enter() {
+        ThreadState& state = local();
+        if(state.depth++ == 0) {
+            MyEpochDomain& domain = instance();
+            state.record->epoch.store(domain.m_epoch.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            // 先公布所在纪元，再读取共享指针
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+    }
+    static void leave() noexcept {
+        ThreadState& state = local();
+        if(--state.depth == 0) {
+            state.record->epoch.store(0, std::memory_order_release);
+        }
+    }
+    // 延迟释放已摘除的 p，达到阈值时尝试推进纪元并回收
+    static void retire(void* p, void (*deleter)(void*)) {
+        ThreadState& state = local();
+        MyEpochDomain& domain = instance();
+        state.limbo.push_back(Retired{p, deleter, domain.m_epoch.load()});
+        if(state.limbo.size() >= reclaim_threshold) {
+            domain.try_advance();
+            domain.reclaim(state.limbo);
+        }
+    }
+    // 立即回收当前线程与已退出线程遗留的、可以安全释放的节点
+    static void collect() {
+        ThreadState& state = local();
+        MyEpochDomain& domain = instance();
+        domain.adopt_orphans(state.limbo);
+        domain.try_advance();
+        domain.try_advance();
+        domain.reclaim(state.limbo);
+    }
+
+    MyEpochDomain(const MyEpochDomain&) = delete;
+    MyEpochDomain& operator=(const MyEpochDomain&) = delete;
+
+private:
+    static constexpr std::size_t reclaim_threshold = 128;
+
+    // epoch 为 0 表示不在临界区
+    struct alignas(64) Record {
+        std::atomic<bool> used{false};
+        std::atomic<std::uint64_t> epoch{0};
+    };
+    struct Retired {
+        void* ptr;
+        void (*deleter)(void*);
+        std::uint64_t epoch;
+    };
+    // 线程退出时归还槽位，尚不能释放的节点移交给域统一回收
+    struct ThreadState {
+        Record* record;
+        std::size_t depth = 0;
+        MyVector<Retired> limbo;
+
+        ThreadState() : record(instance().acquire_record()) {}
+        ~ThreadState() {
+            MyEpochDomain& domain = instance();
+            record->epoch.store(0);
+            domain.try_advance();
+            domain.reclaim(limbo);
+            if(!limbo.empty()) {
+                std::lock_guard<std::mutex> lock(domain.m_orphan_mutex);
+                for(std::size_t i = 0; i < limbo.size(); ++i) {
+                    domain.m_orphans.push_back(limbo[i]);
+                }
+            }
+            record->used.store(false, std::memory_order_release);
+        }
+    };
+
+    Record m_records[max_threads];
+    std::atomic<std::size_t> m_used{0};
+    std::atomic<std::uint64_t> m_epoch{1};
+    std::mutex m_orphan_mutex;
+    MyVector<Retired> m_orphans;
+
+    MyEpochDomain() = default;
+    ~MyEpochDomain() {
+        for(std::size_t i = 0; i < m_orphans.size(); ++i) {
+            m_orphans[i].deleter(m_orphans[i].ptr);
+        }
+    }
+
+    static ThreadState& local() {
+        thread_local ThreadState state;
+        return state;
+    }
+    Record* acquire_record() {
+        for(std::size_t i = 0; i < max_threads; ++i) {
+            bool expected = false;
+            if(!m_records[i].used.load(std::memory_order_relaxed) &&
+               m_records[i].used.compare_exchange_strong(expected, true)) {
+                std::size_t used = m_used.load();
+                while(used < i + 1 && !m_used.compare_exchange_weak(used, i + 1)) {}
+                return &m_records[i];
+            }
+        }
+        throw std::runtime_error("MyEpochDomain: too many threads");
+    }
+    // 所有临界区内的线程都已进入当前纪元时才推进
+    void try_advance() noexcept {
+        std::uint64_t epoch = m_epoch.load();
+        std::size_t used = m_used.load();
+        for(std::size_t i = 0; i < used; ++i) {
+            std::uint64_t e = m_records[i].epoch.load();
+            if(e != 0 && e != epoch) {
+                return;
+            }
+        }
+        m_epoch.compare_exchange_strong(epoch, epoch + 1);
+    }
+    // 纪元 e 中删除的节点在全局纪元到达 e + 2 后不再被任何线程持有
+    void reclaim(MyVector<Retired>& limbo) {
+        std::uint64_t epoch = m_epoch.load();
+        std::size_t kept = 0;
+        for(std::size_t i = 0; i < limbo.size(); ++i) {
+            if(limbo[i].epoch + 2 <= epoch) {
+                limbo[i].deleter(limbo[i].ptr);
+            } else {
+                limbo[kept++] = limbo[i];
+            }
+        }
+        limbo.resize(kept);
+    }
+    void adopt_orphans(MyVector<Retired>& limbo) {
+        std::lock_guard<std::mutex> lock(m_orphan_mutex);
+        for(std::size_t i = 0; i < m_orphans.size(); ++i) {
+            limbo.push_back(m_orphans[i]);
+        }
+        m_orphans.clear();
+    }
+};
+
+// 无锁有序集合（Harris-Michael 链表）：insert / erase / contains 均为无锁操作
+// 删除先在 next 的最低位打标记，再由删除者或后续遍历者摘除节点并交给纪元回收域释放
+template <typename T, typename Compare = std::less<T>>
+class MyConcurrentList {
+public:
+    // 类型别名
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using value_compare = Compare;
+
+    // 构造函数
+    MyConcurrentList() = default;
+    explicit MyConcurrentList(const Compare& comp) : m_comp(comp) {}
+    MyConcurrentList(const MyConcurrentList&) = delete;
+    MyConcurrentList& operator=(const MyConcurrentList&) = delete;
+    // 析构函数，调用时不得有其他线程访问本链表
+    ~MyConcurrentList() {
+        std::uintptr_t p = m_head.load(std::memory_order_acquire);
+        while(Node* n = node_of(p)) {
+            p = n->next.load(std::memory_order_relaxed);
+            delete n;
+        }
+    }
+
+    // 容量，并发修改时仅为近似值
+    size_type size() const noexcept { return m_size.load(std::memory_order_relaxed); }
+    bool empty() const noexcept { return size() == 0; }
+
+    // 修改器，value 已存在时返回 false
+    bool insert(const_reference value) { return insert_node(new Node(value)); }
+    bool insert(T&& value) { return insert_node(new Node(std::move(value))); }
+    bool erase(const_reference key) {
+        MyEpochDomain::Guard guard;
+        Position pos;
+        for(;;) {
+            if(!find(key, pos)) {
+                return false;
+            }
+            std::uintptr_t next = pos.curr->next.load(std::memory_order_acquire);
+            if(is_marked(next)) {
+                continue;
+            }
+            // 标记成功即完成逻辑删除
+            if(!pos.curr->next.compare_exchange_weak(next, next | 1)) {
+                continue;
+            }
+            std::uintptr_t expected = bits_of(pos.curr);
+            if(pos.prev->compare_exchange_strong(expected, next)) {
+                MyEpochDomain::retire(pos.curr, &delete_node);
+            } else {
+                find(key, pos);
+            }
+            m_size.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    // 查找
+    bool contains(const_reference key) const {
+        MyEpochDomain::Guard guard;
+        Position pos;
+        return find(key, pos);
+    }
+
+    // 按顺序访问每个未被删除的元素，可与修改并发进行，每个元素至多访问一次
+    // 已标记节点的 next 不再改变，经过它仍能到达后继，因此遍历无需重试
+    template <typename F>
+    void for_each(F fn) const {
+        MyEpochDomain::Guard guard;
+        std::uintptr_t p = m_head.load(std::memory_order_acquire);
+        while(Node* n = node_of(p)) {
+            p = n->next.load(std::memory_order_acquire);
+            if(!is_marked(p)) {
+                fn(static_cast<const_reference>(n->value));
+            }
+        }
+    }
+
+private:
+    struct Node {
+        T value;
+        std::atomic<std::uintptr_t> next{0};
+
+        template <typename... Args>
+        explicit Node(Args&&... args) : value(std::forward<Args>(args)...) {}
+    };
+    // prev 指向前驱的 next 字段（或表头），curr 为第一个满足条件的节点
+    struct Position {
+        std::atomic<std::uintptr_t>* prev;
+        Node* curr;
+    };
+
+    mutable std::atomic<std::uintptr_t> m_head{0};
+    std::atomic<size_type> m_size{0};
+    Compare m_comp;
+
+    // 辅助函数
+    static Node* node_of(std::uintptr_t p) noexcept { return reinterpret_cast<Node*>(p & ~std::uintptr_t(1)); }
+    static std::uintptr_t bits_of(Node* n) noexcept { return reinterpret_cast<std::uintptr_t>(n); }
+    static bool is_marked(std::uintptr_t p) noexcept { return p & 1; }
+    static void delete_node(void* p) { delete static_cast<Node*>(p); }
+
+    // 须在临界区内调用：从表头找到第一个不小于 key 的未删除节点，沿途摘除已标记的节点
+    bool find(const_reference key, Position& pos) const {
+    retry:
+        std::atomic<std::uintptr_t>* prev = &m_head;
+        std::uintptr_t curr = prev->load(std::memory_order_acquire);
+        for(;;) {
+            Node* c = node_of(curr);
+            if(!c) {
+                pos = Position{prev, nullptr};
+                return false;
+            }
+            std::uintptr_t next = c->next.load(std::memory_order_acquire);
+            if(is_marked(next)) {
+                // 前驱已被修改或标记时从头重试
+                std::uintptr_t expected = curr;
+                if(!prev->compare_exchange_strong(expected, next & ~std::uintptr_t(1))) {
+                    goto retry;
+                }
+                MyEpochDomain::retire(c, &delete_node);
+                curr = next & ~std::uintptr_t(1);
+                continue;
+            }
+            if(!m_comp(c->value, key)) {
+                pos = Position{prev, c};
+                return !m_comp(key, c->value);
+            }
+            prev = &c->next;
+            curr = next;
+        }
+    }
+    bool insert_node(Node* n) {
+        MyEpochDomain::Guard guard;
+        Position pos;
+        for(;;) {
+            if(find(n->value, pos)) {
+                delete n;
+                return false;
+            }
+            std::uintptr_t expected = bits_of(pos.curr);
+            n->next.store(expected, std::memory_order_relaxed);
+            if(pos.prev->compare_exchange_weak(expected, bits_of(n), std::memory_order_release, std::memory_order_relaxed)) {
+                m_size.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+};
+
+#endif // MY_CONCURRENT_LIST_H
@@ -0,0 +1,174 @@
+#include "my_concurrent_list.hpp"
+#include <iostream>
+#include <cassert>
+#include <atomic>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 记录存活对象数，用于检查节点是否全部回收
+struct Tracked {
+    static std::atomic<int> alive;
+    int key;
+    Tracked(int k) : key(k) { ++alive; }
+    Tracked(const Tracked& o) : key(o.key) { ++alive; }
+    ~Tracked() { --alive; }
+    bool operator<(const Tracked& o) const { return key < o.key; }
+};
+std::atomic<int> Tracked::alive{0};
+
+// 辅助函数，收集 MyConcurrentList 的内容
+template <typename T, typename C>
+std::vector<T> toVector(const MyConcurrentList<T, C>& lst) {
+    std::vector<T> out;
+    lst.for_each([&](const T& x) { out.push_back(x); });
+    return out;
+}
+
+int main() {
+    // 1) 单线程基本操作测试
+    std::cout << "===== 1) Basic test =====" << std::endl;
+    {
+        MyConcurrentList<int> list1;
+        assert(list1.empty() && list1.size() == 0);
+        assert(list1.insert(3) && list1.insert(1) && list1.insert(2));
+        assert(!list1.insert(2));
+        assert(list1.size() == 3);
+        assert(list1.contains(1) && !list1.contains(4));
+        assert((toVector(list1) == std::vector<int>{1, 2, 3}));
+        assert(list1.erase(2) && !list1.erase(2));
+        assert((toVector(list1) == std::vector<int>{1, 3}));
+
+        MyConcurrentList<std::string, std::greater<std::string>> list2;
+        list2.insert("apple");
+        list2.insert(std::string("pear"));
+        list2.insert("fig");
+        assert((toVector(list2) == std::vector<std::string>{"pear", "fig", "apple"}));
+        std::cout << "Basic test passed.\n" << std::endl;
+    }
+
+    // 2) 并发插入测试
+    std::cout << "===== 2) concurrent insert test =====" << std::endl;
+    {
+        MyConcurrentList<int> listA;
+        const int threads = 4, per = 2000;
+        std::vector<std::thread> pool;
+        for (int t = 0; t < threads; ++t) {
+            pool.emplace_back([&, t] {
+                // 每个键被两个线程竞争插入
+                for (int i = 0; i < per; ++i) {
+                    listA.insert((i * threads + t) / 2);
+                }
+            });
+        }
+        for (auto& th : pool) {
+            th.join();
+        }
+        std::vector<int> got = toVector(listA);
+        assert(got.size() == static_cast<size_t>(threads * per / 2) && listA.size() == got.size());
+        for (size_t i = 0; i < got.size(); ++i) {
+            assert(got[i] == static_cast<int>(i));
+        }
+        std::cout << "concurrent insert test passed.\n" << std::endl;
+    }
+
+    // 3) 并发插入删除测试
+    std::cout << "===== 3) concurrent insert/erase test =====" << std::endl;
+    {
+        MyConcurrentList<int> listB;
+        const int threads = 4, keys = 512;
+        std::vector<std::set<int>> expect(threads);
+        std::vector<std::thread> pool;
+        for (int t = 0; t < threads; ++t) {
+            pool.emplace_back([&, t] {
+                unsigned seed = 12345u + t;
+                // 每个线程只修改 key % threads == t 的键，最终结果可确定
+                for (int step = 0; step < 20000; ++step) {
+                    seed = seed * 1103515245u + 12345u;
+                    int key = static_cast<int>((seed >> 8) % keys) / threads * threads + t;
+                    if (seed & 1) {
+                        assert(listB.insert(key) == !expect[t].count(key));
+                        expect[t].insert(key);
+                    } else {
+                        assert(listB.erase(key) == (expect[t].count(key) > 0));
+                        expect[t].erase(key);
+                    }
+                    // 其他线程的键只读不写
+                    listB.contains(key + 1);
+                }
+            });
+        }
+        for (auto& th : pool) {
+            th.join();
+        }
+        std::set<int> all;
+        for (auto& s : expect) {
+            all.insert(s.begin(), s.end());
+        }
+        assert(toVector(listB) == std::vector<int>(all.begin(), all.end()));
+        assert(listB.size() == all.size());
+        std::cout << "concurrent insert/erase test passed.\n" << std::endl;
+    }
+
+    // 4) 遍历与删除并发测试
+    std::cout << "===== 4) iterate while erasing test =====" << std::endl;
+    {
+        MyConcurrentList<int> listC;
+        for (int i = 0; i < 4000; ++i) {
+            listC.insert(i);
+        }
+        std::atomic<bool> done{false};
+        std::thread eraser([&] {
+            // 删除所有奇数键，偶数键保持不变
+            for (int i = 1; i < 4000; i += 2) {
+                listC.erase(i);
+                listC.insert(i + 4000);
+            }
+            done = true;
+        });
+        int rounds = 0;
+        while (!done || rounds < 2) {
+            int last = -1, evens = 0;
+            listC.for_each([&](int x) {
+                assert(x > last);
+                last = x;
+                if (x < 4000 && x % 2 == 0) {
+                    ++evens;
+                }
+            });
+            assert(evens == 2000);
+            ++rounds;
+        }
+        eraser.join();
+        assert(listC.size() == 4000 && !listC.contains(1) && listC.contains(4001));
+        std::cout << "iterate while erasing test passed.\n" << std::endl;
+    }
+
+    // 5) 节点回收测试
+    std::cout << "===== 5) reclamation test =====" << std::endl;
+    {
+        {
+            MyConcurrentList<Tracked> listD;
+            std::vector<std::thread> pool;
+            for (int t = 0; t < 3; ++t) {
+                pool.emplace_back([&, t] {
+                    for (int i = 0; i < 3000; ++i) {
+                        listD.insert(Tracked(i % 300));
+                        listD.erase(Tracked((i + t * 100) % 300));
+                    }
+                });
+            }
+            for (auto& th : pool) {
+                th.join();
+            }
+        }
+        // 链表已析构，已退出线程遗留的节点也在此回收
+        MyEpochDomain::collect();
+        assert(Tracked::alive == 0);
+        std::cout << "reclamation test passed.\n" << std::endl;
+    }
+
+    std::cout << "All MyConcurrentList tests passed successfully!" << std::endl;
+    return 0;
+}
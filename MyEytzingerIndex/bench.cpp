@@ -0,0 +1,68 @@
+#include "my_eytzinger_index.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <cstdlib>
+
+std::size_t g_sink = 0;
+
+template <typename F>
+double timeNs(F fn, std::size_t queries) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / queries;
+}
+
+// 在 n 个有序 uint64 键上做随机 lower_bound：std::lower_bound、Eytzinger、S-tree 与批量查找
+int main(int argc, char** argv) {
+    std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : (std::size_t(1) << 24);
+    std::size_t q = 1 << 22;
+    std::mt19937_64 rng(1);
+    MyVector<std::uint64_t> sorted(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        sorted[i] = rng();
+    }
+    std::sort(sorted.begin(), sorted.end());
+    MyVector<std::uint64_t> queries(q);
+    for (std::size_t i = 0; i < q; ++i) {
+        queries[i] = rng();
+    }
+    MyEytzingerIndex<std::uint64_t> eytz(sorted);
+    MyEytzingerIndex<std::uint64_t, 8> stree(sorted);
+    MyVector<std::size_t> out(q);
+
+    double stdNs = timeNs([&] {
+        for (std::size_t i = 0; i < q; ++i) {
+            g_sink += std::lower_bound(sorted.begin(), sorted.end(), queries[i]) - sorted.begin();
+        }
+    }, q);
+    double eytzNs = timeNs([&] {
+        for (std::size_t i = 0; i < q; ++i) {
+            g_sink += eytz.lower_bound(queries[i]);
+        }
+    }, q);
+    double streeNs = timeNs([&] {
+        for (std::size_t i = 0; i < q; ++i) {
+            g_sink += stree.lower_bound(queries[i]);
+        }
+    }, q);
+    double batchNs = timeNs([&] {
+        eytz.lower_bound_batch(queries.data(), q, out.data());
+        g_sink += out[q / 2];
+    }, q);
+    double streeBatchNs = timeNs([&] {
+        stree.lower_bound_batch(queries.data(), q, out.data());
+        g_sink += out[q / 2];
+    }, q);
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "keys: " << n << " (" << n * 8 / (1 << 20) << " MiB), queries: " << q << std::endl;
+    std::cout << "std::lower_bound:          " << stdNs << " ns/query" << std::endl;
+    std::cout << "MyEytzingerIndex<u64>:     " << eytzNs << " ns/query (" << stdNs / eytzNs << "x)" << std::endl;
+    std::cout << "MyEytzingerIndex<u64, 8>:  " << streeNs << " ns/query (" << stdNs / streeNs << "x)" << std::endl;
+    std::cout << "lower_bound_batch<u64>:    " << batchNs << " ns/query (" << stdNs / batchNs << "x)" << std::endl;
+    std::cout << "lower_bound_batch<u64, 8>: " << streeBatchNs << " ns/query (" << stdNs / streeBatchNs << "x)" << std::endl;
+    return g_sink == 1 ? 1 : 0;
+}
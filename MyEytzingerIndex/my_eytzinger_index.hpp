@@ -0,0 +1,251 @@
+#ifndef MY_EYTZINGER_INDEX_H
+#define MY_EYTZINGER_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "../MyVector/my_vector.hpp"
+#include "../MyAllocator/my_allocator.hpp"
+
+// 有序键集合上的静态查找索引：键按 BFS（Eytzinger）顺序存放，查找时从根向下走，每层只访问一个结点
+// 每个结点存放 B 个键、有 B + 1 个子结点；B = 1 为经典的 Eytzinger 布局，
+// B = 64 / sizeof(T) 时每个结点恰好占一条缓存行，即静态 B 树（S-tree），每层只有一次缓存缺失
+// 查找过程没有依赖比较结果的分支，B = 1 时按缓存行预取若干层之后的后代结点
+template <typename T, std::size_t B = 1>
+class MyEytzingerIndex {
+    static_assert(B >= 1, "MyEytzingerIndex: node must hold at least one key");
+
+public:
+    // 类型别名
+    using value_type = T;
+    using size_type = std::size_t;
+
+    static constexpr size_type node_keys = B;
+    static constexpr size_type fanout = B + 1;
+    static constexpr size_type batch_width = 16;
+
+    // 构造函数
+    MyEytzingerIndex() = default;
+    // sorted 必须按 operator< 非降序排列，否则抛出 std::invalid_argument
+    template <typename Allocator>
+    explicit MyEytzingerIndex(const MyVector<T, Allocator>& sorted) {
+        build(sorted.data(), sorted.size());
+    }
+    MyEytzingerIndex(const T* sorted, size_type n) {
+        build(sorted, n);
+    }
+
+    // 容量
+    size_type size() const noexcept { return m_size; }
+    bool empty() const noexcept { return m_size == 0; }
+
+    // 查找
+    // 第一个不小于 key 的键在原有序数组中的下标，不存在时返回 size()
+    size_type lower_bound(const T& key) const {
+        size_type slot = search(key);
+        return slot == npos_slot ? m_size : rank_of(slot);
+    }
+    bool contains(const T& key) const {
+        size_type slot = search(key);
+        return slot != npos_slot && !(key < keys()[slot]);
+    }
+
+    // 批量查找：out[i] = lower_bound(keys[i])
+    // 每 batch_width 个查询同步逐层下降，各查询的缓存缺失相互重叠
+    void lower_bound_batch(const T* queries, size_type n, size_type* out) const {
+        size_type full = n - n % batch_width;
+        for(size_type i = 0; i < full; i += batch_width) {
+            search_group<batch_width>(queries + i, out + i);
+        }
+        for(size_type i = full; i < n; ++i) {
+            out[i] = lower_bound(queries[i]);
+        }
+    }
+    template <typename Allocator>
+    MyVector<size_type> lower_bound_batch(const MyVector<T, Allocator>& queries) const {
+        MyVector<size_type> out(queries.size());
+        lower_bound_batch(queries.data(), queries.size(), out.data());
+        return out;
+    }
+
+private:
+    static constexpr size_type npos_slot = static_cast<size_type>(-1);
+    static constexpr size_type cache_line = 64;
+
+    // 预取的层数：d 层之后的全部后代最多占两条缓存行时才值得预取
+    static constexpr size_type prefetch_levels() {
+        size_type d = 0;
+        size_type nodes = fanout;
+        while(nodes * B * sizeof(T) <= 2 * cache_line) {
+            ++d;
+            nodes *= fanout;
+        }
+        return d;
+    }
+    static constexpr size_type pow_fanout(size_type d) {
+        return d == 0 ? 1 : fanout * pow_fanout(d - 1);
+    }
+    static constexpr size_type prefetch_depth = prefetch_levels();
+    static constexpr size_type prefetch_span = pow_fanout(prefetch_depth);
+    // B = 1 时把结点 k 存放在 k + 1 处，使 d 层后代 [(k + 1) * 2^d - 1, ...) 的起点按 2^d 对齐
+    static constexpr size_type lead = B == 1 ? 1 : 0;
+
+    MyVector<T, MyAlignedAllocator<T, cache_line>> m_keys;
+    // 槽位对应的原下标，只在 B > 1 时保存；键数小于 2^32 时用 32 位存放
+    MyVector<std::uint32_t> m_rank32;
+    MyVector<size_type> m_rank64;
+    size_type m_size = 0;
+    size_type m_nodes = 0;
+    size_type m_full_levels = 0;
+
+    const T* keys() const noexcept { return m_keys.data() + lead; }
+
+    void build(const T* sorted, size_type n) {
+        for(size_type i = 1; i < n; ++i) {
+            if(sorted[i] < sorted[i - 1]) {
+                throw std::invalid_argument("MyEytzingerIndex: keys not sorted");
+            }
+        }
+        m_size = n;
+        m_nodes = (n + B - 1) / B;
+        m_keys.resize(m_nodes * B + lead);
+        if constexpr(B > 1) {
+            if(n <= UINT32_MAX) {
+                m_rank32.resize(m_nodes * B);
+            } else {
+                m_rank64.resize(m_nodes * B);
+            }
+        }
+        size_type next = 0;
+        fill(0, sorted, next);
+        // 前 d 层共有 ((B + 1)^d - 1) / B 个结点
+        for(size_type level_nodes = 1, total = 1; total <= m_nodes; level_nodes *= fanout, total += level_nodes) {
+            ++m_full_levels;
+        }
+    }
+
+    // 按中序遍历依次填入有序键；最后一个结点中多出的位置用最大键填充，
+    // 它们在中序中位于所有真实键之后，不会成为任何查询的答案
+    void fill(size_type node, const T* sorted, size_type& next) {
+        if(node >= m_nodes) {
+            return;
+        }
+        T* dst = m_keys.data() + lead + node * B;
+        for(size_type j = 0; j <= B; ++j) {
+            fill(node * fanout + j + 1, sorted, next);
+            if(j < B) {
+                dst[j] = sorted[std::min(next, m_size - 1)];
+                if constexpr(B > 1) {
+                    size_type slot = node * B + j;
+                    if(m_rank32.empty()) {
+                        m_rank64[slot] = std::min(next, m_size);
+                    } else {
+                        m_rank32[slot] = static_cast<std::uint32_t>(std::min(next, m_size));
+                    }
+                }
+                ++next;
+            }
+        }
+    }
+
+    static size_type floor_log2(size_type x) noexcept {
+        return static_cast<size_type>(63 - __builtin_clzll(static_cast<unsigned long long>(x)));
+    }
+
+    // 槽位在原有序数组中的下标
+    // B = 1 时直接由位置算出：把树补成 H 层的满二叉树，第 l 层的结点 k（从 1 开始编号）
+    // 在满树中序中位于 p = (2 * (k - 2^l) + 1) * 2^(H - 1 - l)，再减去排在它前面、
+    // 实际不存在的最后一层结点个数 max(0, p / 2 - m)，m 为最后一层实际的结点数
+    size_type rank_of(size_type slot) const noexcept {
+        if constexpr(B == 1) {
+            size_type k = slot + 1;
+            size_type level = floor_log2(k);
+            size_type height = floor_log2(m_nodes) + 1;
+            size_type last = m_nodes - ((size_type(1) << (height - 1)) - 1);
+            size_type p = (2 * (k - (size_type(1) << level)) + 1) << (height - 1 - level);
+            size_type missing = p / 2 > last ? p / 2 - last : 0;
+            return p - 1 - missing;
+        } else {
+            return m_rank32.empty() ? m_rank64[slot] : m_rank32[slot];
+        }
+    }
+
+    // 结点中小于 key 的键的个数，固定次数的循环可以展开并向量化
+    static size_type count_less(const T* node, const T& key) {
+        size_type cnt = 0;
+        for(size_type j = 0; j < B; ++j) {
+            cnt += node[j] < key;
+        }
+        return cnt;
+    }
+
+    void prefetch(size_type node) const {
+        if constexpr(prefetch_depth > 0) {
+            // 按地址计算，越过数组末尾的预取不会出错
+            // d 层之后的后代是连续的一段结点，起点为 node * (B + 1)^d + ((B + 1)^d - 1) / B
+            size_type first = node * prefetch_span + (prefetch_span - 1) / B;
+            std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(keys()) + first * B * sizeof(T);
+            __builtin_prefetch(reinterpret_cast<const void*>(addr));
+            if constexpr(prefetch_span * B * sizeof(T) > cache_line) {
+                __builtin_prefetch(reinterpret_cast<const void*>(addr + cache_line));
+            }
+        }
+    }
+
+    // 返回第一个不小于 key 的键所在的槽位，不存在时返回 npos_slot
+    size_type search(const T& key) const {
+        const T* base = keys();
+        size_type node = 0;
+        size_type slot = npos_slot;
+        while(node < m_nodes) {
+            prefetch(node);
+            size_type cnt = count_less(base + node * B, key);
+            slot = cnt < B ? node * B + cnt : slot;
+            node = node * fanout + cnt + 1;
+        }
+        return slot;
+    }
+
+    template <size_type G>
+    void search_group(const T* queries, size_type* out) const {
+        const T* base = keys();
+        size_type node[G];
+        size_type slot[G];
+        for(size_type g = 0; g < G; ++g) {
+            node[g] = 0;
+            slot[g] = npos_slot;
+        }
+        // 前 m_full_levels 层是满的，所有查询都不会走出树，不需要逐个判断
+        for(size_type level = 0; level < m_full_levels; ++level) {
+            for(size_type g = 0; g < G; ++g) {
+                size_type cnt = count_less(base + node[g] * B, queries[g]);
+                slot[g] = cnt < B ? node[g] * B + cnt : slot[g];
+                node[g] = node[g] * fanout + cnt + 1;
+            }
+        }
+        // 不满的最后一层：已经走出树的查询读根结点代替，结果保持不变
+        bool active = false;
+        for(size_type g = 0; g < G; ++g) {
+            active |= node[g] < m_nodes;
+        }
+        while(active) {
+            active = false;
+            for(size_type g = 0; g < G; ++g) {
+                bool inside = node[g] < m_nodes;
+                size_type cur = inside ? node[g] : 0;
+                size_type cnt = count_less(base + cur * B, queries[g]);
+                slot[g] = inside && cnt < B ? cur * B + cnt : slot[g];
+                node[g] = inside ? cur * fanout + cnt + 1 : node[g];
+                active |= node[g] < m_nodes;
+            }
+        }
+        for(size_type g = 0; g < G; ++g) {
+            out[g] = slot[g] == npos_slot ? m_size : rank_of(slot[g]);
+        }
+    }
+};
+
+#endif // MY_EYTZINGER_INDEX_H
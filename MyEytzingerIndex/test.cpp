@@ -0,0 +1,131 @@
+#include "my_eytzinger_index.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+#include <random>
+#include <string>
+
+// 单次查找与 contains 逐个对比 std::lower_bound，批量查找对比单次查找
+template <typename Index, typename T>
+bool sameAsStd(const Index& index, const MyVector<T>& sorted, const std::vector<T>& queries) {
+    for (const T& q : queries) {
+        std::size_t expect = std::lower_bound(sorted.begin(), sorted.end(), q) - sorted.begin();
+        if (index.lower_bound(q) != expect) {
+            return false;
+        }
+        bool found = expect < sorted.size() && !(q < sorted[expect]);
+        if (index.contains(q) != found) {
+            return false;
+        }
+    }
+    MyVector<T> batch;
+    for (const T& q : queries) {
+        batch.push_back(q);
+    }
+    MyVector<std::size_t> out = index.lower_bound_batch(batch);
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+        if (out[i] != index.lower_bound(queries[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 对 0..maxN 的每个长度构造带重复键的有序数组，覆盖所有不满的树形
+template <std::size_t B>
+void checkAllSizes(std::size_t maxN) {
+    for (std::size_t n = 0; n <= maxN; ++n) {
+        MyVector<int> sorted;
+        for (std::size_t i = 0; i < n; ++i) {
+            sorted.push_back(static_cast<int>(i / 3 * 2));
+        }
+        MyEytzingerIndex<int, B> index(sorted);
+        assert(index.size() == n);
+        std::vector<int> queries;
+        for (int q = -2; q <= static_cast<int>(n) + 2; ++q) {
+            queries.push_back(q);
+        }
+        assert(sameAsStd(index, sorted, queries));
+    }
+}
+
+int main() {
+    std::cout << "===== 1) 空索引与基本查找 =====" << std::endl;
+    {
+        MyEytzingerIndex<std::uint64_t> empty;
+        assert(empty.empty() && empty.lower_bound(5) == 0 && !empty.contains(5));
+        MyVector<std::uint64_t> none;
+        MyEytzingerIndex<std::uint64_t, 8> empty8(none);
+        std::size_t out[3];
+        std::uint64_t qs[3] = {1, 2, 3};
+        empty8.lower_bound_batch(qs, 3, out);
+        assert(out[0] == 0 && out[2] == 0);
+
+        MyVector<std::uint64_t> keys = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29};
+        MyEytzingerIndex<std::uint64_t> index(keys);
+        assert(index.size() == 10);
+        assert(index.lower_bound(0) == 0 && index.lower_bound(2) == 0 && index.lower_bound(4) == 2);
+        assert(index.lower_bound(29) == 9 && index.lower_bound(30) == 10);
+        assert(index.contains(13) && !index.contains(14) && !index.contains(100));
+    }
+
+    std::cout << "===== 2) 输入未排序 =====" << std::endl;
+    {
+        MyVector<int> bad = {1, 3, 2};
+        bool thrown = false;
+        try {
+            MyEytzingerIndex<int> index(bad);
+        } catch (const std::invalid_argument&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+
+    std::cout << "===== 3) 所有长度与分块大小 =====" << std::endl;
+    {
+        checkAllSizes<1>(300);
+        checkAllSizes<2>(200);
+        checkAllSizes<3>(200);
+        checkAllSizes<8>(300);
+        checkAllSizes<16>(300);
+    }
+
+    std::cout << "===== 4) 随机大数组对比 std::lower_bound =====" << std::endl;
+    {
+        std::mt19937_64 rng(45);
+        MyVector<std::uint64_t> sorted;
+        for (int i = 0; i < 200000; ++i) {
+            sorted.push_back(rng() % 1000000);
+        }
+        std::sort(sorted.begin(), sorted.end());
+        std::vector<std::uint64_t> queries;
+        for (int i = 0; i < 50000; ++i) {
+            queries.push_back(i % 5 == 0 ? sorted[rng() % sorted.size()] : rng() % 1100000);
+        }
+        assert(sameAsStd(MyEytzingerIndex<std::uint64_t>(sorted), sorted, queries));
+        assert(sameAsStd(MyEytzingerIndex<std::uint64_t, 8>(sorted), sorted, queries));
+
+        MyVector<double> reals;
+        for (int i = 0; i < 5000; ++i) {
+            reals.push_back(i * 0.5 - 100.0);
+        }
+        std::vector<double> rq;
+        for (int i = 0; i < 3000; ++i) {
+            rq.push_back(static_cast<double>(rng() % 6000) * 0.4 - 200.0);
+        }
+        assert(sameAsStd(MyEytzingerIndex<double>(reals), reals, rq));
+        assert(sameAsStd(MyEytzingerIndex<double, 8>(reals), reals, rq));
+    }
+
+    std::cout << "===== 5) 非算术类型 =====" << std::endl;
+    {
+        MyVector<std::string> words = {"apple", "banana", "cherry", "date", "fig", "grape", "kiwi"};
+        MyEytzingerIndex<std::string, 2> index(words);
+        assert(index.lower_bound("cat") == 2 && index.contains("fig") && !index.contains("lemon"));
+        assert(index.lower_bound("zebra") == 7);
+    }
+
+    std::cout << "All MyEytzingerIndex tests passed successfully!" << std::endl;
+    return 0;
+}
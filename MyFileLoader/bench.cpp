@@ -0,0 +1,147 @@
+#include "my_file_loader.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+// 逐行解析十进制整数并追加到 MyVector
+struct Parser {
+    MyVector<std::uint64_t>& out;
+    std::size_t operator()(const char* data, std::size_t len, bool last) {
+        std::size_t used = 0;
+        std::uint64_t value = 0;
+        for (std::size_t i = 0; i < len; ++i) {
+            char c = data[i];
+            if (c == '\n') {
+                out.push_back(value);
+                value = 0;
+                used = i + 1;
+            } else {
+                value = value * 10 + static_cast<std::uint64_t>(c - '0');
+            }
+        }
+        if (last && used < len) {
+            out.push_back(value);
+            used = len;
+        }
+        return used;
+    }
+};
+
+// 把文件从页缓存中逐出，使每次加载都真正读盘
+void evict(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        ::fdatasync(fd);
+        ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        ::close(fd);
+    }
+}
+
+// 原来的做法：read 一块、解析、再 read 下一块
+double sequentialLoad(const std::string& path, std::size_t chunk, MyVector<std::uint64_t>& out) {
+    auto start = std::chrono::steady_clock::now();
+    int fd = ::open(path.c_str(), O_RDONLY);
+    MyVector<char> buf(chunk + 64);
+    std::size_t carry = 0;
+    Parser parse{out};
+    for (;;) {
+        ssize_t r = ::read(fd, buf.data() + carry, chunk);
+        std::size_t len = carry + static_cast<std::size_t>(r > 0 ? r : 0);
+        std::size_t used = parse(buf.data(), len, r <= 0);
+        carry = len - used;
+        std::memmove(buf.data(), buf.data() + used, carry);
+        if (r <= 0) {
+            break;
+        }
+    }
+    ::close(fd);
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// 只读不解析，得到纯 I/O 的时间
+double readOnly(const std::string& path, std::size_t chunk) {
+    auto start = std::chrono::steady_clock::now();
+    int fd = ::open(path.c_str(), O_RDONLY);
+    MyVector<char> buf(chunk);
+    while (::read(fd, buf.data(), chunk) > 0) {
+    }
+    ::close(fd);
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void report(const char* name, double seconds, std::uint64_t bytes, const MyLoaderStats* st) {
+    std::cout << std::left << std::setw(22) << name << std::right << std::fixed << std::setprecision(3)
+              << std::setw(8) << seconds << " s  " << std::setprecision(0) << std::setw(6) << bytes / seconds / 1e6 << " MB/s";
+    if (st) {
+        std::cout << std::setprecision(3) << "   parse " << st->parse_seconds << " s, waiting for I/O " << st->wait_seconds << " s";
+    }
+    std::cout << std::endl;
+}
+
+// 读一个文本文件（每行一个整数）到 MyVector：顺序 read + 解析，与读写重叠的 MyFileLoader 比较
+// 参数为文件大小（MB）；每次加载前把文件逐出页缓存
+int main(int argc, char** argv) {
+    std::size_t mb = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 512;
+    std::string path = "/tmp/my_file_loader_bench.txt";
+    std::uint64_t bytes = 0;
+    {
+        std::FILE* f = std::fopen(path.c_str(), "wb");
+        std::uint64_t x = 88172645463325252ull;
+        std::string line;
+        while (bytes < mb * (std::uint64_t(1) << 20)) {
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+            line = std::to_string(x % 1000000000000ull);
+            line += '\n';
+            std::fwrite(line.data(), 1, line.size(), f);
+            bytes += line.size();
+        }
+        std::fclose(f);
+    }
+    const std::size_t chunk = std::size_t(4) << 20;
+    std::cout << "file: " << bytes / 1e6 << " MB, chunk " << (chunk >> 20) << " MB" << std::endl;
+
+    evict(path);
+    report("read only", readOnly(path, chunk), bytes, nullptr);
+
+    MyVector<std::uint64_t> expect;
+    expect.reserve(static_cast<std::size_t>(bytes / 2));
+    evict(path);
+    report("sequential read+parse", sequentialLoad(path, chunk, expect), bytes, nullptr);
+
+    for (int run = 0; run < 4; ++run) {
+        MyLoaderBackend backend = run % 2 == 0 ? MyLoaderBackend::threads : MyLoaderBackend::io_uring;
+        MyLoaderOptions opt;
+        opt.chunk_bytes = chunk;
+        opt.backend = backend;
+        opt.direct_io = run >= 2;
+        MyVector<std::uint64_t> out;
+        evict(path);
+        try {
+            MyFileLoader loader(path, opt);
+            // 按每行至少 2 字节预留
+            out.reserve(static_cast<std::size_t>(loader.file_size() / 2));
+            MyLoaderStats st = loader.load(Parser{out});
+            if (!(out == expect)) {
+                std::cout << "mismatch" << std::endl;
+                return 1;
+            }
+            std::string name = backend == MyLoaderBackend::threads ? "loader threads" : "loader io_uring";
+            name += loader.direct_io() ? " direct" : "";
+            report(name.c_str(), st.elapsed_seconds, bytes, &st);
+        } catch (const std::system_error& e) {
+            std::cout << e.what() << std::endl;
+        }
+    }
+    std::remove(path.c_str());
+    return 0;
+}
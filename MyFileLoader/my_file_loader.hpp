@@ -0,0 +1,654 @@
+#ifndef MY_FILE_LOADER_H
+#define MY_FILE_LOADER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cerrno>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <numeric>
+
+#include "../MyVector/my_vector.hpp"
+#include "../MyAllocator/my_allocator.hpp"
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>) && defined(SYS_io_uring_setup) && defined(SYS_io_uring_enter)
+#include <linux/io_uring.h>
+#define MY_FILE_LOADER_HAS_IO_URING 1
+#endif
+#endif
+#endif
+
+// 读取方式
+enum class MyLoaderBackend {
+    automatic, // 内核支持时用 io_uring，否则用读线程
+    io_uring,  // 解析线程自己提交异步读，不需要额外线程；不可用时构造函数抛出 std::system_error
+    threads    // io_threads 个后台线程用 pread 读
+};
+
+struct MyLoaderOptions {
+    std::size_t chunk_bytes = std::size_t(4) << 20;    // 每次读取的字节数
+    std::size_t buffers = 3;                          // 缓冲区个数：2 为双缓冲，3 为三缓冲
+    std::size_t max_record_bytes = std::size_t(1) << 16; // 跨块记录的最大长度
+    std::size_t io_threads = 1;                       // threads 方式的读线程数
+    bool direct_io = false;                           // O_DIRECT：绕过页缓存，设备直接写入缓冲区，不占用解析线程的 CPU；
+                                                      // 块大小按 4 KB 取整，文件系统不支持时退回普通读取
+    MyLoaderBackend backend = MyLoaderBackend::automatic;
+};
+
+// 一次加载的统计；解析线程等待数据的时间接近 0 说明解析是瓶颈，解析时间接近 0 说明 I/O 是瓶颈
+struct MyLoaderStats {
+    std::uint64_t bytes = 0;
+    std::uint64_t chunks = 0;
+    double elapsed_seconds = 0; // 整次加载
+    double parse_seconds = 0;   // 解析回调
+    double wait_seconds = 0;    // 解析线程等待数据
+    MyLoaderBackend backend = MyLoaderBackend::threads;
+
+    // 字节 / 秒
+    double throughput() const noexcept { return elapsed_seconds > 0 ? bytes / elapsed_seconds : 0; }
+    double parse_throughput() const noexcept { return parse_seconds > 0 ? bytes / parse_seconds : 0; }
+};
+
+namespace my_loader_detail {
+
+using clock = std::chrono::steady_clock;
+
+inline double seconds_since(clock::time_point t) {
+    return std::chrono::duration<double>(clock::now() - t).count();
+}
+
+[[noreturn]] inline void throw_errno(int err, const std::string& what) {
+    throw std::system_error(err, std::generic_category(), what);
+}
+
+#if defined(__linux__)
+// 从 offset 读 len 字节，读到至少 need 字节或文件末尾为止；返回读到的字节数，失败时返回 -errno
+// O_DIRECT 时 len 按块对齐而 need 为实际需要的字节数，读到 need 即停，不会在不对齐的位置继续读
+inline long long pread_full(int fd, char* buf, std::size_t len, std::size_t need, std::uint64_t offset) {
+    std::size_t done = 0;
+    while(done < need) {
+        ssize_t r = ::pread(fd, buf + done, len - done, static_cast<off_t>(offset + done));
+        if(r < 0) {
+            if(errno == EINTR) {
+                continue;
+            }
+            return -static_cast<long long>(errno);
+        }
+        if(r == 0) {
+            break;
+        }
+        done += static_cast<std::size_t>(r);
+    }
+    return static_cast<long long>(done);
+}
+#endif
+
+#if defined(MY_FILE_LOADER_HAS_IO_URING)
+// 最小的 io_uring 封装：只提交 IORING_OP_READ 并按 user_data 取回结果
+class Uring {
+public:
+    Uring() = default;
+    Uring(const Uring&) = delete;
+    Uring& operator=(const Uring&) = delete;
+    ~Uring() { close(); }
+
+    // 失败时返回 errno，成功返回 0
+    int open(unsigned entries) {
+        io_uring_params p;
+        std::memset(&p, 0, sizeof(p));
+        int fd = static_cast<int>(::syscall(SYS_io_uring_setup, entries, &p));
+        if(fd < 0) {
+            return errno;
+        }
+        m_fd = fd;
+        m_sq_bytes = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+        m_cq_bytes = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+        bool single = (p.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if(single) {
+            m_sq_bytes = m_cq_bytes = m_sq_bytes > m_cq_bytes ? m_sq_bytes : m_cq_bytes;
+        }
+        m_sq = ::mmap(nullptr, m_sq_bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+        if(m_sq == MAP_FAILED) {
+            m_sq = nullptr;
+            return fail();
+        }
+        if(single) {
+            m_cq = m_sq;
+        } else {
+            m_cq = ::mmap(nullptr, m_cq_bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+            if(m_cq == MAP_FAILED) {
+                m_cq = nullptr;
+                return fail();
+            }
+        }
+        m_sqe_bytes = p.sq_entries * sizeof(io_uring_sqe);
+        void* sqes = ::mmap(nullptr, m_sqe_bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+        if(sqes == MAP_FAILED) {
+            return fail();
+        }
+        m_sqes = static_cast<io_uring_sqe*>(sqes);
+        char* sq = static_cast<char*>(m_sq);
+        char* cq = static_cast<char*>(m_cq);
+        m_sq_tail = reinterpret_cast<unsigned*>(sq + p.sq_off.tail);
+        m_sq_mask = *reinterpret_cast<unsigned*>(sq + p.sq_off.ring_mask);
+        m_sq_array = reinterpret_cast<unsigned*>(sq + p.sq_off.array);
+        m_cq_head = reinterpret_cast<unsigned*>(cq + p.cq_off.head);
+        m_cq_tail = reinterpret_cast<unsigned*>(cq + p.cq_off.tail);
+        m_cq_mask = *reinterpret_cast<unsigned*>(cq + p.cq_off.ring_mask);
+        m_cqes = reinterpret_cast<io_uring_cqe*>(cq + p.cq_off.cqes);
+        return 0;
+    }
+
+    // 提交一个读请求；环的容量不小于同时在途的请求数，不会写满
+    void read(int fd, char* buf, unsigned len, std::uint64_t offset, std::uint64_t user_data) {
+        unsigned tail = *m_sq_tail;
+        unsigned index = tail & m_sq_mask;
+        io_uring_sqe* sqe = m_sqes + index;
+        std::memset(sqe, 0, sizeof(*sqe));
+        sqe->opcode = IORING_OP_READ;
+        sqe->fd = fd;
+        sqe->addr = reinterpret_cast<std::uint64_t>(buf);
+        sqe->len = len;
+        sqe->off = offset;
+        sqe->user_data = user_data;
+        m_sq_array[index] = index;
+        __atomic_store_n(m_sq_tail, tail + 1, __ATOMIC_RELEASE);
+        for(;;) {
+            long r = ::syscall(SYS_io_uring_enter, m_fd, 1, 0, 0, nullptr, 0);
+            if(r >= 0) {
+                break;
+            }
+            if(errno != EINTR) {
+                throw_errno(errno, "MyFileLoader: io_uring_enter");
+            }
+        }
+    }
+
+    // 取回一个完成事件，没有时阻塞等待
+    void wait(std::uint64_t& user_data, int& res) {
+        for(;;) {
+            unsigned head = *m_cq_head;
+            if(head != __atomic_load_n(m_cq_tail, __ATOMIC_ACQUIRE)) {
+                const io_uring_cqe& cqe = m_cqes[head & m_cq_mask];
+                user_data = cqe.user_data;
+                res = cqe.res;
+                __atomic_store_n(m_cq_head, head + 1, __ATOMIC_RELEASE);
+                return;
+            }
+            long r = ::syscall(SYS_io_uring_enter, m_fd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+            if(r < 0 && errno != EINTR) {
+                throw_errno(errno, "MyFileLoader: io_uring_enter");
+            }
+        }
+    }
+
+private:
+    int m_fd = -1;
+    void* m_sq = nullptr;
+    void* m_cq = nullptr;
+    io_uring_sqe* m_sqes = nullptr;
+    std::size_t m_sq_bytes = 0;
+    std::size_t m_cq_bytes = 0;
+    std::size_t m_sqe_bytes = 0;
+    unsigned* m_sq_tail = nullptr;
+    unsigned m_sq_mask = 0;
+    unsigned* m_sq_array = nullptr;
+    unsigned* m_cq_head = nullptr;
+    unsigned* m_cq_tail = nullptr;
+    unsigned m_cq_mask = 0;
+    io_uring_cqe* m_cqes = nullptr;
+
+    int fail() {
+        int err = errno;
+        close();
+        return err;
+    }
+
+    void close() {
+        if(m_sqes) {
+            ::munmap(m_sqes, m_sqe_bytes);
+            m_sqes = nullptr;
+        }
+        if(m_cq && m_cq != m_sq) {
+            ::munmap(m_cq, m_cq_bytes);
+        }
+        m_cq = nullptr;
+        if(m_sq) {
+            ::munmap(m_sq, m_sq_bytes);
+            m_sq = nullptr;
+        }
+        if(m_fd >= 0) {
+            ::close(m_fd);
+            m_fd = -1;
+        }
+    }
+};
+#endif
+
+} // namespace my_loader_detail
+
+// 流式文件加载器：按固定大小的块顺序读文件，读与解析重叠进行
+// 块轮流放进 buffers 个缓冲区，第 k 块使用第 k % buffers 个；解析线程（调用 load 的线程）处理第 k 块时，
+// 后面 buffers - 1 块的读取已经在进行，总耗时接近 max(I/O, 解析) 而不是两者之和
+// 不在块边界上结束的记录（解析回调没有消费的尾部）复制到下一块之前，与下一块连起来再交给回调
+class MyFileLoader {
+public:
+    using size_type = std::size_t;
+
+    explicit MyFileLoader(const std::string& path, const MyLoaderOptions& opt = MyLoaderOptions()) : m_opt(opt) {
+        if(m_opt.chunk_bytes == 0 || m_opt.buffers < 2 || m_opt.io_threads == 0) {
+            throw std::invalid_argument("MyFileLoader: chunk_bytes and io_threads must be positive, buffers at least 2");
+        }
+#if defined(__linux__)
+        m_fd = -1;
+#if defined(O_DIRECT)
+        if(m_opt.direct_io) {
+            m_fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC | O_DIRECT);
+            m_direct = m_fd >= 0;
+        }
+#endif
+        if(m_fd < 0) {
+            m_fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        }
+        if(m_fd < 0) {
+            my_loader_detail::throw_errno(errno, "MyFileLoader: open " + path);
+        }
+        struct stat st;
+        if(::fstat(m_fd, &st) != 0) {
+            int err = errno;
+            ::close(m_fd);
+            my_loader_detail::throw_errno(err, "MyFileLoader: fstat " + path);
+        }
+        m_file_size = static_cast<std::uint64_t>(st.st_size);
+        m_backend = resolve_backend();
+#else
+        (void)path;
+        my_loader_detail::throw_errno(ENOSYS, "MyFileLoader");
+#endif
+    }
+    ~MyFileLoader() {
+#if defined(__linux__)
+        if(m_fd >= 0) {
+            ::close(m_fd);
+        }
+#endif
+    }
+    MyFileLoader(const MyFileLoader&) = delete;
+    MyFileLoader& operator=(const MyFileLoader&) = delete;
+
+    std::uint64_t file_size() const noexcept { return m_file_size; }
+    // 实际使用的读取方式（automatic 已确定为其中一种）
+    MyLoaderBackend backend() const noexcept { return m_backend; }
+    // 是否以 O_DIRECT 打开
+    bool direct_io() const noexcept { return m_direct; }
+    const MyLoaderOptions& options() const noexcept { return m_opt; }
+    // 最近一次 load 的统计
+    const MyLoaderStats& stats() const noexcept { return m_stats; }
+    // 当前这次 load 已经交给解析回调的字节数，可以在其他线程中读取以显示进度
+    std::uint64_t bytes_loaded() const noexcept { return m_progress.load(std::memory_order_relaxed); }
+
+    // 按顺序把文件内容交给 parse(const char* data, size_t len, bool last)，返回消费的字节数
+    // 未消费的尾部（不超过 max_record_bytes）与下一块拼接后再次交给回调；last 为 true 时必须全部消费
+    template <typename Parser>
+    MyLoaderStats load(Parser&& parse) {
+        return run(chunk_for(1), parse);
+    }
+
+    // 文件是 T 的连续数组：直接整块追加到 out，开始前按文件大小预留空间
+    // 块大小取 sizeof(T) 的整数倍，记录不会跨块；文件大小不是 sizeof(T) 的整数倍时抛出 std::invalid_argument
+    template <typename T, typename Allocator>
+    MyLoaderStats load_records(MyVector<T, Allocator>& out) {
+        static_assert(std::is_trivially_copyable<T>::value, "MyFileLoader::load_records: T must be trivially copyable");
+        static_assert(alignof(T) <= buffer_alignment, "MyFileLoader::load_records: T is over-aligned");
+        if(m_file_size % sizeof(T) != 0) {
+            throw std::invalid_argument("MyFileLoader::load_records: file size is not a multiple of the record size");
+        }
+        out.reserve(out.size() + static_cast<size_type>(m_file_size / sizeof(T)));
+        return run(chunk_for(sizeof(T)), [&out](const char* data, size_type len, bool) {
+            // 块起点按 buffer_alignment 对齐且是 sizeof(T) 的整数倍
+            const T* first = reinterpret_cast<const T*>(data);
+            size_type cnt = len / sizeof(T);
+            out.insert(out.end(), first, first + cnt);
+            return cnt * sizeof(T);
+        });
+    }
+
+private:
+    static constexpr size_type buffer_alignment = 4096;
+
+    struct Slot {
+        MyVector<char, MyAlignedAllocator<char, buffer_alignment>> buf;
+        std::uint64_t chunk = 0;
+        long long result = 0; // 读到的字节数或 -errno
+        bool ready = false;
+        bool busy = false;
+    };
+
+    MyLoaderOptions m_opt;
+    int m_fd = -1;
+    std::uint64_t m_file_size = 0;
+    MyLoaderBackend m_backend = MyLoaderBackend::threads;
+    bool m_direct = false;
+    MyLoaderStats m_stats;
+    std::atomic<std::uint64_t> m_progress{0};
+
+    // 每个缓冲区前面留出 max_record_bytes（按对齐取整）放上一块剩下的尾部
+    size_type prefix_bytes() const {
+        return (m_opt.max_record_bytes + buffer_alignment - 1) / buffer_alignment * buffer_alignment;
+    }
+
+    // 块大小取 unit 的整数倍（至少一个 unit）；O_DIRECT 时同时是 buffer_alignment 的整数倍
+    size_type chunk_for(size_type unit) const {
+        if(m_direct) {
+            unit = std::lcm(unit, buffer_alignment);
+        }
+        size_type chunk = m_opt.chunk_bytes / unit * unit;
+        return chunk == 0 ? unit : chunk;
+    }
+
+    // 第 k 块实际需要的字节数与提交给内核的字节数（O_DIRECT 时向上对齐，缓冲区足够容纳）
+    size_type chunk_need(std::uint64_t offset, size_type chunk) const {
+        return static_cast<size_type>(std::min<std::uint64_t>(chunk, m_file_size - offset));
+    }
+    size_type chunk_request(std::uint64_t offset, size_type chunk) const {
+        size_type need = chunk_need(offset, chunk);
+        return m_direct ? (need + buffer_alignment - 1) / buffer_alignment * buffer_alignment : need;
+    }
+
+    MyLoaderBackend resolve_backend() {
+        if(m_opt.backend == MyLoaderBackend::threads) {
+            return MyLoaderBackend::threads;
+        }
+#if defined(MY_FILE_LOADER_HAS_IO_URING)
+        // 能建立 io_uring 且内核支持 IORING_OP_READ（5.6 起）才使用：先提交一个零长度的读试探
+        my_loader_detail::Uring probe;
+        int err = probe.open(static_cast<unsigned>(m_opt.buffers));
+        if(err == 0) {
+            // 零长度且地址为空，O_DIRECT 下也满足对齐要求
+            std::uint64_t user = 0;
+            int res = 0;
+            try {
+                probe.read(m_fd, nullptr, 0, 0, 0);
+                probe.wait(user, res);
+            } catch(const std::system_error& e) {
+                res = -e.code().value();
+            }
+            if(res >= 0) {
+                return MyLoaderBackend::io_uring;
+            }
+            err = -res;
+        }
+#else
+        int err = ENOSYS;
+#endif
+        if(m_opt.backend == MyLoaderBackend::io_uring) {
+            ::close(m_fd);
+            my_loader_detail::throw_errno(err, "MyFileLoader: io_uring unavailable");
+        }
+        return MyLoaderBackend::threads;
+    }
+
+    // 后台读线程：按块号顺序领取任务，第 k 块要等解析线程释放第 k - buffers 块所在的缓冲区
+    struct ThreadReader {
+        MyFileLoader& loader;
+        MyVector<Slot>& slots;
+        size_type chunk_bytes;
+        std::uint64_t chunks;
+        std::mutex mutex;
+        std::condition_variable ready_cv;
+        std::condition_variable free_cv;
+        std::uint64_t next = 0;
+        bool stop = false;
+        MyVector<std::thread> threads;
+
+        ThreadReader(MyFileLoader& l, MyVector<Slot>& s, size_type chunk, std::uint64_t n) : loader(l), slots(s), chunk_bytes(chunk), chunks(n) {
+            size_type count = loader.m_opt.io_threads;
+            count = count > n ? static_cast<size_type>(n) : count;
+            threads.reserve(count);
+            try {
+                for(size_type i = 0; i < count; ++i) {
+                    threads.push_back(std::thread([this] { work(); }));
+                }
+            } catch(...) {
+                shutdown();
+                throw;
+            }
+        }
+        ~ThreadReader() { shutdown(); }
+
+        void shutdown() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stop = true;
+            }
+            free_cv.notify_all();
+            for(size_type i = 0; i < threads.size(); ++i) {
+                if(threads[i].joinable()) {
+                    threads[i].join();
+                }
+            }
+        }
+
+        void work() {
+            size_type prefix = loader.prefix_bytes();
+            for(;;) {
+                std::unique_lock<std::mutex> lock(mutex);
+                free_cv.wait(lock, [this] { return stop || next >= chunks || !slots[next % slots.size()].busy; });
+                if(stop || next >= chunks) {
+                    return;
+                }
+                std::uint64_t k = next++;
+                Slot& s = slots[k % slots.size()];
+                s.busy = true;
+                s.ready = false;
+                s.chunk = k;
+                lock.unlock();
+                std::uint64_t offset = k * chunk_bytes;
+                long long r = my_loader_detail::pread_full(loader.m_fd, s.buf.data() + prefix, loader.chunk_request(offset, chunk_bytes),
+                                                           loader.chunk_need(offset, chunk_bytes), offset);
+                lock.lock();
+                s.result = r;
+                s.ready = true;
+                lock.unlock();
+                ready_cv.notify_all();
+            }
+        }
+
+        Slot& acquire(std::uint64_t k) {
+            Slot& s = slots[k % slots.size()];
+            std::unique_lock<std::mutex> lock(mutex);
+            ready_cv.wait(lock, [&] { return s.busy && s.ready && s.chunk == k; });
+            return s;
+        }
+
+        void release(Slot& s) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                s.busy = false;
+                s.ready = false;
+            }
+            free_cv.notify_all();
+        }
+    };
+
+#if defined(MY_FILE_LOADER_HAS_IO_URING)
+    // io_uring：解析线程为每个空闲缓冲区提交一个异步读，需要第 k 块时收取完成事件直到它就绪
+    struct UringReader {
+        MyFileLoader& loader;
+        MyVector<Slot>& slots;
+        size_type chunk_bytes;
+        std::uint64_t chunks;
+        my_loader_detail::Uring ring;
+        std::uint64_t next = 0;
+        size_type in_flight = 0;
+
+        UringReader(MyFileLoader& l, MyVector<Slot>& s, size_type chunk, std::uint64_t n) : loader(l), slots(s), chunk_bytes(chunk), chunks(n) {
+            int err = ring.open(static_cast<unsigned>(slots.size()));
+            if(err != 0) {
+                my_loader_detail::throw_errno(err, "MyFileLoader: io_uring_setup");
+            }
+            try {
+                while(next < chunks && next < slots.size()) {
+                    submit(next++);
+                }
+            } catch(...) {
+                drain();
+                throw;
+            }
+        }
+        ~UringReader() { drain(); }
+
+        // 收回所有在途请求，之后内核不会再写入缓冲区
+        void drain() noexcept {
+            while(in_flight > 0) {
+                std::uint64_t user = 0;
+                int res = 0;
+                try {
+                    ring.wait(user, res);
+                } catch(...) {
+                    return;
+                }
+                --in_flight;
+            }
+        }
+
+        void submit(std::uint64_t k) {
+            Slot& s = slots[k % slots.size()];
+            std::uint64_t offset = k * chunk_bytes;
+            s.chunk = k;
+            s.ready = false;
+            s.busy = true;
+            s.result = 0;
+            unsigned len = static_cast<unsigned>(loader.chunk_request(offset, chunk_bytes));
+            ring.read(loader.m_fd, s.buf.data() + loader.prefix_bytes(), len, offset, k);
+            ++in_flight;
+        }
+
+        Slot& acquire(std::uint64_t k) {
+            Slot& s = slots[k % slots.size()];
+            while(!(s.ready && s.chunk == k)) {
+                std::uint64_t user = 0;
+                int res = 0;
+                ring.wait(user, res);
+                --in_flight;
+                Slot& done = slots[user % slots.size()];
+                done.result = res;
+                done.ready = true;
+            }
+            // 普通文件只在末尾读不满，其余情况（如被信号打断）同步补读剩下的部分
+            if(s.result >= 0) {
+                std::uint64_t offset = k * chunk_bytes;
+                size_type len = loader.chunk_need(offset, chunk_bytes);
+                if(static_cast<size_type>(s.result) < len) {
+                    size_type got = static_cast<size_type>(s.result);
+                    long long r = my_loader_detail::pread_full(loader.m_fd, s.buf.data() + loader.prefix_bytes() + got, len - got, len - got, offset + got);
+                    s.result = r < 0 ? r : static_cast<long long>(got) + r;
+                }
+            }
+            return s;
+        }
+
+        void release(Slot& s) {
+            s.busy = false;
+            s.ready = false;
+            if(next < chunks) {
+                submit(next++);
+            }
+        }
+    };
+#endif
+
+    template <typename Parser>
+    MyLoaderStats run(size_type chunk_bytes, Parser&& parse) {
+        using namespace my_loader_detail;
+        clock::time_point start = clock::now();
+        m_progress.store(0, std::memory_order_relaxed);
+        MyLoaderStats st;
+        st.backend = m_backend;
+        std::uint64_t chunks = (m_file_size + chunk_bytes - 1) / chunk_bytes;
+        size_type prefix = prefix_bytes();
+        MyVector<char> carry;
+        carry.reserve(m_opt.max_record_bytes);
+
+        auto consume = [&](const char* data, size_type len, bool last) {
+            clock::time_point t = clock::now();
+            size_type used = static_cast<size_type>(parse(data, len, last));
+            st.parse_seconds += seconds_since(t);
+            if(used > len) {
+                throw std::out_of_range("MyFileLoader: parser consumed more bytes than provided");
+            }
+            if(last && used != len) {
+                throw std::runtime_error("MyFileLoader: parser left trailing bytes at end of file");
+            }
+            if(len - used > m_opt.max_record_bytes) {
+                throw std::length_error("MyFileLoader: record exceeds max_record_bytes");
+            }
+            carry.clear();
+            carry.insert(carry.end(), data + used, data + len);
+        };
+
+        if(chunks == 0) {
+            consume(nullptr, 0, true);
+        } else {
+            MyVector<Slot> slots(static_cast<size_type>(std::min<std::uint64_t>(m_opt.buffers, chunks)));
+            for(size_type i = 0; i < slots.size(); ++i) {
+                slots[i].buf.resize(prefix + chunk_bytes);
+            }
+            auto drain = [&](auto& reader) {
+                for(std::uint64_t k = 0; k < chunks; ++k) {
+                    clock::time_point t = clock::now();
+                    Slot& s = reader.acquire(k);
+                    st.wait_seconds += seconds_since(t);
+                    if(s.result < 0) {
+                        throw_errno(static_cast<int>(-s.result), "MyFileLoader: read");
+                    }
+                    std::uint64_t offset = k * chunk_bytes;
+                    size_type expect = chunk_need(offset, chunk_bytes);
+                    if(static_cast<size_type>(s.result) < expect) {
+                        throw std::runtime_error("MyFileLoader: file shrank while loading");
+                    }
+                    char* data = s.buf.data() + prefix - carry.size();
+                    if(!carry.empty()) {
+                        std::memcpy(data, carry.data(), carry.size());
+                    }
+                    consume(data, carry.size() + expect, k + 1 == chunks);
+                    reader.release(s);
+                    st.bytes += expect;
+                    ++st.chunks;
+                    m_progress.store(st.bytes, std::memory_order_relaxed);
+                }
+            };
+#if defined(MY_FILE_LOADER_HAS_IO_URING)
+            if(m_backend == MyLoaderBackend::io_uring) {
+                UringReader reader(*this, slots, chunk_bytes, chunks);
+                drain(reader);
+            } else
+#endif
+            {
+                ThreadReader reader(*this, slots, chunk_bytes, chunks);
+                drain(reader);
+            }
+        }
+        st.elapsed_seconds = seconds_since(start);
+        m_stats = st;
+        return st;
+    }
+};
+
+#endif // MY_FILE_LOADER_H
@@ -0,0 +1,249 @@
+#include "my_file_loader.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <stdexcept>
+#include <system_error>
+
+#include <unistd.h>
+
+// 写一个临时文件，返回路径
+std::string writeTemp(const void* data, std::size_t bytes) {
+    char path[] = "/tmp/my_file_loader_XXXXXX";
+    int fd = ::mkstemp(path);
+    assert(fd >= 0);
+    const char* p = static_cast<const char*>(data);
+    std::size_t done = 0;
+    while (done < bytes) {
+        ssize_t w = ::write(fd, p + done, bytes - done);
+        assert(w > 0);
+        done += static_cast<std::size_t>(w);
+    }
+    ::close(fd);
+    return path;
+}
+
+// 按行解析十进制整数，只消费完整的行；最后一块没有换行结尾的行也要解析
+struct LineSum {
+    std::uint64_t sum = 0;
+    std::uint64_t lines = 0;
+    std::size_t operator()(const char* data, std::size_t len, bool last) {
+        std::size_t used = 0;
+        std::uint64_t value = 0;
+        for (std::size_t i = 0; i < len; ++i) {
+            if (data[i] == '\n') {
+                sum += value;
+                ++lines;
+                value = 0;
+                used = i + 1;
+            } else {
+                value = value * 10 + static_cast<std::uint64_t>(data[i] - '0');
+            }
+        }
+        if (last && used < len) {
+            sum += value;
+            ++lines;
+            used = len;
+        }
+        return used;
+    }
+};
+
+MyVector<MyLoaderOptions> allBackends(std::size_t chunk) {
+    MyVector<MyLoaderOptions> out;
+    for (std::size_t buffers : {2, 3}) {
+        for (std::size_t threads : {1, 3}) {
+            MyLoaderOptions opt;
+            opt.chunk_bytes = chunk;
+            opt.buffers = buffers;
+            opt.io_threads = threads;
+            opt.backend = MyLoaderBackend::threads;
+            out.push_back(opt);
+        }
+        for (bool direct : {false, true}) {
+            MyLoaderOptions opt;
+            opt.chunk_bytes = chunk;
+            opt.buffers = buffers;
+            opt.direct_io = direct;
+            opt.backend = MyLoaderBackend::automatic;
+            out.push_back(opt);
+            opt.backend = MyLoaderBackend::threads;
+            out.push_back(opt);
+        }
+    }
+    return out;
+}
+
+int main() {
+    std::cout << "===== 1) 定长记录整块追加 =====" << std::endl;
+    {
+        const std::size_t n = 100000;
+        MyVector<std::uint64_t> src;
+        for (std::size_t i = 0; i < n; ++i) {
+            src.push_back(i * 2654435761u);
+        }
+        std::string path = writeTemp(src.data(), n * sizeof(std::uint64_t));
+        // 块大小不是记录大小的整数倍时向下取整
+        MyVector<MyLoaderOptions> opts = allBackends(4096 * 3 + 5);
+        for (const MyLoaderOptions& opt : opts) {
+            MyFileLoader loader(path, opt);
+            assert(loader.file_size() == n * sizeof(std::uint64_t));
+            assert(loader.backend() != MyLoaderBackend::automatic);
+            MyVector<std::uint64_t> out;
+            out.push_back(42);
+            MyLoaderStats st = loader.load_records(out);
+            assert(out.size() == n + 1 && out.capacity() == n + 1 && out[0] == 42);
+            for (std::size_t i = 0; i < n; ++i) {
+                assert(out[i + 1] == src[i]);
+            }
+            assert(st.bytes == loader.file_size() && loader.bytes_loaded() == st.bytes);
+            // 块大小向下取整为记录大小的整数倍，O_DIRECT 时还要是 4 KB 的整数倍，两种情况都是 12288
+            assert(st.chunks == (n * 8 + 12288 - 1) / 12288);
+            assert(st.backend == loader.backend() && loader.stats().bytes == st.bytes);
+            assert(st.parse_seconds <= st.elapsed_seconds && st.wait_seconds <= st.elapsed_seconds);
+            assert(st.throughput() > 0);
+        }
+        MyLoaderOptions direct;
+        direct.direct_io = true;
+        MyFileLoader probe(path, direct);
+        std::cout << "automatic backend: " << (probe.backend() == MyLoaderBackend::io_uring ? "io_uring" : "threads")
+                  << ", O_DIRECT " << (probe.direct_io() ? "supported" : "unsupported") << std::endl;
+        std::remove(path.c_str());
+    }
+
+    std::cout << "===== 2) 跨块的文本行 =====" << std::endl;
+    {
+        std::string text;
+        std::uint64_t expect = 0;
+        for (std::uint64_t i = 0; i < 5000; ++i) {
+            std::uint64_t v = i * i * 7919 % 1000003;
+            text += std::to_string(v);
+            expect += v;
+            if (i + 1 < 5000) {
+                text += '\n';
+            }
+        }
+        std::string path = writeTemp(text.data(), text.size());
+        for (std::size_t chunk : {7, 64, 1000, 1 << 20}) {
+            MyVector<MyLoaderOptions> opts = allBackends(chunk);
+            for (const MyLoaderOptions& opt : opts) {
+                MyFileLoader loader(path, opt);
+                LineSum parser;
+                loader.load(parser);
+                assert(parser.sum == expect && parser.lines == 5000);
+                // 同一个加载器可以重复加载
+                LineSum again;
+                MyLoaderStats st = loader.load(again);
+                assert(again.sum == expect && st.bytes == text.size());
+            }
+        }
+        std::remove(path.c_str());
+    }
+
+    std::cout << "===== 3) 空文件 =====" << std::endl;
+    {
+        std::string path = writeTemp("", 0);
+        MyFileLoader loader(path);
+        int calls = 0;
+        MyLoaderStats st = loader.load([&calls](const char*, std::size_t len, bool last) {
+            assert(len == 0 && last);
+            ++calls;
+            return std::size_t(0);
+        });
+        assert(calls == 1 && st.bytes == 0 && st.chunks == 0);
+        MyVector<std::uint32_t> out;
+        loader.load_records(out);
+        assert(out.empty());
+        std::remove(path.c_str());
+    }
+
+    std::cout << "===== 4) 错误处理 =====" << std::endl;
+    {
+        bool thrown = false;
+        try {
+            MyFileLoader loader("/nonexistent/my_file_loader");
+        } catch (const std::system_error& e) {
+            thrown = e.code().value() == ENOENT;
+        }
+        assert(thrown);
+
+        std::string data(10000, '1');
+        std::string path = writeTemp(data.data(), data.size());
+        MyLoaderOptions bad;
+        bad.buffers = 1;
+        thrown = false;
+        try {
+            MyFileLoader loader(path, bad);
+        } catch (const std::invalid_argument&) {
+            thrown = true;
+        }
+        assert(thrown);
+
+        for (MyLoaderBackend backend : {MyLoaderBackend::threads, MyLoaderBackend::automatic}) {
+            MyLoaderOptions opt;
+            opt.chunk_bytes = 1000;
+            opt.max_record_bytes = 512;
+            opt.backend = backend;
+            MyFileLoader loader(path, opt);
+
+            // 3 字节的记录与 10000 字节的文件大小不匹配
+            struct Rec3 {
+                char c[3];
+            };
+            MyVector<Rec3> recs;
+            thrown = false;
+            try {
+                loader.load_records(recs);
+            } catch (const std::invalid_argument&) {
+                thrown = true;
+            }
+            assert(thrown && recs.empty());
+
+            // 没有换行：记录超过 max_record_bytes
+            thrown = false;
+            try {
+                loader.load(LineSum());
+            } catch (const std::length_error&) {
+                thrown = true;
+            }
+            assert(thrown);
+
+            // 最后一块没有全部消费
+            thrown = false;
+            try {
+                loader.load([](const char*, std::size_t len, bool last) { return last ? len - 1 : len; });
+            } catch (const std::runtime_error&) {
+                thrown = true;
+            }
+            assert(thrown);
+
+            // 解析回调中途抛出：读线程与在途请求收回后异常传出，加载器仍可使用
+            thrown = false;
+            try {
+                int calls = 0;
+                loader.load([&calls](const char*, std::size_t len, bool) {
+                    if (++calls == 3) {
+                        throw std::runtime_error("parse error");
+                    }
+                    return len;
+                });
+            } catch (const std::runtime_error& e) {
+                thrown = std::string(e.what()) == "parse error";
+            }
+            assert(thrown);
+            std::uint64_t bytes = 0;
+            loader.load([&bytes](const char*, std::size_t len, bool) {
+                bytes += len;
+                return len;
+            });
+            assert(bytes == data.size());
+        }
+        std::remove(path.c_str());
+    }
+
+    std::cout << "All MyFileLoader tests passed successfully!" << std::endl;
+    return 0;
+}
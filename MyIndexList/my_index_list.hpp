@@ -0,0 +1,422 @@
+#ifndef MY_INDEX_LIST_H
+#define MY_INDEX_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <initializer_list>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <iterator>
+#include <utility>
+
+#include "../MyVector/my_vector.hpp"
+
+// 紧凑双向链表：所有节点连续存放在一个 MyVector 中，以 32 位下标代替 prev / next 指针
+template <typename T>
+class MyIndexList {
+public:
+    // 类型别名
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using index_type = std::uint32_t;
+
+    class iterator;
+    class const_iterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr index_type npos = static_cast<index_type>(-1);
+
+    // 构造函数
+    MyIndexList() = default;
+    explicit MyIndexList(size_type count) {
+        reserve(count);
+        for(size_type i = 0; i < count; ++i) {
+            emplace_back();
+        }
+    }
+    MyIndexList(size_type count, const_reference value) {
+        reserve(count);
+        for(size_type i = 0; i < count; ++i) {
+            emplace_back(value);
+        }
+    }
+    MyIndexList(std::initializer_list<T> init) {
+        reserve(init.size());
+        for(const_reference val : init) {
+            emplace_back(val);
+        }
+    }
+    // 逐个拷贝槽位，下标与空闲链保持不变
+    MyIndexList(const MyIndexList& o) : m_head(o.m_head), m_tail(o.m_tail), m_free(o.m_free), m_size(o.m_size) {
+        m_slots.reserve(o.m_slots.size());
+        for(size_type i = 0; i < o.m_slots.size(); ++i) {
+            m_slots.push_back(o.m_slots[i]);
+        }
+    }
+    MyIndexList(MyIndexList&& o) noexcept
+        : m_slots(std::move(o.m_slots)), m_head(o.m_head), m_tail(o.m_tail), m_free(o.m_free), m_size(o.m_size) {
+        o.reset_links();
+    }
+    // 析构函数
+    ~MyIndexList() = default;
+
+    // 赋值运算符
+    MyIndexList& operator=(const MyIndexList& o) {
+        if(this != &o) {
+            MyIndexList tmp(o);
+            swap(tmp);
+        }
+        return *this;
+    }
+    MyIndexList& operator=(MyIndexList&& o) noexcept {
+        if(this != &o) {
+            m_slots = std::move(o.m_slots);
+            m_head = o.m_head;
+            m_tail = o.m_tail;
+            m_free = o.m_free;
+            m_size = o.m_size;
+            o.reset_links();
+        }
+        return *this;
+    }
+    MyIndexList& operator=(std::initializer_list<T> init) {
+        clear();
+        reserve(init.size());
+        for(const_reference val : init) {
+            emplace_back(val);
+        }
+        return *this;
+    }
+
+    // 容量
+    size_type size() const noexcept { return m_size; }
+    bool empty() const noexcept { return m_size == 0; }
+    // 槽位总数，包含空闲槽位
+    size_type capacity() const noexcept { return m_slots.size(); }
+    size_type max_size() const noexcept { return free_mark; }
+    void reserve(size_type count) {
+        if(count > max_size()) {
+            throw std::length_error("MyIndexList::reserve");
+        }
+        m_slots.reserve(count);
+    }
+    // 按遍历顺序重排所有节点并丢弃空闲槽位，之后顺序遍历即为连续访存；使所有迭代器失效
+    void compact() {
+        MyVector<Slot> slots;
+        slots.reserve(m_size);
+        index_type i = 0;
+        for(index_type p = m_head; p != npos; p = m_slots[p].next, ++i) {
+            index_type next = i + 1 == m_size ? npos : i + 1;
+            slots.push_back(Slot(std::in_place, i == 0 ? npos : i - 1, next, std::move(m_slots[p].value)));
+        }
+        m_slots = std::move(slots);
+        m_head = m_size ? 0 : npos;
+        m_tail = m_size ? static_cast<index_type>(m_size - 1) : npos;
+        m_free = npos;
+    }
+
+    // 元素访问
+    reference front() {
+        if(empty()) {
+            throw std::out_of_range("MyIndexList::front");
+        }
+        return m_slots[m_head].value;
+    }
+    const_reference front() const {
+        if(empty()) {
+            throw std::out_of_range("MyIndexList::front");
+        }
+        return m_slots[m_head].value;
+    }
+    reference back() {
+        if(empty()) {
+            throw std::out_of_range("MyIndexList::back");
+        }
+        return m_slots[m_tail].value;
+    }
+    const_reference back() const {
+        if(empty()) {
+            throw std::out_of_range("MyIndexList::back");
+        }
+        return m_slots[m_tail].value;
+    }
+
+    // 修改器
+    // 插入可能使 MyVector 扩容，此时元素的引用与指针失效，迭代器保持有效
+    void push_front(const_reference val) { emplace(cbegin(), val); }
+    void push_front(T&& val) { emplace(cbegin(), std::move(val)); }
+    void push_back(const_reference val) { emplace(cend(), val); }
+    void push_back(T&& val) { emplace(cend(), std::move(val)); }
+    template <typename... Args>
+    reference emplace_front(Args&&... args) { return *emplace(cbegin(), std::forward<Args>(args)...); }
+    template <typename... Args>
+    reference emplace_back(Args&&... args) { return *emplace(cend(), std::forward<Args>(args)...); }
+    void pop_front() {
+        if(empty()) {
+            throw std::out_of_range("MyIndexList::pop_front");
+        }
+        release_slot(m_head);
+    }
+    void pop_back() {
+        if(empty()) {
+            throw std::out_of_range("MyIndexList::pop_back");
+        }
+        release_slot(m_tail);
+    }
+    iterator insert(const_iterator pos, const_reference val) { return emplace(pos, val); }
+    iterator insert(const_iterator pos, T&& val) { return emplace(pos, std::move(val)); }
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        index_type next = pos.m_index;
+        index_type prev = next == npos ? m_tail : m_slots[next].prev;
+        index_type idx = acquire_slot(std::forward<Args>(args)...);
+        Slot& slot = m_slots[idx];
+        slot.prev = prev;
+        slot.next = next;
+        (prev == npos ? m_head : m_slots[prev].next) = idx;
+        (next == npos ? m_tail : m_slots[next].prev) = idx;
+        ++m_size;
+        return iterator(this, idx);
+    }
+    iterator erase(const_iterator pos) {
+        if(pos == cend()) {
+            throw std::out_of_range("MyIndexList::erase");
+        }
+        index_type next = m_slots[pos.m_index].next;
+        release_slot(pos.m_index);
+        return iterator(this, next);
+    }
+    iterator erase(const_iterator first, const_iterator last) {
+        while(first != last) {
+            first = erase(first);
+        }
+        return iterator(this, last.m_index);
+    }
+    // 销毁所有元素，保留槽位存储
+    void clear() noexcept {
+        m_slots.clear();
+        reset_links();
+    }
+
+    // 迭代器
+    iterator begin() noexcept { return iterator(this, m_head); }
+    const_iterator begin() const noexcept { return const_iterator(this, m_head); }
+    iterator end() noexcept { return iterator(this, npos); }
+    const_iterator end() const noexcept { return const_iterator(this, npos); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator crend() const noexcept { return const_reverse_iterator(begin()); }
+
+    // 交换
+    void swap(MyIndexList& o) noexcept {
+        using std::swap;
+        m_slots.swap(o.m_slots);
+        swap(m_head, o.m_head);
+        swap(m_tail, o.m_tail);
+        swap(m_free, o.m_free);
+        swap(m_size, o.m_size);
+    }
+
+private:
+    // 空闲槽位的 prev 置为 free_mark，next 串成空闲链
+    static constexpr index_type free_mark = npos - 1;
+
+    struct Slot {
+        index_type prev;
+        index_type next;
+        union {
+            T value;
+        };
+
+        Slot() noexcept : prev(free_mark), next(npos) {}
+        template <typename... Args>
+        Slot(std::in_place_t, index_type p, index_type n, Args&&... args)
+            : prev(p), next(n), value(std::forward<Args>(args)...) {}
+        Slot(const Slot& o) : prev(o.prev), next(o.next) {
+            if(o.live()) {
+                ::new (static_cast<void*>(std::addressof(value))) T(o.value);
+            }
+        }
+        Slot(Slot&& o) noexcept(std::is_nothrow_move_constructible_v<T>) : prev(o.prev), next(o.next) {
+            if(o.live()) {
+                ::new (static_cast<void*>(std::addressof(value))) T(std::move(o.value));
+            }
+        }
+        Slot& operator=(const Slot&) = delete;
+        ~Slot() {
+            if(live()) {
+                value.~T();
+            }
+        }
+
+        bool live() const noexcept { return prev != free_mark; }
+    };
+
+    MyVector<Slot> m_slots;
+    index_type m_head = npos;
+    index_type m_tail = npos;
+    index_type m_free = npos;
+    size_type m_size = 0;
+
+    // 辅助函数
+    void reset_links() noexcept {
+        m_head = npos;
+        m_tail = npos;
+        m_free = npos;
+        m_size = 0;
+    }
+    // 优先复用空闲槽位，返回的槽位已构造元素但尚未链接
+    template <typename... Args>
+    index_type acquire_slot(Args&&... args) {
+        index_type idx = m_free;
+        if(idx == npos) {
+            if(m_slots.size() >= max_size()) {
+                throw std::length_error("MyIndexList::insert");
+            }
+            if(m_slots.size() == m_slots.capacity()) {
+                // 扩容会移走所有元素，args 可能引用其中之一，先构造出新元素
+                T value(std::forward<Args>(args)...);
+                m_slots.push_back(Slot());
+                return construct_slot(static_cast<index_type>(m_slots.size() - 1), std::move(value));
+            }
+            m_slots.push_back(Slot());
+            idx = static_cast<index_type>(m_slots.size() - 1);
+        } else {
+            m_free = m_slots[idx].next;
+        }
+        return construct_slot(idx, std::forward<Args>(args)...);
+    }
+    // 在空闲槽位 idx 上构造元素，失败时槽位回到空闲链
+    template <typename... Args>
+    index_type construct_slot(index_type idx, Args&&... args) {
+        Slot& slot = m_slots[idx];
+        try {
+            ::new (static_cast<void*>(std::addressof(slot.value))) T(std::forward<Args>(args)...);
+        } catch(...) {
+            slot.next = m_free;
+            m_free = idx;
+            throw;
+        }
+        slot.prev = npos;
+        return idx;
+    }
+    void release_slot(index_type idx) noexcept {
+        Slot& slot = m_slots[idx];
+        (slot.prev == npos ? m_head : m_slots[slot.prev].next) = slot.next;
+        (slot.next == npos ? m_tail : m_slots[slot.next].prev) = slot.prev;
+        slot.value.~T();
+        slot.prev = free_mark;
+        slot.next = m_free;
+        m_free = idx;
+        --m_size;
+    }
+};
+
+template <typename T>
+class MyIndexList<T>::iterator {
+    friend class MyIndexList<T>;
+public:
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using pointer = T*;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    iterator() : m_list(nullptr), m_index(npos) {}
+    iterator(MyIndexList* list, index_type index) : m_list(list), m_index(index) {}
+
+    index_type index() const noexcept { return m_index; }
+    reference operator*() const { return m_list->m_slots[m_index].value; }
+    pointer operator->() const { return std::addressof(m_list->m_slots[m_index].value); }
+    iterator& operator++() {
+        m_index = m_list->m_slots[m_index].next;
+        return *this;
+    }
+    iterator operator++(int) {
+        iterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+    iterator& operator--() {
+        m_index = m_index == npos ? m_list->m_tail : m_list->m_slots[m_index].prev;
+        return *this;
+    }
+    iterator operator--(int) {
+        iterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+    bool operator==(const iterator& o) const { return m_index == o.m_index; }
+    bool operator!=(const iterator& o) const { return m_index != o.m_index; }
+private:
+    MyIndexList* m_list;
+    index_type m_index;
+};
+
+template <typename T>
+class MyIndexList<T>::const_iterator {
+    friend class MyIndexList<T>;
+public:
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = const T&;
+    using pointer = const T*;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    const_iterator() : m_list(nullptr), m_index(npos) {}
+    const_iterator(const MyIndexList* list, index_type index) : m_list(list), m_index(index) {}
+    const_iterator(const iterator& o) : m_list(o.m_list), m_index(o.m_index) {}
+
+    index_type index() const noexcept { return m_index; }
+    reference operator*() const { return m_list->m_slots[m_index].value; }
+    pointer operator->() const { return std::addressof(m_list->m_slots[m_index].value); }
+    const_iterator& operator++() {
+        m_index = m_list->m_slots[m_index].next;
+        return *this;
+    }
+    const_iterator operator++(int) {
+        const_iterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+    const_iterator& operator--() {
+        m_index = m_index == npos ? m_list->m_tail : m_list->m_slots[m_index].prev;
+        return *this;
+    }
+    const_iterator operator--(int) {
+        const_iterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+    bool operator==(const const_iterator& o) const { return m_index == o.m_index; }
+    bool operator!=(const const_iterator& o) const { return m_index != o.m_index; }
+private:
+    const MyIndexList* m_list;
+    index_type m_index;
+};
+
+template <typename T>
+bool operator==(const MyIndexList<T>& lhs, const MyIndexList<T>& rhs) {
+    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename T>
+bool operator!=(const MyIndexList<T>& lhs, const MyIndexList<T>& rhs) {
+    return !(lhs == rhs);
+}
+
+#endif // MY_INDEX_LIST_H
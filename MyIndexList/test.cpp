@@ -0,0 +1,221 @@
+#include "my_index_list.hpp"
+#include <iostream>
+#include <cassert>
+#include <list>
+#include <random>
+#include <string>
+
+// 辅助函数，用于输出 MyIndexList 的内容
+template <typename T>
+void printMyIndexList(const MyIndexList<T>& lst, const std::string& message = "") {
+    if (!message.empty()) {
+        std::cout << message << ": ";
+    }
+    std::cout << "[";
+    for (auto it = lst.begin(); it != lst.end(); ++it) {
+        std::cout << *it;
+        auto temp = it;
+        ++temp;
+        if (temp != lst.end()) {
+            std::cout << ", ";
+        }
+    }
+    std::cout << "]" << std::endl;
+}
+
+template <typename T>
+bool sameAs(const MyIndexList<T>& lst, const std::list<T>& ref) {
+    if (lst.size() != ref.size()) {
+        return false;
+    }
+    auto it = ref.begin();
+    for (const T& x : lst) {
+        if (x != *it++) {
+            return false;
+        }
+    }
+    // 反向遍历同样需要一致
+    auto rit = ref.rbegin();
+    for (auto r = lst.rbegin(); r != lst.rend(); ++r) {
+        if (*r != *rit++) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+    // 1) 构造函数测试
+    std::cout << "===== 1) Constructor test =====" << std::endl;
+    {
+        MyIndexList<int> list1;
+        assert(list1.empty() && list1.capacity() == 0);
+
+        MyIndexList<int> list2(10, 7);
+        assert(list2.size() == 10 && list2.capacity() == 10);
+        for (int x : list2) {
+            assert(x == 7);
+        }
+
+        MyIndexList<int> list3 = {1, 2, 3, 4, 5};
+        MyIndexList<int> list4(list3);
+        assert(list3 == list4);
+        printMyIndexList(list4, "list4 copy of list3");
+
+        MyIndexList<int> list5(std::move(list4));
+        assert(list5 == list3 && list4.empty());
+        // 被移动的链表可以继续使用
+        list4.push_back(1);
+        assert(list4.size() == 1 && list4.front() == 1);
+        std::cout << "Constructor test passed.\n" << std::endl;
+    }
+
+    // 2) push / pop 测试
+    std::cout << "===== 2) push/pop test =====" << std::endl;
+    {
+        MyIndexList<int> listA;
+        for (int i = 0; i < 10; ++i) {
+            listA.push_back(i);
+            listA.push_front(-i);
+        }
+        assert(listA.size() == 20);
+        assert(listA.front() == -9 && listA.back() == 9);
+        listA.pop_front();
+        listA.pop_back();
+        assert(listA.front() == -8 && listA.back() == 8);
+        while (!listA.empty()) {
+            listA.pop_back();
+        }
+        bool thrown = false;
+        try {
+            listA.pop_front();
+        } catch (const std::out_of_range&) {
+            thrown = true;
+        }
+        assert(thrown);
+        std::cout << "push/pop test passed.\n" << std::endl;
+    }
+
+    // 3) 空闲槽位复用与迭代器稳定性测试
+    std::cout << "===== 3) slot reuse test =====" << std::endl;
+    {
+        MyIndexList<int> listB = {0, 1, 2, 3, 4};
+        auto three = listB.begin();
+        std::advance(three, 3);
+        auto it = listB.erase(listB.begin());
+        it = listB.erase(++it);
+        assert(*it == 3 && it == three);
+        assert(listB.size() == 3 && listB.capacity() == 5);
+        // 新元素复用空闲槽位，不增加容量
+        listB.push_back(5);
+        listB.push_front(-1);
+        assert(listB.capacity() == 5);
+        // 扩容后迭代器仍指向原元素
+        for (int i = 6; i < 100; ++i) {
+            listB.push_back(i);
+        }
+        assert(*three == 3);
+        listB.erase(three, listB.end());
+        printMyIndexList(listB, "listB after reuse");
+        assert((listB == MyIndexList<int>{-1, 1}));
+        std::cout << "slot reuse test passed.\n" << std::endl;
+    }
+
+    // 4) compact 测试
+    std::cout << "===== 4) compact test =====" << std::endl;
+    {
+        MyIndexList<std::string> listC;
+        for (int i = 0; i < 8; ++i) {
+            listC.push_front(std::string(20, static_cast<char>('a' + i)));
+        }
+        auto it = listC.begin();
+        ++it;
+        listC.erase(it);
+        listC.pop_back();
+        MyIndexList<std::string> before(listC);
+        listC.compact();
+        assert(listC == before);
+        assert(listC.capacity() == listC.size());
+        // 重排后下标与遍历顺序一致
+        MyIndexList<std::string>::index_type expect = 0;
+        for (auto p = listC.begin(); p != listC.end(); ++p) {
+            assert(p.index() == expect++);
+        }
+        listC.emplace_back(3, 'z');
+        assert(listC.back() == "zzz");
+        std::cout << "compact test passed.\n" << std::endl;
+    }
+
+    // 5) 随机操作与 std::list 对比
+    std::cout << "===== 5) randomized test =====" << std::endl;
+    {
+        std::mt19937 rng(42);
+        MyIndexList<int> lst;
+        std::list<int> ref;
+        for (int step = 0; step < 20000; ++step) {
+            size_t pos = ref.empty() ? 0 : rng() % (ref.size() + 1);
+            auto it = lst.begin();
+            auto rit = ref.begin();
+            std::advance(it, pos);
+            std::advance(rit, pos);
+            if (rng() % 3 != 0 || ref.empty()) {
+                int v = static_cast<int>(rng() % 1000);
+                assert(*lst.insert(it, v) == v);
+                ref.insert(rit, v);
+            } else if (rit != ref.end()) {
+                lst.erase(it);
+                ref.erase(rit);
+            }
+            if (step % 5000 == 0) {
+                lst.compact();
+            }
+        }
+        assert(sameAs(lst, ref));
+        MyIndexList<int> copy(lst);
+        assert(sameAs(copy, ref));
+        std::cout << "randomized test passed.\n" << std::endl;
+    }
+
+    // 6) 非平凡类型、clear 与 swap 测试
+    std::cout << "===== 6) string, clear and swap test =====" << std::endl;
+    {
+        MyIndexList<std::string> listD = {"a", "b", "c", "d"};
+        MyIndexList<std::string> listE = {"x"};
+        listD.emplace(++listD.begin(), 5, 'z');
+        listD.swap(listE);
+        assert(listD.size() == 1 && listD.front() == "x");
+        assert(listE.size() == 5 && *++listE.begin() == "zzzzz");
+        printMyIndexList(listE, "listE after swap");
+        listE = listD;
+        assert(listE == listD);
+        listE.clear();
+        assert(listE.empty() && listE.begin() == listE.end());
+        listE = {"p", "q"};
+        assert(listE.back() == "q");
+        std::cout << "string, clear and swap test passed.\n" << std::endl;
+    }
+
+    // 7) 插入链表自身的元素
+    std::cout << "===== 7) self insert test =====" << std::endl;
+    {
+        // 每次 push_back 都可能触发扩容，参数引用的元素不能先被移走
+        MyIndexList<std::string> listF = {std::string(40, 'f')};
+        for (int i = 0; i < 100; ++i) {
+            listF.push_back(listF.front());
+            listF.push_front(listF.back());
+            listF.emplace(listF.end(), listF.front());
+        }
+        assert(listF.size() == 301);
+        for (const std::string& s : listF) {
+            assert(s == std::string(40, 'f'));
+        }
+        // 复用空闲槽位的路径
+        listF.pop_front();
+        listF.push_back(listF.back());
+        assert(listF.back() == std::string(40, 'f') && listF.size() == 301);
+        std::cout << "self insert test passed.\n" << std::endl;
+    }
+
+    std::cout << "All MyIndexList tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,411 @@
+#ifndef MY_INTRUSIVE_LIST_H
+#define MY_INTRUSIVE_LIST_H
+
+#include <cstddef>
+#include <cstring>
+#include <cassert>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <iterator>
+#include <utility>
+
+// 安全模式：挂钩解除链接时清空指针，重复插入或带链接析构时断言失败
+// 默认在调试构建中开启
+#ifndef MY_INTRUSIVE_SAFE_MODE
+#ifdef NDEBUG
+#define MY_INTRUSIVE_SAFE_MODE 0
+#else
+#define MY_INTRUSIVE_SAFE_MODE 1
+#endif
+#endif
+
+struct MyListHookBase {
+    MyListHookBase* prev = nullptr;
+    MyListHookBase* next = nullptr;
+
+    MyListHookBase() = default;
+    // 拷贝对象不拷贝链接关系
+    MyListHookBase(const MyListHookBase&) noexcept {}
+    MyListHookBase& operator=(const MyListHookBase&) noexcept { return *this; }
+
+    // 仅在安全模式或自动解链挂钩下可靠
+    bool is_linked() const noexcept { return next != nullptr; }
+};
+
+// 普通挂钩：对象析构前必须先从链表中移除
+struct MyListHook : MyListHookBase {
+    MyListHook() = default;
+    MyListHook(const MyListHook&) = default;
+    MyListHook& operator=(const MyListHook&) = default;
+    ~MyListHook() {
+#if MY_INTRUSIVE_SAFE_MODE
+        assert(!is_linked() && "MyListHook destroyed while still linked");
+#endif
+    }
+};
+
+// 自动解链挂钩：对象析构时自动从所在链表移除，
+// 所在链表因此不维护元素个数，size() 为 O(n)
+struct MyAutoUnlinkHook : MyListHookBase {
+    MyAutoUnlinkHook() = default;
+    MyAutoUnlinkHook(const MyAutoUnlinkHook&) = default;
+    MyAutoUnlinkHook& operator=(const MyAutoUnlinkHook&) = default;
+    ~MyAutoUnlinkHook() { unlink(); }
+
+    void unlink() noexcept {
+        if(is_linked()) {
+            prev->next = next;
+            next->prev = prev;
+            prev = nullptr;
+            next = nullptr;
+        }
+    }
+};
+
+template <typename M>
+struct my_hook_member_traits;
+
+template <typename C, typename H>
+struct my_hook_member_traits<H C::*> {
+    using value_type = C;
+    using hook_type = H;
+};
+
+// 侵入式双向链表：链接指针嵌入在对象的 Hook 成员中，
+// 插入删除为 O(1) 且从不分配内存，链表不拥有元素
+template <typename T, auto Hook>
+class MyIntrusiveList {
+    using hook_type = typename my_hook_member_traits<decltype(Hook)>::hook_type;
+    static_assert(std::is_same_v<T, typename my_hook_member_traits<decltype(Hook)>::value_type>,
+                  "MyIntrusiveList: Hook must be a member of T");
+    static_assert(std::is_base_of_v<MyListHookBase, hook_type>,
+                  "MyIntrusiveList: Hook must be a MyListHook or MyAutoUnlinkHook");
+
+    static constexpr bool auto_unlink = std::is_base_of_v<MyAutoUnlinkHook, hook_type>;
+    static constexpr bool reset_hooks = auto_unlink || MY_INTRUSIVE_SAFE_MODE;
+
+public:
+    // 类型别名
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+
+    class iterator;
+    class const_iterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    // 构造函数
+    MyIntrusiveList() noexcept { reset_root(); }
+    MyIntrusiveList(const MyIntrusiveList&) = delete;
+    MyIntrusiveList(MyIntrusiveList&& o) noexcept {
+        reset_root();
+        take_links(o);
+    }
+    // 析构函数，只解除链接，不销毁元素
+    ~MyIntrusiveList() { clear(); }
+
+    // 赋值运算符
+    MyIntrusiveList& operator=(const MyIntrusiveList&) = delete;
+    MyIntrusiveList& operator=(MyIntrusiveList&& o) noexcept {
+        if(this != &o) {
+            clear();
+            take_links(o);
+        }
+        return *this;
+    }
+
+    // 容量
+    size_type size() const noexcept {
+        if constexpr(auto_unlink) {
+            size_type count = 0;
+            for(const MyListHookBase* p = m_root.next; p != &m_root; p = p->next) {
+                ++count;
+            }
+            return count;
+        } else {
+            return m_size;
+        }
+    }
+    bool empty() const noexcept { return m_root.next == &m_root; }
+
+    // 元素访问
+    reference front() {
+        if(empty()) {
+            throw std::out_of_range("MyIntrusiveList::front");
+        }
+        return *to_value(m_root.next);
+    }
+    const_reference front() const {
+        if(empty()) {
+            throw std::out_of_range("MyIntrusiveList::front");
+        }
+        return *to_value(m_root.next);
+    }
+    reference back() {
+        if(empty()) {
+            throw std::out_of_range("MyIntrusiveList::back");
+        }
+        return *to_value(m_root.prev);
+    }
+    const_reference back() const {
+        if(empty()) {
+            throw std::out_of_range("MyIntrusiveList::back");
+        }
+        return *to_value(m_root.prev);
+    }
+
+    // 修改器
+    void push_front(reference val) noexcept { link(&m_root, to_hook(val)); }
+    void push_back(reference val) noexcept { link(m_root.prev, to_hook(val)); }
+    void pop_front() {
+        if(empty()) {
+            throw std::out_of_range("MyIntrusiveList::pop_front");
+        }
+        unlink(m_root.next);
+    }
+    void pop_back() {
+        if(empty()) {
+            throw std::out_of_range("MyIntrusiveList::pop_back");
+        }
+        unlink(m_root.prev);
+    }
+    iterator insert(const_iterator pos, reference val) noexcept {
+        MyListHookBase* node = to_hook(val);
+        link(pos.m_node->prev, node);
+        return iterator(node);
+    }
+    iterator erase(const_iterator pos) {
+        if(pos == cend()) {
+            throw std::out_of_range("MyIntrusiveList::erase");
+        }
+        MyListHookBase* next = pos.m_node->next;
+        unlink(pos.m_node);
+        return iterator(next);
+    }
+    iterator erase(const_iterator first, const_iterator last) noexcept {
+        while(first != last) {
+            MyListHookBase* next = first.m_node->next;
+            unlink(first.m_node);
+            first = const_iterator(next);
+        }
+        return iterator(last.m_node);
+    }
+    // 安全模式或自动解链时逐个清空挂钩，否则 O(1)
+    void clear() noexcept {
+        if constexpr(reset_hooks) {
+            for(MyListHookBase* p = m_root.next; p != &m_root;) {
+                MyListHookBase* next = p->next;
+                p->prev = nullptr;
+                p->next = nullptr;
+                p = next;
+            }
+        }
+        reset_root();
+        m_size = 0;
+    }
+
+    // 链表操作
+    void splice(const_iterator pos, MyIntrusiveList& o, const_iterator it) noexcept {
+        MyListHookBase* p = pos.m_node;
+        MyListHookBase* node = it.m_node;
+        if(p == node || p == node->next) {
+            return;
+        }
+        o.unlink(node);
+        link(p->prev, node);
+    }
+    void splice(const_iterator pos, MyIntrusiveList& o) noexcept {
+        if(this == &o || o.empty()) {
+            return;
+        }
+        MyListHookBase* first = o.m_root.next;
+        MyListHookBase* last = o.m_root.prev;
+        MyListHookBase* p = pos.m_node;
+        last->next = p;
+        first->prev = p->prev;
+        p->prev->next = first;
+        p->prev = last;
+        m_size += o.m_size;
+        o.reset_root();
+        o.m_size = 0;
+    }
+
+    // 由元素得到其迭代器，O(1)
+    iterator iterator_to(reference val) noexcept { return iterator(to_hook(val)); }
+    const_iterator iterator_to(const_reference val) const noexcept {
+        return const_iterator(to_hook(const_cast<reference>(val)));
+    }
+
+    // 迭代器
+    iterator begin() noexcept { return iterator(m_root.next); }
+    const_iterator begin() const noexcept { return const_iterator(m_root.next); }
+    iterator end() noexcept { return iterator(&m_root); }
+    const_iterator end() const noexcept { return const_iterator(root()); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator crend() const noexcept { return const_reverse_iterator(begin()); }
+
+    // 交换
+    void swap(MyIntrusiveList& o) noexcept {
+        MyIntrusiveList tmp(std::move(o));
+        o.take_links(*this);
+        take_links(tmp);
+    }
+
+private:
+    MyListHookBase m_root;
+    size_type m_size = 0;
+
+    // 辅助函数
+    MyListHookBase* root() const noexcept { return const_cast<MyListHookBase*>(&m_root); }
+    void reset_root() noexcept {
+        m_root.prev = &m_root;
+        m_root.next = &m_root;
+    }
+    // 接管 o 的全部元素，调用前本链表必须为空
+    void take_links(MyIntrusiveList& o) noexcept {
+        if(!o.empty()) {
+            m_root.prev = o.m_root.prev;
+            m_root.next = o.m_root.next;
+            m_root.next->prev = &m_root;
+            m_root.prev->next = &m_root;
+        }
+        m_size = o.m_size;
+        o.reset_root();
+        o.m_size = 0;
+    }
+    void link(MyListHookBase* p, MyListHookBase* node) noexcept {
+#if MY_INTRUSIVE_SAFE_MODE
+        assert(!node->is_linked() && "MyIntrusiveList: element is already linked");
+#endif
+        node->next = p->next;
+        node->prev = p;
+        p->next->prev = node;
+        p->next = node;
+        ++m_size;
+    }
+    void unlink(MyListHookBase* node) noexcept {
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+        if constexpr(reset_hooks) {
+            node->prev = nullptr;
+            node->next = nullptr;
+        }
+        --m_size;
+    }
+
+    // 挂钩在 T 中的偏移量，相当于对成员指针使用 offsetof
+    // 主流 ABI 中数据成员指针即成员的字节偏移，直接读取其表示，不需要构造或伪造 T 对象
+    // 编译器会把它折叠为常量；安全模式下 to_hook 用真实对象核对一次
+    static std::ptrdiff_t hook_offset() noexcept {
+        static_assert(sizeof(Hook) == sizeof(std::ptrdiff_t),
+                      "MyIntrusiveList: unsupported member pointer representation");
+        static constexpr decltype(Hook) member = Hook;
+        std::ptrdiff_t offset;
+        std::memcpy(&offset, &member, sizeof(offset));
+        return offset;
+    }
+    static MyListHookBase* to_hook(reference val) noexcept {
+        hook_type* hook = &(val.*Hook);
+#if MY_INTRUSIVE_SAFE_MODE
+        assert(reinterpret_cast<char*>(hook) - reinterpret_cast<char*>(std::addressof(val)) == hook_offset());
+#endif
+        return hook;
+    }
+    static pointer to_value(MyListHookBase* node) noexcept {
+        hook_type* hook = static_cast<hook_type*>(node);
+        return reinterpret_cast<pointer>(reinterpret_cast<char*>(hook) - hook_offset());
+    }
+};
+
+template <typename T, auto Hook>
+class MyIntrusiveList<T, Hook>::iterator {
+    friend class MyIntrusiveList<T, Hook>;
+public:
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using pointer = T*;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    iterator() : m_node(nullptr) {}
+    explicit iterator(MyListHookBase* node) : m_node(node) {}
+
+    reference operator*() const { return *to_value(m_node); }
+    pointer operator->() const { return to_value(m_node); }
+    iterator& operator++() {
+        m_node = m_node->next;
+        return *this;
+    }
+    iterator operator++(int) {
+        iterator tmp(*this);
+        m_node = m_node->next;
+        return tmp;
+    }
+    iterator& operator--() {
+        m_node = m_node->prev;
+        return *this;
+    }
+    iterator operator--(int) {
+        iterator temp(*this);
+        m_node = m_node->prev;
+        return temp;
+    }
+    bool operator==(const iterator& o) const { return m_node == o.m_node; }
+    bool operator!=(const iterator& o) const { return m_node != o.m_node; }
+private:
+    MyListHookBase* m_node;
+};
+
+template <typename T, auto Hook>
+class MyIntrusiveList<T, Hook>::const_iterator {
+    friend class MyIntrusiveList<T, Hook>;
+public:
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = const T&;
+    using pointer = const T*;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    const_iterator() : m_node(nullptr) {}
+    explicit const_iterator(MyListHookBase* node) : m_node(node) {}
+    const_iterator(const iterator& o) : m_node(o.m_node) {}
+
+    reference operator*() const { return *to_value(m_node); }
+    pointer operator->() const { return to_value(m_node); }
+    const_iterator& operator++() {
+        m_node = m_node->next;
+        return *this;
+    }
+    const_iterator operator++(int) {
+        const_iterator tmp(*this);
+        m_node = m_node->next;
+        return tmp;
+    }
+    const_iterator& operator--() {
+        m_node = m_node->prev;
+        return *this;
+    }
+    const_iterator operator--(int) {
+        const_iterator temp(*this);
+        m_node = m_node->prev;
+        return temp;
+    }
+    bool operator==(const const_iterator& o) const { return m_node == o.m_node; }
+    bool operator!=(const const_iterator& o) const { return m_node != o.m_node; }
+private:
+    MyListHookBase* m_node;
+};
+
+#endif // MY_INTRUSIVE_LIST_H
@@ -0,0 +1,189 @@
+#include "my_intrusive_list.hpp"
+#include <iostream>
+#include <cassert>
+#include <string>
+
+struct Task {
+    int id;
+    MyListHook hook;
+
+    explicit Task(int i) : id(i) {}
+};
+
+struct Timer {
+    int id;
+    MyAutoUnlinkHook hook;
+
+    explicit Timer(int i) : id(i) {}
+};
+
+// 挂钩不在对象开头时同样可以正确还原对象地址
+struct Message {
+    std::string body;
+    double priority;
+    MyListHook hook;
+
+    Message(std::string b, double p) : body(std::move(b)), priority(p) {}
+};
+
+// 带虚函数、不能默认构造的非标准布局类型
+struct Shape {
+    virtual ~Shape() = default;
+    virtual double area() const { return side * side; }
+    double side;
+    MyListHook hook;
+    int tag;
+
+    explicit Shape(double s) : side(s), tag(0) {}
+};
+
+using TaskList = MyIntrusiveList<Task, &Task::hook>;
+using TimerList = MyIntrusiveList<Timer, &Timer::hook>;
+using MessageList = MyIntrusiveList<Message, &Message::hook>;
+using ShapeList = MyIntrusiveList<Shape, &Shape::hook>;
+
+// 辅助函数，用于输出 TaskList 的内容
+void printTaskList(const TaskList& lst, const std::string& message = "") {
+    if (!message.empty()) {
+        std::cout << message << ": ";
+    }
+    std::cout << "[";
+    for (auto it = lst.begin(); it != lst.end(); ++it) {
+        std::cout << it->id;
+        auto temp = it;
+        ++temp;
+        if (temp != lst.end()) {
+            std::cout << ", ";
+        }
+    }
+    std::cout << "]" << std::endl;
+}
+
+int main() {
+    // 1) 基本链接测试
+    std::cout << "===== 1) push/pop test =====" << std::endl;
+    {
+        Task a(1), b(2), c(3);
+        TaskList list1;
+        assert(list1.empty());
+        list1.push_back(b);
+        list1.push_back(c);
+        list1.push_front(a);
+        assert(list1.size() == 3);
+        assert(&list1.front() == &a && &list1.back() == &c);
+        assert(a.hook.is_linked());
+        printTaskList(list1, "list1 after pushes");
+
+        list1.pop_front();
+        assert(list1.size() == 2 && &list1.front() == &b);
+#if MY_INTRUSIVE_SAFE_MODE
+        assert(!a.hook.is_linked());
+#endif
+        list1.pop_back();
+        list1.pop_back();
+        assert(list1.empty());
+        std::cout << "push/pop test passed.\n" << std::endl;
+    }
+
+    // 2) insert / erase / iterator_to 测试
+    std::cout << "===== 2) insert/erase test =====" << std::endl;
+    {
+        Task t[5] = {Task(0), Task(1), Task(2), Task(3), Task(4)};
+        TaskList list2;
+        for (Task& x : t) {
+            list2.push_back(x);
+        }
+        auto it = list2.iterator_to(t[2]);
+        assert(it->id == 2);
+        it = list2.erase(it);
+        assert(it->id == 3 && list2.size() == 4);
+
+        Task extra(9);
+        it = list2.insert(it, extra);
+        assert(it->id == 9);
+        printTaskList(list2, "list2 after insert");
+
+        int expect = 4;
+        for (auto rit = list2.rbegin(); rit != list2.rend() && expect > 3; ++rit) {
+            assert(rit->id == expect--);
+        }
+
+        list2.erase(list2.begin(), list2.iterator_to(t[4]));
+        assert(list2.size() == 1 && &list2.front() == &t[4]);
+        list2.clear();
+        std::cout << "insert/erase test passed.\n" << std::endl;
+    }
+
+    // 3) splice 实现 LRU 式移动到开头
+    std::cout << "===== 3) splice test =====" << std::endl;
+    {
+        Task t[4] = {Task(0), Task(1), Task(2), Task(3)};
+        TaskList lru;
+        for (Task& x : t) {
+            lru.push_back(x);
+        }
+        lru.splice(lru.begin(), lru, lru.iterator_to(t[2]));
+        assert(lru.front().id == 2 && lru.size() == 4);
+        printTaskList(lru, "lru after touching 2");
+
+        TaskList other;
+        other.splice(other.end(), lru, lru.iterator_to(t[3]));
+        assert(other.size() == 1 && lru.size() == 3);
+        other.splice(other.begin(), lru);
+        assert(other.size() == 4 && lru.empty());
+        assert(other.back().id == 3);
+
+        TaskList moved(std::move(other));
+        assert(moved.size() == 4 && other.empty());
+        // 被移动的链表可以继续使用
+        Task& first = moved.front();
+        moved.pop_front();
+        other.push_back(first);
+        assert(other.size() == 1 && moved.size() == 3);
+        std::cout << "splice test passed.\n" << std::endl;
+    }
+
+    // 4) 自动解链挂钩测试
+    std::cout << "===== 4) auto-unlink hook test =====" << std::endl;
+    {
+        TimerList timers;
+        Timer t1(1);
+        timers.push_back(t1);
+        {
+            Timer t2(2);
+            timers.push_back(t2);
+            assert(timers.size() == 2);
+        }
+        // t2 析构时自动移除
+        assert(timers.size() == 1 && timers.front().id == 1);
+        t1.hook.unlink();
+        assert(timers.empty());
+        std::cout << "auto-unlink hook test passed.\n" << std::endl;
+    }
+
+    // 5) 挂钩位于对象中间
+    std::cout << "===== 5) member offset test =====" << std::endl;
+    {
+        Message m1("hello", 1.0), m2("world", 2.0);
+        MessageList msgs;
+        msgs.push_back(m1);
+        msgs.push_back(m2);
+        assert(msgs.front().body == "hello" && msgs.back().priority == 2.0);
+        // 拷贝对象不会拷贝链接关系
+        Message copy = m1;
+        assert(!copy.hook.is_linked());
+        msgs.clear();
+
+        Shape s1(1.0), s2(3.0);
+        ShapeList shapes;
+        shapes.push_back(s1);
+        shapes.push_front(s2);
+        assert(&shapes.front() == &s2 && &shapes.back() == &s1);
+        assert(shapes.front().area() == 9.0 && &*shapes.iterator_to(s1) == &s1);
+        shapes.clear();
+        std::cout << "member offset test passed.\n" << std::endl;
+    }
+
+    std::cout << "All MyIntrusiveList tests passed successfully!" << std::endl;
+    return 0;
+}
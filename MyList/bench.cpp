@@ -0,0 +1,85 @@
+#include "my_list.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <cstdlib>
+#include <cstdint>
+#include <algorithm>
+
+struct Sample {
+    std::uint64_t id;
+    double value;
+    double weight;
+};
+
+template <typename F>
+double timeMs(F fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+// 每个元素的计算量，模拟分析扫描中较轻的逐元素处理
+inline double score(const Sample& s, int work) {
+    double x = s.value;
+    for (int i = 0; i < work; ++i) {
+        x = x * 0.999 + s.weight;
+    }
+    return x;
+}
+
+// 节点按随机顺序分布在内存中，比较普通迭代与 for_each_prefetched / visit_batches
+// 参数为元素个数、每个元素的计算量与预取距离
+int main(int argc, char** argv) {
+    std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 4000000;
+    int work = argc > 2 ? std::atoi(argv[2]) : 8;
+    std::size_t distance = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 8;
+
+    // 先按顺序构造，再随机重排后依次移到另一条链表，使相邻元素的节点在内存中相距很远
+    MyList<Sample> source;
+    for (std::size_t i = 0; i < n; ++i) {
+        source.push_back({i, static_cast<double>(i % 1000), 0.5});
+    }
+    MyVector<MyList<Sample>::iterator> order;
+    order.reserve(n);
+    for (auto it = source.begin(); it != source.end(); ++it) {
+        order.push_back(it);
+    }
+    std::shuffle(order.begin(), order.end(), std::mt19937_64(1));
+    MyList<Sample> list;
+    for (auto it : order) {
+        list.splice(list.end(), source, it);
+    }
+
+    std::cout << "elements: " << n << ", work: " << work << ", distance: " << distance << std::endl;
+    for (int round = 0; round < 3; ++round) {
+        double a = 0, b = 0, c = 0;
+        double plainMs = timeMs([&] {
+            for (const Sample& s : list) {
+                a += score(s, work);
+            }
+        });
+        double prefetchMs = timeMs([&] {
+            list.for_each_prefetched([&](const Sample& s) { b += score(s, work); }, distance);
+        });
+        MyVector<const Sample*> scratch;
+        double batchMs = timeMs([&] {
+            static_cast<const MyList<Sample>&>(list).visit_batches([&](const Sample** data, std::size_t cnt) {
+                for (std::size_t i = 0; i < cnt; ++i) {
+                    c += score(*data[i], work);
+                }
+            }, scratch, 64, distance);
+        });
+        if (a != b || a != c) {
+            std::cerr << "mismatch" << std::endl;
+            return 1;
+        }
+        std::cout << std::fixed << std::setprecision(1) << "iterator " << std::setw(8) << plainMs << " ms   prefetched "
+                  << std::setw(8) << prefetchMs << " ms (" << std::setprecision(2) << plainMs / prefetchMs
+                  << "x)   batches " << std::setprecision(1) << std::setw(8) << batchMs << " ms (" << std::setprecision(2)
+                  << plainMs / batchMs << "x)" << std::endl;
+    }
+    return 0;
+}
@@ -8,6 +8,262 @@
 #include <stdexcept>
 #include <type_traits>
 #include <iterator>
+#include <functional>
+#include <utility>
+#include <cstdint>
+#include <new>
+#include <mutex>
+
+#include "../MyVector/my_vector.hpp"
+
+namespace my_list_detail {
+
+// 节点池：同一线程中节点大小与对齐相同的所有 MyList 共用一条空闲链表，链表对象本身不持有任何池状态，
+// 节点 splice 到其他链表后由新链表销毁，归还到销毁时所在线程的节点池。
+// slab 从 256 字节起逐个翻倍，上限 64 KB（至少容纳一个节点）；只释放全部节点都在本线程空闲链表中的 slab。
+// 线程退出时剩余的 slab 与空闲节点交给全局的孤儿池，由之后需要扩容的线程接管。
+// 空闲链表比本线程 slab 的容量多出一批（64 KB）时，多出的部分是其他线程分配的节点，
+// 同样交给孤儿池，生产者/消费者式的用法中分配方空闲链表耗尽时会把它们接管回去
+template <std::size_t Size, std::size_t Align>
+class NodePool {
+public:
+    static void* acquire() {
+        State& s = t_state;
+        if(!s.free) {
+            return acquire_slow();
+        }
+        FreeNode* node = s.free;
+        s.free = node->next;
+        --s.free_count;
+        return node;
+    }
+    static void release(void* p) noexcept {
+        State& s = t_state;
+        if(s.mode != active) {
+            release_slow(p);
+            return;
+        }
+        push(s, p);
+        if(s.free_count > s.capacity + spill_nodes) {
+            spill(s);
+        }
+    }
+    // 空闲节点不少于 count 个，不足部分一次分配为一个 slab
+    static void reserve(std::size_t count) {
+        State& s = local();
+        if(count > s.free_count) {
+            add_slab(s, count - s.free_count);
+        }
+    }
+    static void trim() {
+        if(t_state.mode == active) {
+            trim(t_state);
+        }
+    }
+    static std::size_t capacity() noexcept { return t_state.capacity; }
+
+private:
+    struct FreeNode {
+        FreeNode* next;
+    };
+    struct Slab {
+        Slab* next;
+        std::size_t nodes;
+    };
+    struct Store {
+        FreeNode* free;
+        Slab* slabs;
+        std::size_t free_count;
+        std::size_t capacity;   // 本池所有 slab 的节点总数
+        std::size_t next_bytes; // 下一个 slab 的大小，0 表示尚未分配过
+    };
+    enum Mode : unsigned char { fresh, active, exited };
+    struct State : Store {
+        Mode mode;
+    };
+    struct Orphans : Store {
+        std::mutex lock;
+    };
+    struct ThreadExit {
+        ~ThreadExit() { retire(); }
+    };
+
+    static constexpr std::size_t header = (sizeof(Slab) + Align - 1) / Align * Align;
+    static constexpr std::size_t first_bytes = 256;
+    static constexpr std::size_t max_bytes = std::size_t(64) << 10;
+    static constexpr std::size_t spill_nodes = max_bytes / Size > 0 ? max_bytes / Size : 1;
+
+    // 常量初始化的 thread_local，访问时不经过初始化检查
+    inline static thread_local State t_state{};
+
+    static Orphans& orphans() {
+        // 有意不析构：静态对象析构之后仍可能有节点归还
+        static Orphans* o = new Orphans();
+        return *o;
+    }
+    static State& local() {
+        State& s = t_state;
+        if(s.mode == fresh) {
+            static thread_local ThreadExit guard;
+            (void)guard;
+            s.mode = active;
+        }
+        return s;
+    }
+    static void push(Store& s, void* p) noexcept {
+        s.free = ::new (p) FreeNode{s.free};
+        ++s.free_count;
+    }
+    static void* pop(Store& s) noexcept {
+        FreeNode* node = s.free;
+        s.free = node->next;
+        --s.free_count;
+        return node;
+    }
+    static void* acquire_slow() {
+        State& s = local();
+        if(s.mode == exited) {
+            Orphans& o = orphans();
+            std::lock_guard<std::mutex> guard(o.lock);
+            if(!o.free) {
+                grow(o);
+            }
+            return pop(o);
+        }
+        adopt(s);
+        if(!s.free) {
+            grow(s);
+        }
+        return pop(s);
+    }
+    static void release_slow(void* p) noexcept {
+        State& s = t_state;
+        if(s.mode == exited) {
+            Orphans& o = orphans();
+            std::lock_guard<std::mutex> guard(o.lock);
+            push(o, p);
+            return;
+        }
+        push(local(), p);
+    }
+    // 超出本线程容量的空闲节点交给孤儿池
+    static void spill(Store& s) noexcept {
+        Orphans& o = orphans();
+        std::lock_guard<std::mutex> guard(o.lock);
+        while(s.free_count > s.capacity) {
+            push(o, pop(s));
+        }
+    }
+    // 接管退出线程留下的 slab 与其他线程交出的空闲节点
+    static void adopt(Store& s) {
+        Orphans& o = orphans();
+        std::lock_guard<std::mutex> guard(o.lock);
+        if(!o.slabs && !o.free) {
+            return;
+        }
+        merge(s, o);
+    }
+    // 把 from 的 slab 与空闲节点全部并入 to
+    static void merge(Store& to, Store& from) noexcept {
+        while(from.slabs) {
+            Slab* slab = from.slabs;
+            from.slabs = slab->next;
+            slab->next = to.slabs;
+            to.slabs = slab;
+        }
+        while(from.free) {
+            push(to, pop(from));
+        }
+        to.capacity += from.capacity;
+        to.next_bytes = std::max(to.next_bytes, from.next_bytes);
+        from.capacity = 0;
+    }
+    static void retire() noexcept {
+        State& s = t_state;
+        try {
+            trim(s);
+        } catch(...) {
+            // 内存不足时不整理，slab 原样交出
+        }
+        Orphans& o = orphans();
+        {
+            std::lock_guard<std::mutex> guard(o.lock);
+            merge(o, s);
+        }
+        s.next_bytes = 0;
+        s.mode = exited;
+    }
+    static void grow(Store& s) {
+        s.next_bytes = s.next_bytes == 0 ? first_bytes : std::min(s.next_bytes * 2, max_bytes);
+        add_slab(s, std::max<std::size_t>(1, s.next_bytes / Size));
+    }
+    static void add_slab(Store& s, std::size_t nodes) {
+        Slab* slab = static_cast<Slab*>(allocate(header + nodes * Size));
+        slab->nodes = nodes;
+        slab->next = s.slabs;
+        s.slabs = slab;
+        s.capacity += nodes;
+        // 逆序压入空闲链表，使连续插入得到地址递增的节点
+        char* base = reinterpret_cast<char*>(slab) + header;
+        for(std::size_t i = nodes; i > 0; --i) {
+            push(s, base + (i - 1) * Size);
+        }
+    }
+    // 释放全部节点都空闲的 slab，其余空闲节点按地址重新排列
+    static void trim(Store& s) {
+        MyVector<char*> free;
+        free.reserve(s.free_count);
+        for(FreeNode* node = s.free; node; node = node->next) {
+            free.push_back(reinterpret_cast<char*>(node));
+        }
+        std::sort(free.begin(), free.end());
+        Slab* slabs = s.slabs;
+        s.slabs = nullptr;
+        while(slabs) {
+            Slab* slab = slabs;
+            slabs = slab->next;
+            char* begin = reinterpret_cast<char*>(slab) + header;
+            char* end = begin + slab->nodes * Size;
+            auto lo = std::lower_bound(free.begin(), free.end(), begin);
+            auto hi = std::lower_bound(lo, free.end(), end);
+            if(static_cast<std::size_t>(hi - lo) == slab->nodes) {
+                // 移出后这些节点不再参与重建空闲链表
+                std::fill(lo, hi, nullptr);
+                s.capacity -= slab->nodes;
+                deallocate(slab, header + slab->nodes * Size);
+            } else {
+                slab->next = s.slabs;
+                s.slabs = slab;
+            }
+        }
+        s.free = nullptr;
+        s.free_count = 0;
+        for(std::size_t i = free.size(); i > 0; --i) {
+            if(free[i - 1]) {
+                push(s, free[i - 1]);
+            }
+        }
+        if(!s.slabs) {
+            s.next_bytes = 0;
+        }
+    }
+    static void* allocate(std::size_t bytes) {
+        if constexpr(Align > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            return ::operator new(bytes, std::align_val_t(Align));
+        } else {
+            return ::operator new(bytes);
+        }
+    }
+    static void deallocate(void* p, std::size_t bytes) noexcept {
+        if constexpr(Align > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            ::operator delete(p, bytes, std::align_val_t(Align));
+        } else {
+            ::operator delete(p, bytes);
+        }
+    }
+};
+
+} // namespace my_list_detail
 
 template <typename T>
 class MyList {
@@ -27,56 +283,52 @@ public:
     using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
     // 构造函数
-    MyList() : m_size(0) { init_sentinel(); }
+    MyList() noexcept : m_size(0) { reset_root(); }
     explicit MyList(size_type count) : m_size(count) {
-        init_sentinel();
-        Node* p = m_head;
+        reset_root();
+        NodeBase* p = &m_root;
         for(size_type i = 0; i < count; ++i) {
-            link(p, create_node(T()));
+            link(p, create_node());
             p = p->next;
         }
     }
     MyList(size_type count, const_reference value) : m_size(count) {
-        init_sentinel();
-        Node* p = m_head;
+        reset_root();
+        NodeBase* p = &m_root;
         for(size_type i = 0; i < count; ++i) {
             link(p, create_node(value));
             p = p->next;
         }
     }
     MyList(std::initializer_list<T> init) : m_size(init.size()) {
-        init_sentinel();
-        Node* p = m_head;
+        reset_root();
+        NodeBase* p = &m_root;
         for(const_reference val : init) {
             link(p, create_node(val));
             p = p->next;
         }
     }
     MyList(const MyList& o) : m_size(o.m_size) {
-        init_sentinel();
-        Node* p = m_head;
+        reset_root();
+        NodeBase* p = &m_root;
         for(const_iterator it = o.cbegin(); it != o.cend(); ++it) {
             link(p, create_node(*it));
             p = p->next;
         }
     }
-    MyList(MyList&& o) noexcept : m_head(o.m_head), m_tail(o.m_tail), m_size(o.m_size) {
-        o.m_head = nullptr;
-        o.m_tail = nullptr;
-        o.m_size = 0;
+    // 被移动的链表成为可继续使用的空链表
+    MyList(MyList&& o) noexcept : m_size(0) {
+        reset_root();
+        take_links(o);
     }
     // 析构函数
-    ~MyList() {
-        clear();
-        m_alloc.deallocate(m_head, 1);
-        m_alloc.deallocate(m_tail, 1);
-    }
+    ~MyList() { clear(); }
 
     // 赋值运算符
     MyList& operator=(const MyList& o) {
         if(this != &o) {
             clear();
-            Node* p = m_head;
+            NodeBase* p = &m_root;
             for(const_iterator it = o.cbegin(); it != o.cend(); ++it) {
                 link(p, create_node(*it));
                 p = p->next;
@@ -85,23 +337,16 @@ public:
         }
         return *this;
     }
-    MyList& operator=(MyList&& o) noexcept{
+    MyList& operator=(MyList&& o) noexcept {
         if(this != &o) {
             clear();
-            m_alloc.deallocate(m_head, 1);
-            m_alloc.deallocate(m_tail, 1);
-            m_head = o.m_head;
-            m_tail = o.m_tail;
-            m_size = o.m_size;
-            o.m_head = nullptr;
-            o.m_tail = nullptr;
-            o.m_size = 0;
+            take_links(o);
         }
         return *this;
     }
     MyList& operator=(std::initializer_list<T> init) {
         clear();
-        Node* p = m_head;
+        NodeBase* p = &m_root;
         for(const_reference val : init) {
             link(p, create_node(val));
             p = p->next;
@@ -114,112 +359,124 @@ public:
     size_type size() const noexcept { return m_size; }
     bool empty() const noexcept { return m_size == 0; }
 
+    // 节点池
+    // 同一线程中节点大小相同的链表共用节点池，删除的节点回到当前线程的空闲链表供 create_node 复用，
+    // 以下三个函数作用于当前线程的节点池
+    size_type node_capacity() const noexcept { return node_pool::capacity(); }
+    void reserve_nodes(size_type count) { node_pool::reserve(count); }
+    // 释放所有节点均空闲的 slab
+    void shrink_nodes() { node_pool::trim(); }
+
     // 元素访问
     reference front() {
         if(empty()) {
             throw std::out_of_range("MyList::front");
         }
-        return m_head->next->data;
+        return value_of(m_root.next);
     }
     const_reference front() const {
         if(empty()) {
             throw std::out_of_range("MyList::front");
         }
-        return m_head->next->data;
+        return value_of(m_root.next);
     }
     reference back() {
         if(empty()) {
             throw std::out_of_range("MyList::back");
         }
-        return m_tail->prev->data;
+        return value_of(m_root.prev);
     }
     const_reference back() const {
         if(empty()) {
             throw std::out_of_range("MyList::back");
         }
-        return m_tail->prev->data;
+        return value_of(m_root.prev);
     }
 
     // 修改器
     void push_front(const_reference val) {
-        link(m_head, create_node(val));
+        link(&m_root, create_node(val));
         ++m_size;
     }
     void push_front(T&& val) {
-        link(m_head, create_node(std::move(val)));
+        link(&m_root, create_node(std::move(val)));
         ++m_size;
     }
     void pop_front() {
         if(empty()) {
             throw std::out_of_range("MyList::pop_front");
         }
-        Node* p = m_head->next;
+        NodeBase* p = m_root.next;
         unlink(p);
-        m_alloc.destroy(p);
-        m_alloc.deallocate(p, 1);
+        destroy_node(p);
         --m_size;
     }
     void push_back(const_reference val) {
-        link(m_tail->prev, create_node(val));
+        link(m_root.prev, create_node(val));
         ++m_size;
     }
     void push_back(T&& val) {
-        link(m_tail->prev, create_node(std::move(val)));
+        link(m_root.prev, create_node(std::move(val)));
+        ++m_size;
+    }
+    template <typename... Args>
+    reference emplace_front(Args&&... args) {
+        link(&m_root, create_node(std::forward<Args>(args)...));
         ++m_size;
+        return value_of(m_root.next);
+    }
+    template <typename... Args>
+    reference emplace_back(Args&&... args) {
+        link(m_root.prev, create_node(std::forward<Args>(args)...));
+        ++m_size;
+        return value_of(m_root.prev);
     }
     void pop_back() {
         if(empty()) {
             throw std::out_of_range("MyList::pop_back");
         }
-        Node* p = m_tail->prev;
+        NodeBase* p = m_root.prev;
         unlink(p);
-        m_alloc.destroy(p);
-        m_alloc.deallocate(p, 1);
+        destroy_node(p);
         --m_size;
     }
     iterator insert(const_iterator pos, const_reference val) {
-        Node* p = pos.m_node;
+        NodeBase* p = pos.m_node;
         link(p->prev, create_node(val));
         ++m_size;
         return iterator(p->prev);
     }
     iterator insert(const_iterator pos, T&& val) {
-        Node* p = pos.m_node;
+        NodeBase* p = pos.m_node;
         link(p->prev, create_node(std::move(val)));
         ++m_size;
         return iterator(p->prev);
     }
+    // 批量插入返回首个新元素，未插入时返回 pos
     iterator insert(const_iterator pos, size_type count, const_reference val) {
-        Node* p = pos.m_node;
-        for(size_type i = 0; i < count; ++i) {
-            link(p->prev, create_node(val));
-            ++m_size;
-        }
-        return iterator(p->prev);
+        return insert_chain(pos.m_node, [&](auto& append) {
+            for(size_type i = 0; i < count; ++i) {
+                append(create_node(val));
+            }
+        });
     }
     template <
         typename InputIt,
         typename = std::enable_if_t<std::is_same_v<T, typename std::iterator_traits<InputIt>::value_type>>
     >
     iterator insert(const_iterator pos, InputIt first, InputIt last) {
-        Node* p = pos.m_node;
-        for(; first != last; ++first) {
-            link(p->prev, create_node(*first));
-            ++m_size;
-        }
-        return iterator(p->prev);
+        return insert_chain(pos.m_node, [&](auto& append) {
+            for(; first != last; ++first) {
+                append(create_node(*first));
+            }
+        });
     }
     iterator insert(const_iterator pos, std::initializer_list<T> init) {
-        Node* p = pos.m_node;
-        for(const_reference val : init) {
-            link(p->prev, create_node(val));
-            ++m_size;
-        }
-        return iterator(p->prev);
+        return insert(pos, init.begin(), init.end());
     }
     template <typename... Args>
     iterator emplace(const_iterator pos, Args&&... args) {
-        Node* p = pos.m_node;
+        NodeBase* p = pos.m_node;
         link(p->prev, create_node(std::forward<Args>(args)...));
         ++m_size;
         return iterator(p->prev);
@@ -229,57 +486,60 @@ public:
         if(pos == cend()) {
             throw std::out_of_range("MyList::erase");
         }
-        Node* p = pos.m_node;
+        NodeBase* p = pos.m_node;
+        NodeBase* next = p->next;
         unlink(p);
-        m_alloc.destroy(p);
-        m_alloc.deallocate(p, 1);
+        destroy_node(p);
         --m_size;
-        return iterator(p->next);
+        return iterator(next);
     }
+    // 整段摘下后成批销毁
     iterator erase(const_iterator first, const_iterator last) {
-        for(;first != last; first = erase(first));
+        if(first != last) {
+            NodeBase* f = first.m_node;
+            NodeBase* l = last.m_node->prev;
+            unlink_range(f, l);
+            l->next = nullptr;
+            m_size -= destroy_chain(f);
+        }
         return iterator(last.m_node);
     }
     void clear() {
-        if(!m_head || !m_tail) {
+        if(empty()) {
             return;
         }
-        for(Node* p = m_head->next; p != m_tail;) {
-            Node* q = p;
-            p = p->next;
-            m_alloc.destroy(q);
-            m_alloc.deallocate(q, 1);
-        }
-        m_head->next = m_tail;
-        m_tail->prev = m_head;
+        NodeBase* chain = m_root.next;
+        m_root.prev->next = nullptr;
+        reset_root();
         m_size = 0;
+        destroy_chain(chain);
     }
     void resize(size_type count) {
         if(count < m_size) {
-            iterator it = begin();
-            std::advance(it, count);
-            erase(it, end());
+            erase(position_from_ends(count), cend());
         } else if(count > m_size) {
-            insert(end(), count - m_size, T());
+            insert_chain(&m_root, [&](auto& append) {
+                for(size_type i = m_size; i < count; ++i) {
+                    append(create_node());
+                }
+            });
         }
     }
     void resize(size_type count, const_reference val) {
         if(count < m_size) {
-            iterator it = begin();
-            std::advance(it, count);
-            erase(it, end());
+            erase(position_from_ends(count), cend());
         } else if(count > m_size) {
-            insert(end(), count - m_size, val);
+            insert(cend(), count - m_size, val);
         }
     }
 
     // 迭代器
-    iterator begin() noexcept { return iterator(m_head->next); }
-    const_iterator begin() const noexcept { return const_iterator(m_head->next); }
-    iterator end() noexcept { return iterator(m_tail); }
-    const_iterator end() const noexcept { return const_iterator(m_tail); }
-    const_iterator cbegin() const noexcept { return const_iterator(m_head->next); }
-    const_iterator cend() const noexcept { return const_iterator(m_tail); }
+    iterator begin() noexcept { return iterator(m_root.next); }
+    const_iterator begin() const noexcept { return const_iterator(m_root.next); }
+    iterator end() noexcept { return iterator(&m_root); }
+    const_iterator end() const noexcept { return const_iterator(root()); }
+    const_iterator cbegin() const noexcept { return const_iterator(m_root.next); }
+    const_iterator cend() const noexcept { return const_iterator(root()); }
     reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
     const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
     reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
@@ -289,57 +549,462 @@ public:
 
     // 交换
     void swap(MyList& o) noexcept {
-        using std::swap;
-        swap(m_head, o.m_head);
-        swap(m_tail, o.m_tail);
-        swap(m_size, o.m_size);
+        MyList tmp(std::move(o));
+        o.take_links(*this);
+        take_links(tmp);
+    }
+
+    // 批量遍历
+    // 游标领先 distance 个节点并预取其所在缓存行，使访存与 fn 的计算重叠
+    template <typename Func>
+    void for_each_prefetched(Func fn, size_type distance = 8) {
+        walk_prefetched(&m_root, distance, [&fn](NodeBase* p) { fn(value_of(p)); });
+    }
+    template <typename Func>
+    void for_each_prefetched(Func fn, size_type distance = 8) const {
+        walk_prefetched(root(), distance, [&fn](NodeBase* p) { fn(static_cast<const_reference>(value_of(p))); });
+    }
+    // 将元素（U 为 T）或元素指针（U 为 T* / const T*）按批收集到连续的 scratch 中，
+    // 每满 batch_size 个调用一次 fn(scratch.data(), count)，便于 SIMD 批处理
+    template <typename U, typename Func>
+    void visit_batches(Func fn, MyVector<U>& scratch, size_type batch_size = 64, size_type distance = 8) {
+        gather_batches(root(), fn, scratch, batch_size, distance);
+    }
+    template <typename U, typename Func>
+    void visit_batches(Func fn, MyVector<U>& scratch, size_type batch_size = 64, size_type distance = 8) const {
+        static_assert(!std::is_same_v<U, pointer>, "MyList::visit_batches: const list cannot gather T*");
+        gather_batches(root(), fn, scratch, batch_size, distance);
+    }
+
+    // 链表操作：仅重新链接节点，不分配内存也不拷贝元素
+    void splice(const_iterator pos, MyList& o) {
+        if(this == &o || o.empty()) {
+            return;
+        }
+        NodeBase* first = o.m_root.next;
+        NodeBase* last = o.m_root.prev;
+        unlink_range(first, last);
+        link_range(pos.m_node->prev, first, last);
+        m_size += o.m_size;
+        o.m_size = 0;
+    }
+    void splice(const_iterator pos, MyList&& o) { splice(pos, o); }
+    void splice(const_iterator pos, MyList& o, const_iterator it) {
+        NodeBase* p = pos.m_node;
+        NodeBase* node = it.m_node;
+        if(p == node || p == node->next) {
+            return;
+        }
+        unlink(node);
+        link(p->prev, node);
+        if(this != &o) {
+            ++m_size;
+            --o.m_size;
+        }
+    }
+    void splice(const_iterator pos, MyList&& o, const_iterator it) { splice(pos, o, it); }
+    // 跨链表时需 O(n) 统计区间长度以维护 size，链接本身为 O(1)
+    void splice(const_iterator pos, MyList& o, const_iterator first, const_iterator last) {
+        if(first == last) {
+            return;
+        }
+        if(this != &o) {
+            size_type count = static_cast<size_type>(std::distance(first, last));
+            m_size += count;
+            o.m_size -= count;
+        }
+        NodeBase* f = first.m_node;
+        NodeBase* l = last.m_node->prev;
+        unlink_range(f, l);
+        link_range(pos.m_node->prev, f, l);
+    }
+    void splice(const_iterator pos, MyList&& o, const_iterator first, const_iterator last) {
+        splice(pos, o, first, last);
+    }
+
+    void merge(MyList& o) { merge(o, std::less<>()); }
+    void merge(MyList&& o) { merge(o, std::less<>()); }
+    template <typename Compare>
+    void merge(MyList& o, Compare comp) {
+        if(this == &o) {
+            return;
+        }
+        NodeBase* a = m_root.next;
+        NodeBase* b = o.m_root.next;
+        while(a != &m_root && b != &o.m_root) {
+            if(!comp(value_of(b), value_of(a))) {
+                a = a->next;
+                continue;
+            }
+            // 将 o 中连续小于 *a 的一段整体移入
+            size_type count = 1;
+            NodeBase* run_end = b->next;
+            while(run_end != &o.m_root && comp(value_of(run_end), value_of(a))) {
+                run_end = run_end->next;
+                ++count;
+            }
+            NodeBase* last = run_end->prev;
+            unlink_range(b, last);
+            link_range(a->prev, b, last);
+            m_size += count;
+            o.m_size -= count;
+            b = run_end;
+        }
+        splice(cend(), o);
+    }
+    template <typename Compare>
+    void merge(MyList&& o, Compare comp) { merge(o, comp); }
+
+    // 自底向上归并排序，稳定，额外空间 O(1)
+    void sort() { sort(std::less<>()); }
+    template <typename Compare>
+    void sort(Compare comp) {
+        if(m_size < 2) {
+            return;
+        }
+        // bins[i] 为长度 2^i 的有序单链表，下标越大元素越靠前
+        NodeBase* bins[64] = {};
+        NodeBase* carry = nullptr;
+        NodeBase* rest = m_root.next;
+        m_root.prev->next = nullptr;
+        try {
+            while(rest) {
+                carry = rest;
+                rest = rest->next;
+                carry->next = nullptr;
+                size_type i = 0;
+                for(; bins[i]; ++i) {
+                    NodeBase* later = carry;
+                    carry = nullptr;
+                    merge_chains(bins[i], later, comp);
+                    carry = bins[i];
+                    bins[i] = nullptr;
+                }
+                bins[i] = carry;
+                carry = nullptr;
+            }
+            for(size_type i = 1; i < 64; ++i) {
+                NodeBase* later = bins[i - 1];
+                bins[i - 1] = nullptr;
+                merge_chains(bins[i], later, comp);
+            }
+        } catch(...) {
+            // comp 抛出异常时保留所有节点，顺序未定义
+            NodeBase* p = &m_root;
+            append_chain(p, carry);
+            for(NodeBase* chain : bins) {
+                append_chain(p, chain);
+            }
+            append_chain(p, rest);
+            p->next = &m_root;
+            m_root.prev = p;
+            throw;
+        }
+        NodeBase* p = &m_root;
+        append_chain(p, bins[63]);
+        p->next = &m_root;
+        m_root.prev = p;
+    }
+
+    void reverse() noexcept {
+        if(m_size < 2) {
+            return;
+        }
+        NodeBase* first = m_root.next;
+        NodeBase* last = m_root.prev;
+        for(NodeBase* p = first; p != &m_root;) {
+            NodeBase* next = p->next;
+            std::swap(p->prev, p->next);
+            p = next;
+        }
+        m_root.next = last;
+        last->prev = &m_root;
+        m_root.prev = first;
+        first->next = &m_root;
+    }
+
+    // 先摘下所有待删除节点再统一销毁，value 可以引用链表中的元素
+    size_type remove(const_reference value) {
+        return remove_if([&value](const_reference x) { return x == value; });
+    }
+    template <typename UnaryPredicate>
+    size_type remove_if(UnaryPredicate pred) {
+        NodeBase* removed = nullptr;
+        NodeBase** tail = &removed;
+        size_type count = 0;
+        try {
+            for(NodeBase* p = m_root.next; p != &m_root;) {
+                NodeBase* next = p->next;
+                if(pred(value_of(p))) {
+                    unlink(p);
+                    *tail = p;
+                    tail = &p->next;
+                    ++count;
+                }
+                p = next;
+            }
+        } catch(...) {
+            *tail = nullptr;
+            m_size -= count;
+            destroy_chain(removed);
+            throw;
+        }
+        *tail = nullptr;
+        m_size -= count;
+        destroy_chain(removed);
+        return count;
+    }
+    size_type unique() { return unique(std::equal_to<>()); }
+    template <typename BinaryPredicate>
+    size_type unique(BinaryPredicate pred) {
+        NodeBase* removed = nullptr;
+        NodeBase** tail = &removed;
+        size_type count = 0;
+        try {
+            for(NodeBase* p = m_root.next; p != &m_root && p->next != &m_root;) {
+                NodeBase* q = p->next;
+                if(pred(value_of(p), value_of(q))) {
+                    unlink(q);
+                    *tail = q;
+                    tail = &q->next;
+                    ++count;
+                } else {
+                    p = q;
+                }
+            }
+        } catch(...) {
+            *tail = nullptr;
+            m_size -= count;
+            destroy_chain(removed);
+            throw;
+        }
+        *tail = nullptr;
+        m_size -= count;
+        destroy_chain(removed);
+        return count;
     }
 
 private:
-    struct Node {
+    // 哨兵只包含链接，不含 T
+    struct NodeBase {
+        NodeBase* prev;
+        NodeBase* next;
+    };
+    struct Node : NodeBase {
         T data;
-        Node* prev;
-        Node* next;
-
-        Node(const_reference val = T(), Node* p = nullptr, Node* n = nullptr)
-            : data(val), prev(p), next(n) {}
-        
-        Node(T&& val, Node* p = nullptr, Node* n = nullptr)
-            : data(std::move(val)), prev(p), next(n) {}
+
+        // 直接在节点内构造 T，不经过临时对象
+        template <typename... Args>
+        explicit Node(std::in_place_t, Args&&... args) : data(std::forward<Args>(args)...) {}
     };
+    using node_traits = std::allocator_traits<std::allocator<Node>>;
+
+    using node_pool = my_list_detail::NodePool<sizeof(Node), alignof(Node)>;
 
-    Node* m_head;
-    Node* m_tail;
+    NodeBase m_root;    // 环形链表的哨兵，m_root.next 为首元素，m_root.prev 为尾元素
     size_type m_size;
     std::allocator<Node> m_alloc;
 
     // 辅助函数
-    void init_sentinel() {
-        m_head = m_alloc.allocate(1);
-        m_tail = m_alloc.allocate(1);
-        m_head->next = m_tail;
-        m_tail->prev = m_head;
-    }
-    Node* create_node(const_reference val, Node* p = nullptr, Node* n = nullptr) {
-        Node* new_node = m_alloc.allocate(1);
-        m_alloc.construct(new_node, val, p, n);
-        return new_node;
+    NodeBase* root() const noexcept { return const_cast<NodeBase*>(&m_root); }
+    void reset_root() noexcept {
+        m_root.prev = &m_root;
+        m_root.next = &m_root;
+    }
+    // 接管 o 的全部节点，o 变为空链表；调用前本链表必须为空
+    void take_links(MyList& o) noexcept {
+        if(o.m_root.next != &o.m_root) {
+            m_root = o.m_root;
+            m_root.next->prev = &m_root;
+            m_root.prev->next = &m_root;
+        }
+        m_size = o.m_size;
+        o.reset_root();
+        o.m_size = 0;
     }
-    Node* create_node(T&& val, Node* p = nullptr, Node* n = nullptr) {
-        Node* new_node = m_alloc.allocate(1);
-        m_alloc.construct(new_node, std::move(val), p, n);
+    static reference value_of(NodeBase* node) noexcept { return static_cast<Node*>(node)->data; }
+    template <typename... Args>
+    Node* create_node(Args&&... args) {
+        Node* new_node = static_cast<Node*>(node_pool::acquire());
+        try {
+            node_traits::construct(m_alloc, new_node, std::in_place, std::forward<Args>(args)...);
+        } catch(...) {
+            node_pool::release(new_node);
+            throw;
+        }
         return new_node;
     }
-    void link(Node* p, Node* node) {
+    void destroy_node(NodeBase* node) {
+        Node* p = static_cast<Node*>(node);
+        node_traits::destroy(m_alloc, p);
+        node_pool::release(p);
+    }
+    void link(NodeBase* p, NodeBase* node) {
         node->next = p->next;
         node->prev = p;
         p->next->prev = node;
         p->next = node;
     }
-    void unlink(Node* node) {
+    void unlink(NodeBase* node) {
         node->prev->next = node -> next;
         node->next->prev = node -> prev;
     }
+    // [first, last] 闭区间版本的 link / unlink
+    void link_range(NodeBase* p, NodeBase* first, NodeBase* last) {
+        last->next = p->next;
+        first->prev = p;
+        p->next->prev = last;
+        p->next = first;
+    }
+    void unlink_range(NodeBase* first, NodeBase* last) {
+        first->prev->next = last->next;
+        last->next->prev = first->prev;
+    }
+    // 以 nullptr 结尾的单链表辅助函数，供批量插入删除及 sort / remove_if / unique 使用
+    // 销毁整条链并返回节点数
+    size_type destroy_chain(NodeBase* chain) noexcept {
+        size_type count = 0;
+        while(chain) {
+            NodeBase* next = chain->next;
+            destroy_node(chain);
+            chain = next;
+            ++count;
+        }
+        return count;
+    }
+    // 在链表外构造一条新节点链，全部成功后一次接入 pos 之前；
+    // fill 通过 append 逐个追加节点，抛出异常时销毁已构造的节点，链表不变
+    template <typename Fill>
+    iterator insert_chain(NodeBase* pos, Fill fill) {
+        NodeBase head{nullptr, nullptr};
+        NodeBase* tail = &head;
+        size_type count = 0;
+        auto append = [&tail, &count](Node* node) {
+            tail->next = node;
+            node->prev = tail;
+            tail = node;
+            ++count;
+        };
+        try {
+            fill(append);
+        } catch(...) {
+            tail->next = nullptr;
+            destroy_chain(head.next);
+            throw;
+        }
+        if(count == 0) {
+            return iterator(pos);
+        }
+        NodeBase* first = head.next;
+        link_range(pos->prev, first, tail);
+        m_size += count;
+        return iterator(first);
+    }
+    // 只预取链接所在的缓存行与数据的第一行，大对象的其余部分留给 fn 按需读取
+    static void prefetch_node(const NodeBase* node) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(node);
+        __builtin_prefetch(&static_cast<const Node*>(node)->data);
+#else
+        (void)node;
+#endif
+    }
+    // 游标每步先沿上一步已预取的节点前进，再预取新位置，
+    // 预取与解引用之间隔着一次 visit，不会对刚预取的节点立即发起读取
+    template <typename Visit>
+    static void walk_prefetched(NodeBase* root, size_type distance, Visit visit) {
+        NodeBase* ahead = root->next;
+        for(size_type i = 0; i < distance && ahead != root; ++i) {
+            ahead = ahead->next;
+        }
+        if(ahead != root) {
+            prefetch_node(ahead);
+        }
+        for(NodeBase* p = root->next; p != root;) {
+            if(ahead != root) {
+                ahead = ahead->next;
+                if(ahead != root) {
+                    prefetch_node(ahead);
+                }
+            }
+            NodeBase* next = p->next;
+            visit(p);
+            p = next;
+        }
+    }
+    template <typename U, typename Func>
+    static void gather_batches(NodeBase* root, Func& fn, MyVector<U>& scratch, size_type batch_size, size_type distance) {
+        static_assert(std::is_same_v<U, T> || std::is_same_v<U, pointer> || std::is_same_v<U, const_pointer>,
+                      "MyList::visit_batches: scratch must hold T, T* or const T*");
+        if(batch_size == 0) {
+            throw std::invalid_argument("MyList::visit_batches");
+        }
+        scratch.clear();
+        scratch.reserve(batch_size);
+        walk_prefetched(root, distance, [&](NodeBase* p) {
+            if constexpr(std::is_same_v<U, T>) {
+                scratch.push_back(value_of(p));
+            } else {
+                scratch.push_back(&value_of(p));
+            }
+            if(scratch.size() == batch_size) {
+                fn(scratch.data(), scratch.size());
+                scratch.clear();
+            }
+        });
+        if(!scratch.empty()) {
+            fn(scratch.data(), scratch.size());
+            scratch.clear();
+        }
+    }
+    // 第 index 个位置的迭代器，从较近的一端开始走
+    const_iterator position_from_ends(size_type index) const {
+        const_iterator it;
+        if(index <= m_size / 2) {
+            it = cbegin();
+            std::advance(it, index);
+        } else {
+            it = cend();
+            std::advance(it, -static_cast<difference_type>(m_size - index));
+        }
+        return it;
+    }
+    static void append_chain(NodeBase*& p, NodeBase* chain) {
+        for(; chain; chain = chain->next) {
+            p->next = chain;
+            chain->prev = p;
+            p = chain;
+        }
+    }
+    // 将 later 稳定归并进 a；comp 抛出异常时 a 仍持有全部节点
+    template <typename Compare>
+    static void merge_chains(NodeBase*& a, NodeBase* later, Compare& comp) {
+        NodeBase* first = a;
+        NodeBase* head = nullptr;
+        NodeBase** tail = &head;
+        try {
+            while(first && later) {
+                if(comp(value_of(later), value_of(first))) {
+                    *tail = later;
+                    later = later->next;
+                } else {
+                    *tail = first;
+                    first = first->next;
+                }
+                tail = &(*tail)->next;
+            }
+        } catch(...) {
+            *tail = first;
+            while(*tail) {
+                tail = &(*tail)->next;
+            }
+            *tail = later;
+            a = head;
+            throw;
+        }
+        *tail = first ? first : later;
+        a = head;
+    }
 };
 template <typename T>
 class MyList<T>::iterator {
@@ -352,15 +1017,15 @@ public:
     using iterator_category = std::bidirectional_iterator_tag;
 
     iterator() : m_node(nullptr) {}
-    explicit iterator(Node* node) : m_node(node) {}
+    explicit iterator(NodeBase* node) : m_node(node) {}
     iterator(const iterator& o) : m_node(o.m_node) {}
 
     iterator& operator=(const iterator& o) {
         m_node = o.m_node;
         return *this;
     }
-    reference operator*() const { return m_node->data; }
-    pointer operator->() const { return &m_node->data; }
+    reference operator*() const { return value_of(m_node); }
+    pointer operator->() const { return &value_of(m_node); }
     iterator& operator++() {
         m_node = m_node->next;
         return *this;
@@ -382,7 +1047,7 @@ public:
     bool operator==(const iterator& o) const { return m_node == o.m_node; }
     bool operator!=(const iterator& o) const { return m_node != o.m_node; }
 private:
-    Node* m_node;
+    NodeBase* m_node;
 };
 
 template <typename T>
@@ -396,7 +1061,7 @@ public:
     using iterator_category = std::bidirectional_iterator_tag;
 
     const_iterator() : m_node(nullptr) {}
-    explicit const_iterator(Node* node) : m_node(node) {}
+    explicit const_iterator(NodeBase* node) : m_node(node) {}
     const_iterator(const const_iterator& o) : m_node(o.m_node) {}
     const_iterator(const iterator& o) : m_node(o.m_node) {}
 
@@ -404,8 +1069,8 @@ public:
         m_node = o.m_node;
         return *this;
     }
-    reference operator*() const { return m_node->data; }
-    pointer operator->() const { return &m_node->data; }
+    reference operator*() const { return value_of(m_node); }
+    pointer operator->() const { return &value_of(m_node); }
     const_iterator& operator++() {
         m_node = m_node->next;
         return *this;
@@ -427,6 +1092,6 @@ public:
     bool operator==(const const_iterator& o) const { return m_node == o.m_node; }
     bool operator!=(const const_iterator& o) const { return m_node != o.m_node; }
 private:
-    Node* m_node;
+    NodeBase* m_node;
 };
 #endif // MY_LIST_H
\ No newline at end of file
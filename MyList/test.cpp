@@ -1,6 +1,9 @@
 #include "my_list.h"
 #include <iostream>
 #include <cassert>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 // 辅助函数，用于输出 MyList 的内容
 template <typename T>
@@ -20,6 +23,23 @@ void printMyList(const MyList<T>& lst, const std::string& message = "") {
     std::cout << "]" << std::endl;
 }
 
+// 没有默认构造函数，且统计拷贝与移动次数
+struct Heavy {
+    static int copies;
+    int a;
+    std::string b;
+    Heavy(int x, const char* y) : a(x), b(y) {}
+    Heavy(const Heavy& o) : a(o.a), b(o.b) { ++copies; }
+    Heavy(Heavy&& o) noexcept : a(o.a), b(std::move(o.b)) { ++copies; }
+};
+int Heavy::copies = 0;
+
+struct Pinned {
+    int v;
+    explicit Pinned(int x) : v(x) {}
+    Pinned(const Pinned&) = delete;
+};
+
 int main() {
     // 1) 默认构造函数测试
     std::cout << "===== 1) Default constructor test =====" << std::endl;
@@ -324,6 +344,398 @@ int main() {
         std::cout << "swap test passed.\n" << std::endl;
     }
 
+    // 19) 节点池测试
+    std::cout << "===== 19) node pool test =====" << std::endl;
+    {
+        // 节点池由本线程所有 MyList<int> 共用，base 为其他链表仍在使用的 slab
+        MyList<int> listR;
+        listR.shrink_nodes();
+        size_t base = listR.node_capacity();
+        listR.reserve_nodes(100);
+        size_t cap = listR.node_capacity();
+        assert(cap >= 100);
+        for (int i = 0; i < 100; ++i) {
+            listR.push_back(i);
+        }
+        // 预留的节点足够，不应再分配新的 slab
+        assert(listR.node_capacity() == cap);
+
+        // 删除后再插入会复用空闲节点
+        for (int round = 0; round < 10; ++round) {
+            for (int i = 0; i < 50; ++i) {
+                listR.pop_front();
+            }
+            for (int i = 0; i < 50; ++i) {
+                listR.push_back(i);
+            }
+        }
+        assert(listR.size() == 100);
+        assert(listR.node_capacity() == cap);
+
+        listR.clear();
+        listR.shrink_nodes();
+        assert(listR.node_capacity() == base);
+        listR.push_back(1);
+        assert(listR.front() == 1);
+        std::cout << "node pool test passed.\n" << std::endl;
+    }
+
+    // 20) splice 测试
+    std::cout << "===== 20) splice test =====" << std::endl;
+    {
+        MyList<int> listS = {1, 2, 3};
+        {
+            MyList<int> listT = {10, 20, 30, 40};
+            auto it = listT.begin();
+            ++it;  // 20
+            listS.splice(listS.end(), listT, it);
+            assert(listS.size() == 4 && listT.size() == 3);
+            assert(listS.back() == 20);
+            // 迭代器在 splice 后仍然有效
+            assert(*it == 20);
+
+            auto first = listT.begin();
+            auto last = listT.end();
+            --last;  // [10, 30)
+            listS.splice(listS.begin(), listT, first, last);
+            printMyList(listS, "listS after splicing from listT");
+            assert(listS.size() == 6 && listT.size() == 1);
+            assert(listS.front() == 10);
+
+            listS.splice(listS.begin(), listT);
+            assert(listS.size() == 7 && listT.empty());
+            assert(listS.front() == 40);
+        }
+        // listT 已析构，来自它的节点仍可正常删除
+        printMyList(listS, "listS after listT destroyed");
+        listS.erase(listS.begin());
+        listS.clear();
+        assert(listS.empty());
+
+        // 同一链表内移动
+        MyList<int> listU = {1, 2, 3, 4};
+        listU.splice(listU.begin(), listU, --listU.end());
+        assert(listU.front() == 4 && listU.back() == 3 && listU.size() == 4);
+        std::cout << "splice test passed.\n" << std::endl;
+    }
+
+    // 21) merge / sort 测试
+    std::cout << "===== 21) merge and sort test =====" << std::endl;
+    {
+        MyList<int> listV = {1, 4, 6, 9};
+        MyList<int> listW = {0, 2, 3, 7, 10, 11};
+        listV.merge(listW);
+        printMyList(listV, "listV after merge");
+        assert(listV.size() == 10 && listW.empty());
+        int expect[] = {0, 1, 2, 3, 4, 6, 7, 9, 10, 11};
+        int k = 0;
+        for (int x : listV) {
+            assert(x == expect[k++]);
+        }
+
+        MyList<int> listX = {5, 3, 9, 1, 5, 8, 2, 7, 0, 6, 4};
+        auto five = listX.begin();
+        listX.sort();
+        printMyList(listX, "listX after sort");
+        assert(*five == 5);
+        int prev = -1;
+        for (int x : listX) {
+            assert(prev <= x);
+            prev = x;
+        }
+        // 反向遍历验证 prev 指针
+        int back = 9;
+        for (auto rit = listX.rbegin(); rit != listX.rend() && back >= 5; ++rit) {
+            assert(*rit == back--);
+        }
+
+        // 稳定性：按十位排序，个位保持原顺序
+        MyList<int> listY = {31, 12, 33, 11, 32, 13};
+        listY.sort([](int a, int b) { return a / 10 < b / 10; });
+        int stable[] = {12, 11, 13, 31, 33, 32};
+        k = 0;
+        for (int x : listY) {
+            assert(x == stable[k++]);
+        }
+        std::cout << "merge and sort test passed.\n" << std::endl;
+    }
+
+    // 22) reverse / remove / remove_if / unique 测试
+    std::cout << "===== 22) reverse, remove and unique test =====" << std::endl;
+    {
+        MyList<int> listZ = {1, 2, 3, 4, 5};
+        listZ.reverse();
+        printMyList(listZ, "listZ after reverse");
+        assert(listZ.front() == 5 && listZ.back() == 1);
+        assert(*listZ.rbegin() == 1);
+
+        assert(listZ.remove_if([](int x) { return x % 2 == 0; }) == 2);
+        printMyList(listZ, "listZ after remove_if(even)");
+        assert(listZ.size() == 3);
+
+        // value 引用链表中的元素
+        MyList<int> listA2 = {7, 1, 7, 2, 7};
+        assert(listA2.remove(listA2.front()) == 3);
+        assert(listA2.size() == 2 && listA2.front() == 1);
+
+        MyList<int> listB2 = {1, 1, 2, 2, 2, 3, 1, 1};
+        assert(listB2.unique() == 4);
+        printMyList(listB2, "listB2 after unique");
+        assert(listB2.size() == 4);
+        std::cout << "reverse, remove and unique test passed.\n" << std::endl;
+    }
+
+    // 23) 空链表与移动后的源链表测试
+    std::cout << "===== 23) empty list and moved-from reuse test =====" << std::endl;
+    {
+        // 空链表不分配任何节点
+        size_t cap = MyList<int>().node_capacity();
+        MyList<int> listC2;
+        assert(listC2.node_capacity() == cap);
+        assert(listC2.begin() == listC2.end());
+
+        MyList<int> listD2 = {1, 2, 3};
+        MyList<int> listE2(std::move(listD2));
+        assert(listE2.size() == 3 && listE2.back() == 3);
+        // 被移动的链表仍然可用
+        assert(listD2.empty() && listD2.begin() == listD2.end());
+        listD2.push_back(4);
+        listD2.push_front(5);
+        assert(listD2.size() == 2 && listD2.front() == 5 && listD2.back() == 4);
+
+        listD2 = std::move(listE2);
+        assert(listD2.size() == 3 && listE2.empty());
+        listE2.push_back(6);
+        listD2.swap(listE2);
+        assert(listD2.size() == 1 && listE2.size() == 3);
+        int j = 3;
+        for (auto rit = listE2.rbegin(); rit != listE2.rend(); ++rit) {
+            assert(*rit == j--);
+        }
+        std::cout << "empty list and moved-from reuse test passed.\n" << std::endl;
+    }
+
+    // 24) 原位构造测试
+    std::cout << "===== 24) in-place emplace test =====" << std::endl;
+    {
+        MyList<Heavy> listF2;
+        Heavy& h = listF2.emplace_back(1, "one");
+        assert(h.a == 1 && h.b == "one");
+        listF2.emplace_front(0, "zero");
+        listF2.emplace(++listF2.begin(), 5, "five");
+        assert(Heavy::copies == 0);
+        assert(listF2.size() == 3 && listF2.front().a == 0 && listF2.back().a == 1);
+        assert((++listF2.begin())->b == "five");
+
+        // 不可拷贝、不可移动的类型
+        MyList<Pinned> listG2;
+        listG2.emplace_back(7);
+        listG2.emplace_front(3);
+        assert(listG2.front().v == 3 && listG2.back().v == 7);
+        std::cout << "in-place emplace test passed.\n" << std::endl;
+    }
+
+    // 25) 批量插入与删除测试
+    std::cout << "===== 25) batched insert/erase test =====" << std::endl;
+    {
+        MyList<int> listH2 = {1, 5};
+        auto pos = ++listH2.begin();
+        // 返回首个插入的元素
+        auto it = listH2.insert(pos, {2, 3, 4});
+        assert(*it == 2 && listH2.size() == 5);
+        it = listH2.insert(listH2.end(), 3, 6);
+        assert(*it == 6 && listH2.back() == 6 && listH2.size() == 8);
+        it = listH2.insert(pos, 0, 9);
+        assert(it == pos);
+        printMyList(listH2, "listH2 after batched inserts");
+
+        // 删除 [2, 6) 中间区间
+        auto first = ++listH2.begin();
+        auto last = listH2.begin();
+        std::advance(last, 5);
+        it = listH2.erase(first, last);
+        assert(*it == 6 && listH2.size() == 4);
+        int rest[] = {1, 6, 6, 6};
+        int k = 0;
+        for (int x : listH2) {
+            assert(x == rest[k++]);
+        }
+
+        // 构造中途抛出异常时链表保持不变
+        struct Flaky {
+            int v;
+            explicit Flaky(int x) : v(x) {}
+            Flaky(const Flaky& o) : v(o.v) {
+                if (v < 0) {
+                    throw std::runtime_error("Flaky");
+                }
+            }
+        };
+        MyList<Flaky> listI2;
+        listI2.emplace_back(1);
+        Flaky src[] = {Flaky(2), Flaky(3), Flaky(-1)};
+        bool thrown = false;
+        try {
+            listI2.insert(listI2.end(), src, src + 3);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown && listI2.size() == 1 && listI2.back().v == 1);
+
+        // 大规模截断从尾部定位
+        MyList<int> listJ2;
+        listJ2.resize(100000, 1);
+        listJ2.resize(99990);
+        assert(listJ2.size() == 99990);
+        listJ2.resize(10);
+        assert(listJ2.size() == 10 && listJ2.back() == 1);
+        std::cout << "batched insert/erase test passed.\n" << std::endl;
+    }
+
+    // 26) 预取遍历与批量访问测试
+    std::cout << "===== 26) prefetched traversal and batch visit test =====" << std::endl;
+    {
+        MyList<int> listK2;
+        long long expect = 0;
+        for (int i = 0; i < 1000; ++i) {
+            listK2.push_back(i);
+            expect += i;
+        }
+        long long sum = 0;
+        listK2.for_each_prefetched([&sum](int x) { sum += x; }, 4);
+        assert(sum == expect);
+        listK2.for_each_prefetched([](int& x) { x *= 2; });
+        // 游标距离为 0 或超过链表长度
+        MyList<int> shortK2{1, 2, 3};
+        for (size_t d : {0, 1, 3, 5000}) {
+            int visited = 0;
+            shortK2.for_each_prefetched([&visited](int x) { visited = visited * 10 + x; }, d);
+            assert(visited == 123);
+        }
+
+        // 拷贝元素模式
+        MyVector<int> values;
+        int batches = 0;
+        sum = 0;
+        listK2.visit_batches([&](int* data, size_t n) {
+            assert(n <= 64);
+            ++batches;
+            for (size_t i = 0; i < n; ++i) {
+                sum += data[i];
+            }
+        }, values, 64);
+        assert(batches == 16 && sum == 2 * expect);
+
+        // 指针模式，可以写回元素
+        MyVector<int*> ptrs;
+        listK2.visit_batches([](int** data, size_t n) {
+            for (size_t i = 0; i < n; ++i) {
+                *data[i] = 1;
+            }
+        }, ptrs, 100);
+        const MyList<int>& clist = listK2;
+        MyVector<const int*> cptrs;
+        sum = 0;
+        clist.visit_batches([&sum](const int** data, size_t n) {
+            for (size_t i = 0; i < n; ++i) {
+                sum += *data[i];
+            }
+        }, cptrs);
+        assert(sum == 1000);
+        std::cout << "prefetched traversal and batch visit test passed.\n" << std::endl;
+    }
+
+    // 27) 小链表与跨线程 splice 测试
+    std::cout << "===== 27) small lists and cross-thread splice test =====" << std::endl;
+    {
+        // 大量单元素链表共用节点池，每个链表不再独占一个 slab
+        MyList<int> probe;
+        probe.shrink_nodes();
+        size_t before = probe.node_capacity();
+        MyVector<MyList<int>> lists(10000);
+        for (size_t i = 0; i < lists.size(); ++i) {
+            lists[i].push_back(static_cast<int>(i));
+        }
+        assert(probe.node_capacity() - before < 2 * lists.size());
+
+        // 在其他线程构造的节点 splice 进来后在本线程销毁，本线程的节点 splice 出去后在其他线程销毁
+        MyList<int> mine = {1, 2, 3};
+        MyList<int> theirs;
+        std::thread worker([&theirs, &lists] {
+            for (int i = 0; i < 1000; ++i) {
+                theirs.push_back(i);
+            }
+            MyList<int> local;
+            local.splice(local.end(), lists[0]);
+            local.splice(local.end(), lists[1]);
+            assert(local.size() == 2 && local.back() == 1);
+        });
+        worker.join();
+        assert(lists[0].empty() && lists[1].empty());
+        mine.splice(mine.end(), theirs, theirs.begin(), std::next(theirs.begin(), 500));
+        assert(mine.size() == 503 && theirs.size() == 500 && mine.back() == 499);
+        std::thread other([&theirs] {
+            theirs.clear();
+            theirs.push_back(7);
+        });
+        other.join();
+        assert(theirs.size() == 1 && theirs.front() == 7);
+        mine.clear();
+        lists.clear();
+        std::cout << "small lists and cross-thread splice test passed.\n" << std::endl;
+    }
+
+    // 28) 一个线程构造、另一个线程销毁
+    std::cout << "===== 28) producer/consumer node reuse test =====" << std::endl;
+    {
+        // 消费者销毁的节点交回孤儿池，生产者的节点池容量不随轮数增长
+        std::mutex lock;
+        std::condition_variable cv;
+        MyList<int> handoff;
+        bool ready = false;
+        bool done = false;
+        std::thread consumer([&] {
+            for (;;) {
+                MyList<int> got;
+                {
+                    std::unique_lock<std::mutex> guard(lock);
+                    cv.wait(guard, [&] { return ready || done; });
+                    if (!ready) {
+                        return;
+                    }
+                    got.swap(handoff);
+                    ready = false;
+                }
+                cv.notify_all();
+                assert(got.size() == 1000 && got.back() == 999);
+            }
+        });
+        size_t capacity = 0;
+        std::thread producer([&] {
+            for (int round = 0; round < 2000; ++round) {
+                MyList<int> batch;
+                for (int i = 0; i < 1000; ++i) {
+                    batch.push_back(i);
+                }
+                std::unique_lock<std::mutex> guard(lock);
+                cv.wait(guard, [&] { return !ready; });
+                handoff.swap(batch);
+                ready = true;
+                cv.notify_all();
+            }
+            capacity = handoff.node_capacity();
+            std::unique_lock<std::mutex> guard(lock);
+            cv.wait(guard, [&] { return !ready; });
+            done = true;
+            cv.notify_all();
+        });
+        producer.join();
+        consumer.join();
+        // 不交回时为 2000 轮 × 1000 个节点
+        assert(capacity > 0 && capacity < 50000);
+        std::cout << "producer/consumer node reuse test passed.\n" << std::endl;
+    }
+
     std::cout << "All MyList tests passed successfully!" << std::endl;
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include "my_packed_vector.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <cstdlib>
+
+std::uint64_t g_sink = 0;
+
+template <typename F>
+double timeMs(F fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+template <typename T>
+void run(const char* name, const MyVector<T>& values, std::mt19937_64& rng) {
+    MyPackedVector<T> packed(values);
+    std::size_t n = values.size();
+    MyVector<T> out(n);
+    double decodeMs = timeMs([&] {
+        packed.decode(out.data());
+        g_sink += out[n / 2];
+    });
+    double sumMs = timeMs([&] {
+        std::uint64_t s = 0;
+        for (T x : values) {
+            s += x;
+        }
+        g_sink += s;
+    });
+    std::size_t q = 1 << 22;
+    MyVector<std::size_t> idx(q);
+    for (auto& i : idx) {
+        i = rng() % n;
+    }
+    double rawGetNs = timeMs([&] {
+        for (std::size_t i : idx) {
+            g_sink += values[i];
+        }
+    }) * 1e6 / q;
+    double getNs = timeMs([&] {
+        for (std::size_t i : idx) {
+            g_sink += packed.get(i);
+        }
+    }) * 1e6 / q;
+    std::cout << std::left << std::setw(16) << name << std::right << std::fixed << std::setprecision(2)
+              << (packed.encoding() == MyPackedEncoding::delta ? " delta " : " packed")
+              << " width " << std::setw(2) << packed.bit_width()
+              << "  " << std::setw(6) << static_cast<double>(n * sizeof(T)) / packed.memory_bytes() << "x smaller"
+              << "  decode " << std::setw(6) << n * sizeof(T) / decodeMs / 1e6 << " GB/s (raw sum " << n * sizeof(T) / sumMs / 1e6 << " GB/s)"
+              << "  get " << std::setprecision(1) << getNs << " ns (raw " << rawGetNs << " ns)" << std::endl;
+}
+
+// 压缩率、批量解码吞吐与随机访问延迟，参数为元素个数
+int main(int argc, char** argv) {
+    std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : (std::size_t(1) << 26);
+    std::mt19937_64 rng(1);
+    MyVector<std::uint32_t> small(n);
+    for (auto& x : small) {
+        x = static_cast<std::uint32_t>(rng() % 1000);
+    }
+    MyVector<std::uint64_t> ids(n);
+    std::uint64_t id = 1ull << 40;
+    for (auto& x : ids) {
+        id += 1 + rng() % 64;
+        x = id;
+    }
+    MyVector<std::uint32_t> ts(n);
+    std::uint32_t t = 0;
+    for (auto& x : ts) {
+        t += static_cast<std::uint32_t>(rng() % 16);
+        x = t;
+    }
+    std::cout << "elements: " << n << std::endl;
+    run("u32 < 1000", small, rng);
+    run("u64 sorted ids", ids, rng);
+    run("u32 timestamps", ts, rng);
+    return g_sink == 1 ? 1 : 0;
+}
@@ -0,0 +1,372 @@
+#ifndef MY_PACKED_VECTOR_H
+#define MY_PACKED_VECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "../MyVector/my_vector.hpp"
+
+// 编码方式
+enum class MyPackedEncoding {
+    automatic, // 有序且差分更省空间时用 delta，否则用 packed
+    packed,    // 所有元素使用相同的位宽，位宽由最大值决定
+    delta      // 有序数据：按块存放相邻差值，每块记录基准值、最小差值、位宽与在位流中的起点，块内每 32 个元素一个检查点
+};
+
+// 压缩的无符号整数数组
+// packed：第 i 个元素位于位流的 [i * w, (i + 1) * w)，随机访问 O(1)；push_back 的值超出位宽时整体按新位宽重新打包
+// delta：每 block_size 个元素一块，块内存放相邻差值减去块内最小差值（frame of reference），位宽取块内所需的最大值；
+//        块描述（跳跃指针）直接定位到块，块内每 checkpoint_stride 个元素另存一个前缀和，
+//        get(i) 最多累加 checkpoint_stride - 1 个差值；末尾不满一块的元素不压缩
+// 批量解码 decode() 逐块解包，编译时启用 AVX2 时 32 位元素用 gather 每次解包 8 个
+template <typename T>
+class MyPackedVector {
+    static_assert(std::is_integral_v<T> && std::is_unsigned_v<T> && !std::is_same_v<T, bool>, "MyPackedVector: element must be an unsigned integer");
+
+public:
+    // 类型别名
+    using value_type = T;
+    using size_type = std::size_t;
+
+    static constexpr size_type block_size = 128;
+    static constexpr size_type checkpoint_stride = 32;
+
+    // 构造函数
+    explicit MyPackedVector(MyPackedEncoding encoding = MyPackedEncoding::packed)
+        : m_encoding(encoding == MyPackedEncoding::delta ? MyPackedEncoding::delta : MyPackedEncoding::packed) {
+        ensure_words();
+    }
+    // encoding 为 delta 时 values 必须非降序，否则抛出 std::invalid_argument
+    template <typename Allocator>
+    explicit MyPackedVector(const MyVector<T, Allocator>& values, MyPackedEncoding encoding = MyPackedEncoding::automatic) {
+        const T* data = values.data();
+        size_type n = values.size();
+        bool sorted = std::is_sorted(data, data + n);
+        if(encoding == MyPackedEncoding::delta && !sorted) {
+            throw std::invalid_argument("MyPackedVector: delta encoding requires sorted values");
+        }
+        if(encoding == MyPackedEncoding::automatic) {
+            encoding = sorted && delta_bits(data, n) < packed_bits(data, n) ? MyPackedEncoding::delta : MyPackedEncoding::packed;
+        }
+        m_encoding = encoding;
+        if(m_encoding == MyPackedEncoding::packed) {
+            m_width = width_of(n ? *std::max_element(data, data + n) : T(0));
+            m_words.resize(words_for(n * m_width) + padding_words, 0);
+            for(size_type i = 0; i < n; ++i) {
+                write(m_bits, m_width, data[i]);
+                m_bits += m_width;
+            }
+            m_size = n;
+        } else {
+            ensure_words();
+            m_blocks.reserve(n / block_size);
+            for(size_type i = 0; i < n; ++i) {
+                push_back(data[i]);
+            }
+        }
+    }
+
+    // 容量
+    size_type size() const noexcept { return m_size; }
+    bool empty() const noexcept { return m_size == 0; }
+    MyPackedEncoding encoding() const noexcept { return m_encoding; }
+    // packed 为元素位宽，delta 为各块中最大的差值位宽
+    unsigned bit_width() const noexcept { return m_width; }
+    // 占用的堆内存字节数（按容量计）
+    size_type memory_bytes() const noexcept {
+        return m_words.capacity() * sizeof(std::uint64_t) + m_blocks.capacity() * sizeof(Block) + m_tail.capacity() * sizeof(T);
+    }
+
+    // 元素访问
+    T get(size_type pos) const {
+        if(m_encoding == MyPackedEncoding::packed) {
+            return static_cast<T>(read(std::uint64_t(pos) * m_width, m_width));
+        }
+        size_type b = pos / block_size;
+        if(b >= m_blocks.size()) {
+            return m_tail[pos - m_blocks.size() * block_size];
+        }
+        const Block& blk = m_blocks[b];
+        size_type j = pos % block_size;
+        size_type m = j / checkpoint_stride;
+        T sum = m == 0 ? T(0) : static_cast<T>(read(blk.offset + std::uint64_t(m - 1) * blk.checkpoint_width, blk.checkpoint_width));
+        if(blk.width != 0) {
+            std::uint64_t first = blk.offset + std::uint64_t(checkpoints) * blk.checkpoint_width + std::uint64_t(m * checkpoint_stride) * blk.width;
+            scan(first, blk.width, j - m * checkpoint_stride, [&sum](size_type, std::uint64_t v) { sum += static_cast<T>(v); });
+        }
+        return static_cast<T>(blk.base + static_cast<T>(j) * blk.min_delta + sum);
+    }
+    T operator[](size_type pos) const { return get(pos); }
+    T at(size_type pos) const {
+        if(pos >= m_size) {
+            throw std::out_of_range("MyPackedVector::at");
+        }
+        return get(pos);
+    }
+    T back() const {
+        if(m_size == 0) {
+            throw std::out_of_range("MyPackedVector::back");
+        }
+        return m_encoding == MyPackedEncoding::delta ? m_last : get(m_size - 1);
+    }
+
+    // 修改器
+    // delta 编码下 value 不能小于 back()，否则抛出 std::invalid_argument
+    void push_back(T value) {
+        if(m_encoding == MyPackedEncoding::packed) {
+            unsigned w = width_of(value);
+            if(w > m_width) {
+                repack(w);
+            }
+            reserve_bits(m_bits + m_width);
+            write(m_bits, m_width, value);
+            m_bits += m_width;
+            ++m_size;
+            return;
+        }
+        if(m_size != 0 && value < m_last) {
+            throw std::invalid_argument("MyPackedVector::push_back");
+        }
+        m_tail.push_back(value);
+        m_last = value;
+        ++m_size;
+        if(m_tail.size() == block_size) {
+            encode_block(m_tail.data());
+            m_tail.clear();
+        }
+    }
+    void clear() {
+        m_words.clear();
+        m_blocks.clear();
+        m_tail.clear();
+        m_size = 0;
+        m_bits = 0;
+        m_width = 0;
+        ensure_words();
+    }
+
+    // 批量解码：依次写出全部元素
+    void decode(T* out) const {
+        if(m_encoding == MyPackedEncoding::packed) {
+            unpack(0, m_width, m_size, out);
+            return;
+        }
+        T deltas[block_size];
+        for(const Block& blk : m_blocks) {
+            unpack(blk.offset + std::uint64_t(checkpoints) * blk.checkpoint_width, blk.width, block_size - 1, deltas);
+            T v = blk.base;
+            *out++ = v;
+            for(size_type k = 0; k + 1 < block_size; ++k) {
+                v += static_cast<T>(blk.min_delta + deltas[k]);
+                *out++ = v;
+            }
+        }
+        std::copy(m_tail.begin(), m_tail.end(), out);
+    }
+    MyVector<T> decode() const {
+        MyVector<T> out(m_size);
+        decode(out.data());
+        return out;
+    }
+
+private:
+    // 位流末尾多留两个字，解包时可以无条件读取 8 字节（gather 读取 4 字节）而不越界
+    static constexpr size_type padding_words = 2;
+    static constexpr size_type checkpoints = block_size / checkpoint_stride - 1;
+
+    // 位流中每块依次存放 checkpoints 个检查点与 block_size - 1 个差值
+    // 第 m 个检查点为前 (m + 1) * checkpoint_stride 个差值（已减去 min_delta）之和
+    struct Block {
+        std::uint64_t offset;           // 块在位流中的起点
+        T base;                         // 块内第一个元素
+        T min_delta;                    // 块内最小差值
+        unsigned char width;            // 差值减去 min_delta 后的位宽
+        unsigned char checkpoint_width; // 检查点的位宽
+    };
+
+    MyVector<std::uint64_t> m_words;
+    MyVector<Block> m_blocks;
+    MyVector<T> m_tail;
+    MyPackedEncoding m_encoding = MyPackedEncoding::packed;
+    size_type m_size = 0;
+    std::uint64_t m_bits = 0;
+    unsigned m_width = 0;
+    T m_last = 0;
+
+    static constexpr size_type words_for(std::uint64_t bits) noexcept { return static_cast<size_type>((bits + 63) / 64); }
+
+    static unsigned width_of(std::uint64_t v) noexcept {
+        unsigned w = 0;
+        while(v) {
+            ++w;
+            v >>= 1;
+        }
+        return w;
+    }
+
+    static size_type packed_bits(const T* data, size_type n) {
+        return n * width_of(n ? *std::max_element(data, data + n) : T(0));
+    }
+
+    // delta 编码所需的位数（含块描述），用于 automatic 时比较
+    static size_type delta_bits(const T* data, size_type n) {
+        size_type bits = 0;
+        size_type full = n / block_size;
+        for(size_type b = 0; b < full; ++b) {
+            const T* v = data + b * block_size;
+            T lo = static_cast<T>(v[1] - v[0]), hi = lo;
+            for(size_type k = 2; k < block_size; ++k) {
+                T d = static_cast<T>(v[k] - v[k - 1]);
+                lo = std::min(lo, d);
+                hi = std::max(hi, d);
+            }
+            T last_checkpoint = static_cast<T>(v[checkpoints * checkpoint_stride] - v[0] - static_cast<T>(checkpoints * checkpoint_stride) * lo);
+            bits += (block_size - 1) * width_of(static_cast<T>(hi - lo)) + checkpoints * width_of(last_checkpoint) + sizeof(Block) * 8;
+        }
+        return bits + (n - full * block_size) * sizeof(T) * 8;
+    }
+
+    void ensure_words() {
+        if(m_words.size() < words_for(m_bits) + padding_words) {
+            m_words.resize(words_for(m_bits) + padding_words, 0);
+        }
+    }
+
+    // 保证位流能容纳 bits 位，按倍增扩容
+    void reserve_bits(std::uint64_t bits) {
+        size_type need = words_for(bits) + padding_words;
+        if(need > m_words.size()) {
+            if(need > m_words.capacity()) {
+                m_words.reserve(std::max(need, m_words.capacity() * 2));
+            }
+            m_words.resize(need, 0);
+        }
+    }
+
+    const unsigned char* bytes() const noexcept { return reinterpret_cast<const unsigned char*>(m_words.data()); }
+
+    // 读取从第 bit 位开始的 w 位
+    std::uint64_t read(std::uint64_t bit, unsigned w) const noexcept {
+        const unsigned char* p = bytes() + (bit >> 3);
+        unsigned s = static_cast<unsigned>(bit & 7);
+        std::uint64_t v;
+        std::memcpy(&v, p, sizeof(v));
+        v >>= s;
+        if(w + s > 64) {
+            v |= std::uint64_t(p[8]) << (64 - s);
+        }
+        return w == 64 ? v : v & ((std::uint64_t(1) << w) - 1);
+    }
+
+    // 在全零的位置写入 w 位
+    void write(std::uint64_t bit, unsigned w, std::uint64_t v) noexcept {
+        if(w == 0) {
+            return;
+        }
+        size_type idx = static_cast<size_type>(bit / 64);
+        unsigned s = static_cast<unsigned>(bit % 64);
+        m_words[idx] |= v << s;
+        if(s + w > 64) {
+            m_words[idx + 1] |= v >> (64 - s);
+        }
+    }
+
+    // 从第 bit 位开始解包 n 个 w 位的值
+    void unpack(std::uint64_t bit, unsigned w, size_type n, T* out) const {
+        size_type i = 0;
+        if(w == 0) {
+            std::fill(out, out + n, T(0));
+            return;
+        }
+#if defined(__AVX2__)
+        if constexpr(sizeof(T) == 4) {
+            // 每个 32 位 gather 从元素所在的字节开始读取，右移不超过 7 位后仍包含完整的 w 位
+            if(w <= 25) {
+                const __m256i lane = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(static_cast<int>(w)));
+                const __m256i mask = _mm256_set1_epi32(static_cast<int>((1u << w) - 1));
+                const __m256i seven = _mm256_set1_epi32(7);
+                for(; i + 8 <= n; i += 8) {
+                    std::uint64_t b = bit + std::uint64_t(i) * w;
+                    const unsigned char* p = bytes() + (b >> 3);
+                    __m256i rel = _mm256_add_epi32(lane, _mm256_set1_epi32(static_cast<int>(b & 7)));
+                    __m256i v = _mm256_i32gather_epi32(reinterpret_cast<const int*>(p), _mm256_srli_epi32(rel, 3), 1);
+                    v = _mm256_and_si256(_mm256_srlv_epi32(v, _mm256_and_si256(rel, seven)), mask);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), v);
+                }
+            }
+        }
+#endif
+        scan(bit + std::uint64_t(i) * w, w, n - i, [&out, i](size_type k, std::uint64_t v) mutable {
+            out[i + k] = static_cast<T>(v);
+        });
+    }
+
+    // 从第 bit 位开始顺序读取 n 个 w 位的值，依次调用 sink(k, value)
+    // 在对齐的字上滑动窗口，每个值只需移位与掩码，跨字时再拼接下一个字
+    template <typename Sink>
+    void scan(std::uint64_t bit, unsigned w, size_type n, Sink sink) const {
+        const std::uint64_t* word = m_words.data() + bit / 64;
+        unsigned s = static_cast<unsigned>(bit % 64);
+        const std::uint64_t mask = w == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << w) - 1;
+        std::uint64_t cur = word[0];
+        for(size_type k = 0; k < n; ++k) {
+            std::uint64_t v = cur >> s;
+            if(s + w > 64) {
+                v |= word[1] << (64 - s);
+            }
+            sink(k, v & mask);
+            s += w;
+            if(s >= 64) {
+                s -= 64;
+                cur = *++word;
+            }
+        }
+    }
+
+    void encode_block(const T* v) {
+        T lo = static_cast<T>(v[1] - v[0]), hi = lo;
+        for(size_type k = 2; k < block_size; ++k) {
+            T d = static_cast<T>(v[k] - v[k - 1]);
+            lo = std::min(lo, d);
+            hi = std::max(hi, d);
+        }
+        unsigned w = width_of(static_cast<T>(hi - lo));
+        // 检查点单调不减，位宽由最后一个决定
+        unsigned cw = width_of(static_cast<T>(v[checkpoints * checkpoint_stride] - v[0] - static_cast<T>(checkpoints * checkpoint_stride) * lo));
+        m_blocks.push_back(Block{m_bits, v[0], lo, static_cast<unsigned char>(w), static_cast<unsigned char>(cw)});
+        reserve_bits(m_bits + std::uint64_t(checkpoints) * cw + std::uint64_t(block_size - 1) * w);
+        for(size_type m = 1; m <= checkpoints; ++m) {
+            size_type k = m * checkpoint_stride;
+            write(m_bits, cw, static_cast<T>(v[k] - v[0] - static_cast<T>(k) * lo));
+            m_bits += cw;
+        }
+        for(size_type k = 1; k < block_size; ++k) {
+            write(m_bits, w, static_cast<T>(v[k] - v[k - 1] - lo));
+            m_bits += w;
+        }
+        m_width = std::max(m_width, w);
+    }
+
+    // 按更大的位宽重新打包全部元素
+    void repack(unsigned w) {
+        MyVector<T> values = decode();
+        MyVector<std::uint64_t> words(words_for(std::uint64_t(m_size) * w) + padding_words, 0);
+        m_words.swap(words);
+        m_width = w;
+        m_bits = 0;
+        for(size_type i = 0; i < m_size; ++i) {
+            write(m_bits, m_width, values[i]);
+            m_bits += m_width;
+        }
+    }
+};
+
+#endif // MY_PACKED_VECTOR_H
@@ -0,0 +1,190 @@
+#include "my_packed_vector.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <limits>
+
+template <typename T>
+bool sameAs(const MyPackedVector<T>& packed, const std::vector<T>& ref) {
+    if (packed.size() != ref.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < ref.size(); ++i) {
+        if (packed[i] != ref[i]) {
+            return false;
+        }
+    }
+    MyVector<T> all = packed.decode();
+    for (std::size_t i = 0; i < ref.size(); ++i) {
+        if (all[i] != ref[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+MyVector<T> toMy(const std::vector<T>& ref) {
+    MyVector<T> vec;
+    for (T x : ref) {
+        vec.push_back(x);
+    }
+    return vec;
+}
+
+// 每种位宽各测一次 packed，覆盖跨字与 AVX2 的边界位宽
+template <typename T>
+void checkAllWidths(std::mt19937_64& rng) {
+    for (unsigned w = 0; w <= sizeof(T) * 8; ++w) {
+        std::vector<T> ref(301);
+        for (T& x : ref) {
+            std::uint64_t r = rng();
+            x = static_cast<T>(w == 64 ? r : r & ((std::uint64_t(1) << w) - 1));
+        }
+        if (w > 0) {
+            ref[7] = static_cast<T>(w == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << w) - 1);
+        }
+        MyPackedVector<T> packed(toMy(ref), MyPackedEncoding::packed);
+        assert(packed.encoding() == MyPackedEncoding::packed && packed.bit_width() == w);
+        assert(sameAs(packed, ref));
+    }
+}
+
+int main() {
+    std::mt19937_64 rng(47);
+
+    std::cout << "===== 1) 空向量与基本访问 =====" << std::endl;
+    {
+        MyPackedVector<std::uint32_t> empty;
+        assert(empty.empty() && empty.decode().empty());
+        MyVector<std::uint32_t> small = {5, 3, 7, 0, 6};
+        MyPackedVector<std::uint32_t> packed(small);
+        assert(packed.encoding() == MyPackedEncoding::packed && packed.bit_width() == 3);
+        assert(packed.size() == 5 && packed[0] == 5 && packed.get(2) == 7 && packed.at(4) == 6 && packed.back() == 6);
+        bool thrown = false;
+        try {
+            packed.at(5);
+        } catch (const std::out_of_range&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+
+    std::cout << "===== 2) packed：所有位宽 =====" << std::endl;
+    {
+        checkAllWidths<std::uint8_t>(rng);
+        checkAllWidths<std::uint16_t>(rng);
+        checkAllWidths<std::uint32_t>(rng);
+        checkAllWidths<std::uint64_t>(rng);
+    }
+
+    std::cout << "===== 3) packed：push_back 扩大位宽 =====" << std::endl;
+    {
+        MyPackedVector<std::uint64_t> packed;
+        std::vector<std::uint64_t> ref;
+        for (int i = 0; i < 5000; ++i) {
+            std::uint64_t v = rng() >> (63 - i / 80);
+            packed.push_back(v);
+            ref.push_back(v);
+        }
+        assert(sameAs(packed, ref) && packed.bit_width() == 63);
+        packed.clear();
+        assert(packed.empty() && packed.bit_width() == 0);
+        packed.push_back(0);
+        packed.push_back(0);
+        assert(packed.size() == 2 && packed[1] == 0);
+    }
+
+    std::cout << "===== 4) delta：有序数据 =====" << std::endl;
+    {
+        for (std::size_t n : {1u, 127u, 128u, 129u, 255u, 256u, 1000u, 100000u}) {
+            std::vector<std::uint64_t> ref(n);
+            std::uint64_t v = rng() % 1000;
+            for (std::uint64_t& x : ref) {
+                v += rng() % 200;
+                x = v;
+            }
+            MyPackedVector<std::uint64_t> packed(toMy(ref));
+            assert(n < 256 || packed.encoding() == MyPackedEncoding::delta);
+            assert(sameAs(packed, ref));
+            MyPackedVector<std::uint64_t> forced(toMy(ref), MyPackedEncoding::delta);
+            assert(forced.encoding() == MyPackedEncoding::delta && sameAs(forced, ref));
+        }
+        // 等差数列的差值减去最小差值后全为 0，每块只剩块描述
+        MyVector<std::uint32_t> arith;
+        for (std::uint32_t i = 0; i < 128 * 100; ++i) {
+            arith.push_back(1000000 + 7 * i);
+        }
+        MyPackedVector<std::uint32_t> packed(arith);
+        assert(packed.encoding() == MyPackedEncoding::delta && packed.bit_width() == 0);
+        assert(packed[5000] == 1000000 + 7 * 5000 && packed.back() == arith.back());
+        assert(packed.memory_bytes() < arith.size() * sizeof(std::uint32_t) / 10);
+        // 相邻差值跨越整个值域
+        std::vector<std::uint32_t> wide = {0, 1, std::numeric_limits<std::uint32_t>::max()};
+        MyPackedVector<std::uint32_t> wp(MyPackedEncoding::delta);
+        for (std::uint32_t x : wide) {
+            wp.push_back(x);
+        }
+        for (int i = 0; i < 300; ++i) {
+            wp.push_back(std::numeric_limits<std::uint32_t>::max());
+            wide.push_back(std::numeric_limits<std::uint32_t>::max());
+        }
+        assert(sameAs(wp, wide));
+    }
+
+    std::cout << "===== 5) delta：push_back 与错误输入 =====" << std::endl;
+    {
+        MyPackedVector<std::uint32_t> packed(MyPackedEncoding::delta);
+        std::vector<std::uint32_t> ref;
+        std::uint32_t v = 0;
+        for (int i = 0; i < 10000; ++i) {
+            v += static_cast<std::uint32_t>(rng() % (i % 300 == 0 ? 100000 : 50));
+            packed.push_back(v);
+            ref.push_back(v);
+            if (i % 997 == 0) {
+                assert(sameAs(packed, ref));
+            }
+        }
+        assert(sameAs(packed, ref));
+        bool thrown = false;
+        try {
+            packed.push_back(v - 1);
+        } catch (const std::invalid_argument&) {
+            thrown = true;
+        }
+        assert(thrown && packed.size() == 10000);
+        thrown = false;
+        try {
+            MyPackedVector<std::uint32_t> bad(MyVector<std::uint32_t>{3, 1, 2}, MyPackedEncoding::delta);
+        } catch (const std::invalid_argument&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+
+    std::cout << "===== 6) 压缩率 =====" << std::endl;
+    {
+        MyVector<std::uint32_t> smallValues(1 << 16);
+        for (auto& x : smallValues) {
+            x = static_cast<std::uint32_t>(rng() % 1000);
+        }
+        MyPackedVector<std::uint32_t> a(smallValues);
+        MyVector<std::uint64_t> ids(1 << 16);
+        std::uint64_t id = 1ull << 40;
+        for (auto& x : ids) {
+            id += 1 + rng() % 64;
+            x = id;
+        }
+        MyPackedVector<std::uint64_t> b(ids);
+        double ra = static_cast<double>(smallValues.size() * 4) / a.memory_bytes();
+        double rb = static_cast<double>(ids.size() * 8) / b.memory_bytes();
+        std::cout << "values < 1000: " << ra << "x, sorted ids: " << rb << "x" << std::endl;
+        assert(ra > 3.0 && rb > 5.0);
+    }
+
+    std::cout << "All MyPackedVector tests passed successfully!" << std::endl;
+    return 0;
+}
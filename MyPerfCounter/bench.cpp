@@ -0,0 +1,136 @@
+#include "my_perf_counter.hpp"
+#include "../MyVector/my_vector.hpp"
+#include "../MyList/my_list.hpp"
+#include "../MyUnrolledList/my_unrolled_list.hpp"
+#include "../MyIndexList/my_index_list.hpp"
+#include <iostream>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+volatile std::uint64_t g_sink = 0;
+
+std::uint64_t xorshift(std::uint64_t& x) {
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return x;
+}
+
+template <typename Container>
+std::uint64_t sumAll(const Container& c) {
+    std::uint64_t s = 0;
+    for (auto it = c.begin(); it != c.end(); ++it) {
+        s += *it;
+    }
+    return s;
+}
+
+// 每个新元素插在一个随机的已有元素之前，遍历顺序与节点的分配顺序无关
+template <typename List>
+void buildScattered(List& list, std::size_t n) {
+    MyVector<typename List::iterator> its;
+    its.reserve(n);
+    its.push_back(list.insert(list.end(), 0));
+    std::uint64_t x = 88172645463325252ull;
+    for (std::size_t i = 1; i < n; ++i) {
+        its.push_back(list.insert(its[xorshift(x) % its.size()], i));
+    }
+}
+
+template <typename Container>
+void benchPushBack(MyPerfCounters& counters, MyPerfTable& table, const std::string& name, std::size_t n) {
+    Container c;
+    table.add(name + "/push_back/" + std::to_string(n), counters.measure(n, [&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            c.push_back(i);
+        }
+    }));
+    g_sink = g_sink + c.size();
+}
+
+template <typename Container>
+void benchIterate(MyPerfCounters& counters, MyPerfTable& table, const std::string& label, const Container& c) {
+    g_sink = g_sink + sumAll(c);
+    table.add(label, counters.measure(c.size(), [&] { g_sink = g_sink + sumAll(c); }));
+}
+
+// 一组容器 × 规模 × 访问方式的矩阵；参数为最大元素个数
+int main(int argc, char** argv) {
+    std::size_t max_n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : (std::size_t(1) << 20);
+
+    MyPerfCounters counters;
+    if (!counters.any_hardware()) {
+        std::cout << "hardware counters unavailable (" << std::strerror(counters.error())
+                  << "), reporting wall time and software counters only" << std::endl;
+    }
+
+    for (std::size_t n = 1024; n <= max_n; n *= 32) {
+        MyPerfTable table;
+        std::string size = "/" + std::to_string(n);
+
+        benchPushBack<MyVector<std::uint64_t>>(counters, table, "MyVector", n);
+        benchPushBack<MyList<std::uint64_t>>(counters, table, "MyList", n);
+        benchPushBack<MyUnrolledList<std::uint64_t>>(counters, table, "MyUnrolledList", n);
+        benchPushBack<MyIndexList<std::uint64_t>>(counters, table, "MyIndexList", n);
+
+        {
+            MyVector<std::uint64_t> v;
+            for (std::size_t i = 0; i < n; ++i) {
+                v.push_back(i);
+            }
+            benchIterate(counters, table, "MyVector/iterate" + size, v);
+
+            // 依赖链式的随机读取，每次访问的位置由上一次读到的值决定
+            std::size_t lookups = n;
+            std::uint64_t x = 88172645463325252ull;
+            for (std::size_t i = 0; i < n; ++i) {
+                v[i] = xorshift(x);
+            }
+            table.add("MyVector/random_get" + size, counters.measure(lookups, [&] {
+                std::uint64_t pos = 0;
+                for (std::size_t i = 0; i < lookups; ++i) {
+                    pos = (v[pos % n] + i) % n;
+                }
+                g_sink = g_sink + pos;
+            }));
+
+            // 中间插入每次移动一半元素，次数固定以免大规模时过慢
+            std::size_t inserts = 256;
+            table.add("MyVector/insert_middle" + size, counters.measure(inserts, [&] {
+                for (std::size_t i = 0; i < inserts; ++i) {
+                    v.insert(v.begin() + v.size() / 2, i);
+                }
+            }));
+        }
+        {
+            MyList<std::uint64_t> seq;
+            for (std::size_t i = 0; i < n; ++i) {
+                seq.push_back(i);
+            }
+            benchIterate(counters, table, "MyList/iterate" + size, seq);
+            MyList<std::uint64_t> scattered;
+            buildScattered(scattered, n);
+            benchIterate(counters, table, "MyList/iterate_scattered" + size, scattered);
+        }
+        {
+            MyUnrolledList<std::uint64_t> list;
+            for (std::size_t i = 0; i < n; ++i) {
+                list.push_back(i);
+            }
+            benchIterate(counters, table, "MyUnrolledList/iterate" + size, list);
+        }
+        {
+            MyIndexList<std::uint64_t> list;
+            buildScattered(list, n);
+            benchIterate(counters, table, "MyIndexList/iterate_scattered" + size, list);
+            list.compact();
+            benchIterate(counters, table, "MyIndexList/iterate_compacted" + size, list);
+        }
+
+        table.print(std::cout);
+        std::cout << std::endl;
+    }
+    return g_sink == 1 ? 1 : 0;
+}
@@ -0,0 +1,262 @@
+#ifndef MY_PERF_COUNTER_H
+#define MY_PERF_COUNTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cerrno>
+#include <chrono>
+#include <string>
+#include <ostream>
+#include <iomanip>
+#include <sstream>
+
+#include "../MyVector/my_vector.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// 可统计的事件：前六个为硬件计数器，page_faults 为内核软件计数器
+enum class MyPerfEvent {
+    cycles,
+    instructions,
+    l1d_misses,    // L1 数据缓存读缺失
+    llc_misses,    // 末级缓存缺失
+    dtlb_misses,   // 数据 TLB 读缺失
+    branch_misses,
+    page_faults
+};
+
+constexpr std::size_t my_perf_event_count = 7;
+
+inline const char* my_perf_event_name(MyPerfEvent e) noexcept {
+    switch(e) {
+        case MyPerfEvent::cycles: return "cycles";
+        case MyPerfEvent::instructions: return "instr";
+        case MyPerfEvent::l1d_misses: return "L1d-miss";
+        case MyPerfEvent::llc_misses: return "LLC-miss";
+        case MyPerfEvent::dtlb_misses: return "dTLB-miss";
+        case MyPerfEvent::branch_misses: return "br-miss";
+        case MyPerfEvent::page_faults: return "faults";
+    }
+    return "?";
+}
+
+// 一次测量的结果：墙钟时间总是有效，各计数器只在打开成功且被调度过时有效
+// 计数器被内核分时复用时按 time_enabled / time_running 放大
+struct MyPerfSample {
+    std::size_t ops = 1;
+    double time_ns = 0;
+    double value[my_perf_event_count] = {};
+    bool valid[my_perf_event_count] = {};
+
+    bool has(MyPerfEvent e) const noexcept { return valid[static_cast<std::size_t>(e)]; }
+    double total(MyPerfEvent e) const noexcept { return value[static_cast<std::size_t>(e)]; }
+    // 每次操作的平均计数
+    double per_op(MyPerfEvent e) const noexcept { return total(e) / static_cast<double>(ops ? ops : 1); }
+    double ns_per_op() const noexcept { return time_ns / static_cast<double>(ops ? ops : 1); }
+    // 每周期指令数，cycles 或 instructions 不可用时为 0
+    double ipc() const noexcept {
+        return has(MyPerfEvent::cycles) && has(MyPerfEvent::instructions) && total(MyPerfEvent::cycles) > 0
+            ? total(MyPerfEvent::instructions) / total(MyPerfEvent::cycles) : 0;
+    }
+};
+
+// 调用线程上的一组计数器（perf_event_open，只统计用户态）
+// 每个事件单独打开，某个事件不被支持（虚拟机、容器、perf_event_paranoid 限制）时只有它不可用，
+// 全部不可用时仍然给出墙钟时间
+class MyPerfCounters {
+public:
+    using size_type = std::size_t;
+
+    MyPerfCounters() {
+        for(size_type i = 0; i < my_perf_event_count; ++i) {
+            m_fd[i] = open_event(static_cast<MyPerfEvent>(i));
+        }
+    }
+    ~MyPerfCounters() {
+#if defined(__linux__)
+        for(size_type i = 0; i < my_perf_event_count; ++i) {
+            if(m_fd[i] >= 0) {
+                ::close(m_fd[i]);
+            }
+        }
+#endif
+    }
+    MyPerfCounters(const MyPerfCounters&) = delete;
+    MyPerfCounters& operator=(const MyPerfCounters&) = delete;
+
+    bool available(MyPerfEvent e) const noexcept { return m_fd[static_cast<size_type>(e)] >= 0; }
+    bool any_hardware() const noexcept {
+        for(size_type i = 0; i < static_cast<size_type>(MyPerfEvent::page_faults); ++i) {
+            if(m_fd[i] >= 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+    // 第一个打开失败的事件的 errno，全部成功时为 0
+    int error() const noexcept { return m_error; }
+
+    // start() 与 stop() 之间的计数；ops 为期间执行的操作次数
+    void start() {
+        for(size_type i = 0; i < my_perf_event_count; ++i) {
+            m_begin[i] = read_event(i);
+        }
+        m_start = std::chrono::steady_clock::now();
+    }
+    MyPerfSample stop(size_type ops = 1) {
+        auto end = std::chrono::steady_clock::now();
+        MyPerfSample s;
+        for(size_type i = 0; i < my_perf_event_count; ++i) {
+            Reading r = read_event(i);
+            std::uint64_t enabled = r.enabled - m_begin[i].enabled;
+            std::uint64_t running = r.running - m_begin[i].running;
+            s.valid[i] = m_fd[i] >= 0 && r.ok && m_begin[i].ok && running > 0;
+            if(s.valid[i]) {
+                s.value[i] = static_cast<double>(r.count - m_begin[i].count) * static_cast<double>(enabled) / static_cast<double>(running);
+            }
+        }
+        s.ops = ops;
+        s.time_ns = std::chrono::duration<double, std::nano>(end - m_start).count();
+        return s;
+    }
+
+    // 执行 fn 一次并测量，fn 内共执行 ops 次操作
+    template <typename Fn>
+    MyPerfSample measure(size_type ops, Fn&& fn) {
+        start();
+        fn();
+        return stop(ops);
+    }
+
+private:
+    struct Reading {
+        std::uint64_t count = 0;
+        std::uint64_t enabled = 0;
+        std::uint64_t running = 0;
+        bool ok = false;
+    };
+
+    int m_fd[my_perf_event_count];
+    int m_error = 0;
+    Reading m_begin[my_perf_event_count];
+    std::chrono::steady_clock::time_point m_start;
+
+    int open_event(MyPerfEvent e) {
+#if defined(__linux__) && defined(SYS_perf_event_open)
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        constexpr std::uint64_t read_miss = PERF_COUNT_HW_CACHE_OP_READ << 8 | PERF_COUNT_HW_CACHE_RESULT_MISS << 16;
+        switch(e) {
+            case MyPerfEvent::cycles: attr.config = PERF_COUNT_HW_CPU_CYCLES; break;
+            case MyPerfEvent::instructions: attr.config = PERF_COUNT_HW_INSTRUCTIONS; break;
+            case MyPerfEvent::l1d_misses:
+                attr.type = PERF_TYPE_HW_CACHE;
+                attr.config = PERF_COUNT_HW_CACHE_L1D | read_miss;
+                break;
+            case MyPerfEvent::llc_misses: attr.config = PERF_COUNT_HW_CACHE_MISSES; break;
+            case MyPerfEvent::dtlb_misses:
+                attr.type = PERF_TYPE_HW_CACHE;
+                attr.config = PERF_COUNT_HW_CACHE_DTLB | read_miss;
+                break;
+            case MyPerfEvent::branch_misses: attr.config = PERF_COUNT_HW_BRANCH_MISSES; break;
+            case MyPerfEvent::page_faults:
+                attr.type = PERF_TYPE_SOFTWARE;
+                attr.config = PERF_COUNT_SW_PAGE_FAULTS;
+                break;
+        }
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        int fd = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+        if(fd < 0 && m_error == 0) {
+            m_error = errno;
+        }
+        return fd;
+#else
+        (void)e;
+        if(m_error == 0) {
+            m_error = ENOSYS;
+        }
+        return -1;
+#endif
+    }
+
+    Reading read_event(size_type i) const {
+        Reading r;
+#if defined(__linux__)
+        if(m_fd[i] >= 0) {
+            std::uint64_t buf[3];
+            r.ok = ::read(m_fd[i], buf, sizeof(buf)) == static_cast<ssize_t>(sizeof(buf));
+            if(r.ok) {
+                r.count = buf[0];
+                r.enabled = buf[1];
+                r.running = buf[2];
+            }
+        }
+#else
+        (void)i;
+#endif
+        return r;
+    }
+};
+
+// 按行汇总测量结果并输出对齐的表格，不可用的计数器显示为 "-"
+class MyPerfTable {
+public:
+    using size_type = std::size_t;
+
+    void add(const std::string& label, const MyPerfSample& sample) {
+        m_rows.push_back(Row{label, sample});
+    }
+    size_type size() const noexcept { return m_rows.size(); }
+    const MyPerfSample& operator[](size_type i) const { return m_rows[i].sample; }
+    void clear() { m_rows.clear(); }
+
+    void print(std::ostream& os) const {
+        size_type label_width = 5;
+        for(size_type i = 0; i < m_rows.size(); ++i) {
+            label_width = m_rows[i].label.size() > label_width ? m_rows[i].label.size() : label_width;
+        }
+        os << std::left << std::setw(static_cast<int>(label_width)) << "case" << std::right << std::setw(cell_width) << "ns/op";
+        for(size_type e = 0; e < my_perf_event_count; ++e) {
+            os << std::setw(cell_width) << my_perf_event_name(static_cast<MyPerfEvent>(e));
+        }
+        os << std::setw(cell_width) << "IPC" << '\n';
+        for(size_type i = 0; i < m_rows.size(); ++i) {
+            const MyPerfSample& s = m_rows[i].sample;
+            os << std::left << std::setw(static_cast<int>(label_width)) << m_rows[i].label << std::right << std::setw(cell_width) << format(s.ns_per_op());
+            for(size_type e = 0; e < my_perf_event_count; ++e) {
+                MyPerfEvent ev = static_cast<MyPerfEvent>(e);
+                os << std::setw(cell_width) << (s.has(ev) ? format(s.per_op(ev)) : std::string("-"));
+            }
+            os << std::setw(cell_width) << (s.ipc() > 0 ? format(s.ipc()) : std::string("-")) << '\n';
+        }
+    }
+
+private:
+    static constexpr int cell_width = 11;
+
+    struct Row {
+        std::string label;
+        MyPerfSample sample;
+    };
+
+    MyVector<Row> m_rows;
+
+    // 三位有效数字左右：大数不带小数，小数保留到千分位
+    static std::string format(double v) {
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(v >= 100 ? 0 : v >= 10 ? 1 : v >= 1 ? 2 : 3) << v;
+        return out.str();
+    }
+};
+
+#endif // MY_PERF_COUNTER_H
@@ -0,0 +1,145 @@
+#include "my_perf_counter.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+volatile std::uint64_t g_sink = 0;
+
+std::uint64_t spin(std::size_t n) {
+    std::uint64_t x = 1;
+    for (std::size_t i = 0; i < n; ++i) {
+        x = x * 6364136223846793005ull + i;
+    }
+    return x;
+}
+
+int main() {
+    std::cout << "===== 1) 打开计数器 =====" << std::endl;
+    {
+        MyPerfCounters counters;
+        std::cout << "hardware counters: " << (counters.any_hardware() ? "available" : "unavailable");
+        if (counters.error() != 0) {
+            std::cout << " (first error: " << std::strerror(counters.error()) << ")";
+        }
+        std::cout << std::endl;
+        for (std::size_t e = 0; e < my_perf_event_count; ++e) {
+            std::cout << "  " << my_perf_event_name(static_cast<MyPerfEvent>(e)) << ": "
+                      << (counters.available(static_cast<MyPerfEvent>(e)) ? "yes" : "no") << std::endl;
+        }
+        // 只要有一个事件打不开就记录 errno
+        bool all = true;
+        for (std::size_t e = 0; e < my_perf_event_count; ++e) {
+            all = all && counters.available(static_cast<MyPerfEvent>(e));
+        }
+        assert(all == (counters.error() == 0));
+    }
+
+    std::cout << "===== 2) 测量与按操作归一化 =====" << std::endl;
+    {
+        MyPerfCounters counters;
+        const std::size_t ops = 1 << 20;
+        MyPerfSample s = counters.measure(ops, [&] { g_sink = spin(ops); });
+        assert(s.ops == ops && s.time_ns > 0);
+        assert(s.ns_per_op() > 0);
+        for (std::size_t e = 0; e < my_perf_event_count; ++e) {
+            MyPerfEvent ev = static_cast<MyPerfEvent>(e);
+            // 打不开的事件不会出现在结果里
+            assert(!s.has(ev) || counters.available(ev));
+            assert(s.has(ev) || s.total(ev) == 0);
+        }
+        if (s.has(MyPerfEvent::instructions)) {
+            // 每次迭代至少一条乘法和一条加法
+            assert(s.per_op(MyPerfEvent::instructions) >= 2);
+        }
+        if (s.has(MyPerfEvent::cycles) && s.has(MyPerfEvent::instructions)) {
+            assert(s.ipc() > 0);
+        } else {
+            assert(s.ipc() == 0);
+        }
+    }
+
+    std::cout << "===== 3) 软件计数器：缺页 =====" << std::endl;
+    {
+        MyPerfCounters counters;
+#if defined(__linux__)
+        const std::size_t pages = 256;
+        const std::size_t bytes = pages * 4096;
+        void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        assert(p != MAP_FAILED);
+        MyPerfSample s = counters.measure(pages, [&] {
+            for (std::size_t i = 0; i < bytes; i += 4096) {
+                static_cast<volatile char*>(p)[i] = 1;
+            }
+        });
+        ::munmap(p, bytes);
+        if (s.has(MyPerfEvent::page_faults)) {
+            // 首次写入每页都会缺页，透明大页可能把多页合成一次
+            assert(s.total(MyPerfEvent::page_faults) >= 1);
+            assert(s.per_op(MyPerfEvent::page_faults) <= 2);
+        }
+#endif
+        // 前后两次测量互不影响
+        MyPerfSample a = counters.measure(1, [] {});
+        MyPerfSample b = counters.measure(1, [] {});
+        if (a.has(MyPerfEvent::page_faults) && b.has(MyPerfEvent::page_faults)) {
+            assert(a.total(MyPerfEvent::page_faults) < 16 && b.total(MyPerfEvent::page_faults) < 16);
+        }
+    }
+
+    std::cout << "===== 4) 不可用的计数器 =====" << std::endl;
+    {
+        MyPerfSample s;
+        s.ops = 4;
+        s.time_ns = 100;
+        assert(s.ns_per_op() == 25);
+        assert(!s.has(MyPerfEvent::cycles) && s.ipc() == 0);
+        s.valid[static_cast<std::size_t>(MyPerfEvent::cycles)] = true;
+        s.value[static_cast<std::size_t>(MyPerfEvent::cycles)] = 400;
+        assert(s.per_op(MyPerfEvent::cycles) == 100);
+        assert(s.ipc() == 0);
+        s.valid[static_cast<std::size_t>(MyPerfEvent::instructions)] = true;
+        s.value[static_cast<std::size_t>(MyPerfEvent::instructions)] = 800;
+        assert(s.ipc() == 2);
+    }
+
+    std::cout << "===== 5) 表格输出 =====" << std::endl;
+    {
+        MyPerfTable table;
+        MyPerfSample s;
+        s.ops = 10;
+        s.time_ns = 1234;
+        s.valid[static_cast<std::size_t>(MyPerfEvent::branch_misses)] = true;
+        s.value[static_cast<std::size_t>(MyPerfEvent::branch_misses)] = 5;
+        table.add("MyVector/iterate/1024", s);
+        table.add("x", MyPerfSample());
+        assert(table.size() == 2 && table[0].ops == 10);
+
+        std::ostringstream out;
+        table.print(out);
+        std::string text = out.str();
+        std::istringstream lines(text);
+        std::string header, row0, row1, extra;
+        assert(std::getline(lines, header) && std::getline(lines, row0) && std::getline(lines, row1));
+        assert(!std::getline(lines, extra));
+        // 各行等宽对齐
+        assert(header.size() == row0.size() && row0.size() == row1.size());
+        assert(header.find("cycles") != std::string::npos && header.find("IPC") != std::string::npos);
+        assert(row0.find("MyVector/iterate/1024") == 0);
+        assert(row0.find("123") != std::string::npos && row0.find("0.500") != std::string::npos);
+        assert(row0.find(" -") != std::string::npos);
+        std::cout << text;
+
+        table.clear();
+        assert(table.size() == 0);
+    }
+
+    std::cout << "All MyPerfCounter tests passed successfully!" << std::endl;
+    return 0;
+}
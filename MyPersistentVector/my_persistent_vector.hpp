@@ -0,0 +1,461 @@
+#ifndef MY_PERSISTENT_VECTOR_H
+#define MY_PERSISTENT_VECTOR_H
+
+#include <cstddef>
+#include <atomic>
+#include <memory>
+#include <new>
+#include <initializer_list>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <iterator>
+#include <utility>
+
+#include "../MyVector/my_vector.hpp"
+
+// 持久化向量：32 路前缀树加尾部缓冲，节点带原子引用计数并在副本之间共享
+// 拷贝即 O(1) 快照；修改时只复制路径上被共享的节点，未被共享时原地修改
+// 不同对象可以在不同线程中使用，同一对象的修改仍需外部同步
+template <typename T>
+class MyPersistentVector {
+public:
+    // 类型别名
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = const T&;
+    using const_reference = const T&;
+    using pointer = const T*;
+    using const_pointer = const T*;
+
+    class const_iterator;
+    using iterator = const_iterator;
+    using reverse_iterator = std::reverse_iterator<const_iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr size_type bits = 5;
+    static constexpr size_type branching = size_type(1) << bits;
+
+    // 构造函数
+    MyPersistentVector() noexcept = default;
+    MyPersistentVector(size_type count, const_reference value) {
+        for(size_type i = 0; i < count; ++i) {
+            push_back(value);
+        }
+    }
+    MyPersistentVector(std::initializer_list<T> init) {
+        for(const_reference val : init) {
+            push_back(val);
+        }
+    }
+    explicit MyPersistentVector(const MyVector<T>& o) {
+        for(size_type i = 0; i < o.size(); ++i) {
+            push_back(o[i]);
+        }
+    }
+    // O(1)，与 o 共享全部节点
+    MyPersistentVector(const MyPersistentVector& o) noexcept
+        : m_root(o.m_root), m_tail(o.m_tail), m_size(o.m_size), m_shift(o.m_shift) {
+        retain(m_root);
+        retain(m_tail);
+    }
+    MyPersistentVector(MyPersistentVector&& o) noexcept
+        : m_root(o.m_root), m_tail(o.m_tail), m_size(o.m_size), m_shift(o.m_shift) {
+        o.reset();
+    }
+    // 析构函数
+    ~MyPersistentVector() { release_all(); }
+
+    // 赋值运算符
+    MyPersistentVector& operator=(const MyPersistentVector& o) noexcept {
+        MyPersistentVector tmp(o);
+        swap(tmp);
+        return *this;
+    }
+    MyPersistentVector& operator=(MyPersistentVector&& o) noexcept {
+        if(this != &o) {
+            release_all();
+            m_root = o.m_root;
+            m_tail = o.m_tail;
+            m_size = o.m_size;
+            m_shift = o.m_shift;
+            o.reset();
+        }
+        return *this;
+    }
+
+    // 快照，与拷贝构造相同
+    MyPersistentVector snapshot() const noexcept { return *this; }
+
+    // 容量
+    size_type size() const noexcept { return m_size; }
+    bool empty() const noexcept { return m_size == 0; }
+
+    // 元素访问，O(log32 n)
+    const_reference operator[](size_type pos) const { return leaf_for(pos)->data()[pos & mask]; }
+    const_reference at(size_type pos) const {
+        if(pos >= m_size) {
+            throw std::out_of_range("MyPersistentVector::at");
+        }
+        return (*this)[pos];
+    }
+    const_reference front() const {
+        if(empty()) {
+            throw std::out_of_range("MyPersistentVector::front");
+        }
+        return (*this)[0];
+    }
+    const_reference back() const {
+        if(empty()) {
+            throw std::out_of_range("MyPersistentVector::back");
+        }
+        return (*this)[m_size - 1];
+    }
+
+    // 修改器，只复制路径上被共享的节点
+    void set(size_type pos, const_reference val) { mutable_at(pos) = val; }
+    void set(size_type pos, T&& val) { mutable_at(pos) = std::move(val); }
+    void push_back(const_reference val) { emplace_back(val); }
+    void push_back(T&& val) { emplace_back(std::move(val)); }
+    template <typename... Args>
+    void emplace_back(Args&&... args) {
+        size_type count = tail_count();
+        if(m_tail && count < branching) {
+            m_tail = unique_leaf(m_tail, count);
+            ::new (static_cast<void*>(m_tail->data() + count)) T(std::forward<Args>(args)...);
+            ++m_size;
+            return;
+        }
+        // 尾部已满：先在新叶子中构造元素，再把旧尾部挂入前缀树
+        Leaf* leaf = new Leaf;
+        try {
+            ::new (static_cast<void*>(leaf->data())) T(std::forward<Args>(args)...);
+        } catch(...) {
+            delete leaf;
+            throw;
+        }
+        if(m_tail) {
+            push_tail();
+        }
+        m_tail = leaf;
+        ++m_size;
+    }
+    void pop_back() {
+        if(empty()) {
+            throw std::out_of_range("MyPersistentVector::pop_back");
+        }
+        size_type count = tail_count();
+        if(count > 1) {
+            m_tail = unique_leaf(m_tail, count);
+            m_tail->data()[count - 1].~T();
+            --m_size;
+            return;
+        }
+        if(m_size == 1) {
+            release_all();
+            reset();
+            return;
+        }
+        // 尾部只剩一个元素：前缀树中最后一个叶子成为新的尾部
+        Leaf* leaf = leaf_for(m_size - 2);
+        retain(leaf);
+        release_leaf(m_tail, 1);
+        m_root = pop_tail(m_shift, m_root);
+        if(!m_root) {
+            m_shift = bits;
+        } else if(m_shift > bits && !m_root->child[1]) {
+            Inner* root = static_cast<Inner*>(m_root->child[0]);
+            retain(root);
+            release_inner(m_root, m_shift);
+            m_root = root;
+            m_shift -= bits;
+        }
+        m_tail = leaf;
+        --m_size;
+    }
+    void clear() noexcept {
+        release_all();
+        reset();
+    }
+
+    // 迭代器，只读
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator end() const noexcept { return const_iterator(this, m_size); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+    const_reverse_iterator crend() const noexcept { return rend(); }
+
+    // 交换
+    void swap(MyPersistentVector& o) noexcept {
+        using std::swap;
+        swap(m_root, o.m_root);
+        swap(m_tail, o.m_tail);
+        swap(m_size, o.m_size);
+        swap(m_shift, o.m_shift);
+    }
+
+    // 两个向量是否共享同一份存储，用于判断快照是否仍未分叉
+    bool shares_with(const MyPersistentVector& o) const noexcept {
+        return m_root == o.m_root && m_tail == o.m_tail && m_size == o.m_size;
+    }
+
+private:
+    static constexpr size_type mask = branching - 1;
+
+    struct NodeBase {
+        std::atomic<size_type> refs{1};
+    };
+    struct Inner : NodeBase {
+        NodeBase* child[branching] = {};
+    };
+    // 前缀树中的叶子总是满的，只有尾部叶子可能不满
+    struct Leaf : NodeBase {
+        alignas(T) unsigned char storage[branching * sizeof(T)];
+
+        T* data() noexcept { return reinterpret_cast<T*>(storage); }
+    };
+
+    Inner* m_root = nullptr;
+    Leaf* m_tail = nullptr;
+    size_type m_size = 0;
+    size_type m_shift = bits;
+
+    // 辅助函数
+    void reset() noexcept {
+        m_root = nullptr;
+        m_tail = nullptr;
+        m_size = 0;
+        m_shift = bits;
+    }
+    size_type tail_offset() const noexcept { return m_size < branching ? 0 : ((m_size - 1) >> bits) << bits; }
+    size_type tail_count() const noexcept { return m_size - tail_offset(); }
+    Leaf* leaf_for(size_type pos) const noexcept {
+        if(pos >= tail_offset()) {
+            return m_tail;
+        }
+        NodeBase* node = m_root;
+        for(size_type shift = m_shift; shift > 0; shift -= bits) {
+            node = static_cast<Inner*>(node)->child[(pos >> shift) & mask];
+        }
+        return static_cast<Leaf*>(node);
+    }
+
+    static void retain(NodeBase* node) noexcept {
+        if(node) {
+            node->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    static void release_leaf(Leaf* leaf, size_type count) noexcept {
+        if(leaf && leaf->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            std::destroy_n(leaf->data(), count);
+            delete leaf;
+        }
+    }
+    static void release_inner(Inner* node, size_type shift) noexcept {
+        if(node && node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            for(NodeBase* child : node->child) {
+                if(shift == bits) {
+                    release_leaf(static_cast<Leaf*>(child), branching);
+                } else {
+                    release_inner(static_cast<Inner*>(child), shift - bits);
+                }
+            }
+            delete node;
+        }
+    }
+    void release_all() noexcept {
+        release_inner(m_root, m_shift);
+        release_leaf(m_tail, tail_count());
+    }
+    // 节点被共享时复制一份，调用者持有的旧节点引用转移给副本
+    static Inner* unique_inner(Inner* node, size_type shift) {
+        if(node->refs.load(std::memory_order_acquire) == 1) {
+            return node;
+        }
+        Inner* copy = new Inner;
+        for(size_type i = 0; i < branching; ++i) {
+            copy->child[i] = node->child[i];
+            retain(copy->child[i]);
+        }
+        release_inner(node, shift);
+        return copy;
+    }
+    static Leaf* unique_leaf(Leaf* leaf, size_type count) {
+        if(leaf->refs.load(std::memory_order_acquire) == 1) {
+            return leaf;
+        }
+        Leaf* copy = new Leaf;
+        try {
+            std::uninitialized_copy_n(leaf->data(), count, copy->data());
+        } catch(...) {
+            delete copy;
+            throw;
+        }
+        release_leaf(leaf, count);
+        return copy;
+    }
+    T& mutable_at(size_type pos) {
+        if(pos >= m_size) {
+            throw std::out_of_range("MyPersistentVector::set");
+        }
+        if(pos >= tail_offset()) {
+            m_tail = unique_leaf(m_tail, tail_count());
+            return m_tail->data()[pos & mask];
+        }
+        m_root = unique_inner(m_root, m_shift);
+        Inner* node = m_root;
+        for(size_type shift = m_shift; shift > bits; shift -= bits) {
+            NodeBase*& slot = node->child[(pos >> shift) & mask];
+            slot = unique_inner(static_cast<Inner*>(slot), shift - bits);
+            node = static_cast<Inner*>(slot);
+        }
+        NodeBase*& slot = node->child[(pos >> bits) & mask];
+        slot = unique_leaf(static_cast<Leaf*>(slot), branching);
+        return static_cast<Leaf*>(slot)->data()[pos & mask];
+    }
+    // 生成一条只通向 leaf 的新路径
+    static NodeBase* new_path(size_type shift, Leaf* leaf) {
+        if(shift == 0) {
+            return leaf;
+        }
+        Inner* node = new Inner;
+        node->child[0] = new_path(shift - bits, leaf);
+        return node;
+    }
+    // 把已满的尾部挂到前缀树末尾，根满时树高加一
+    void push_tail() {
+        if(!m_root) {
+            m_root = new Inner;
+            m_root->child[0] = m_tail;
+            return;
+        }
+        if((m_size >> bits) > (size_type(1) << m_shift)) {
+            Inner* root = new Inner;
+            root->child[0] = m_root;
+            root->child[1] = new_path(m_shift, m_tail);
+            m_root = root;
+            m_shift += bits;
+            return;
+        }
+        m_root = unique_inner(m_root, m_shift);
+        Inner* node = m_root;
+        for(size_type shift = m_shift; shift > bits; shift -= bits) {
+            NodeBase*& slot = node->child[((m_size - 1) >> shift) & mask];
+            if(!slot) {
+                slot = new_path(shift - bits, m_tail);
+                return;
+            }
+            slot = unique_inner(static_cast<Inner*>(slot), shift - bits);
+            node = static_cast<Inner*>(slot);
+        }
+        node->child[((m_size - 1) >> bits) & mask] = m_tail;
+    }
+    // 从 node 所在子树移除最后一个叶子，返回替换 node 的指针，子树变空时返回 nullptr
+    Inner* pop_tail(size_type shift, Inner* node) {
+        size_type leaf_index = (m_size - 2) >> bits;
+        if((leaf_index & ((size_type(1) << shift) - 1)) == 0) {
+            release_inner(node, shift);
+            return nullptr;
+        }
+        node = unique_inner(node, shift);
+        NodeBase*& slot = node->child[((m_size - 2) >> shift) & mask];
+        if(shift == bits) {
+            release_leaf(static_cast<Leaf*>(slot), branching);
+            slot = nullptr;
+        } else {
+            slot = pop_tail(shift - bits, static_cast<Inner*>(slot));
+        }
+        return node;
+    }
+};
+
+// 随机访问迭代器，缓存当前叶子，顺序遍历时每 32 个元素才走一次树
+template <typename T>
+class MyPersistentVector<T>::const_iterator {
+    friend class MyPersistentVector<T>;
+public:
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = const T&;
+    using pointer = const T*;
+    using iterator_category = std::random_access_iterator_tag;
+
+    const_iterator() : m_vec(nullptr), m_pos(0) {}
+    const_iterator(const MyPersistentVector* vec, size_type pos) : m_vec(vec), m_pos(pos) {}
+
+    reference operator*() const {
+        size_type base = m_pos & ~mask;
+        if(!m_leaf || m_base != base) {
+            m_leaf = m_vec->leaf_for(m_pos)->data();
+            m_base = base;
+        }
+        return m_leaf[m_pos & mask];
+    }
+    pointer operator->() const { return &**this; }
+    reference operator[](difference_type n) const { return *(*this + n); }
+    const_iterator& operator++() {
+        ++m_pos;
+        return *this;
+    }
+    const_iterator operator++(int) {
+        const_iterator tmp(*this);
+        ++m_pos;
+        return tmp;
+    }
+    const_iterator& operator--() {
+        --m_pos;
+        return *this;
+    }
+    const_iterator operator--(int) {
+        const_iterator tmp(*this);
+        --m_pos;
+        return tmp;
+    }
+    const_iterator& operator+=(difference_type n) {
+        m_pos += n;
+        return *this;
+    }
+    const_iterator& operator-=(difference_type n) {
+        m_pos -= n;
+        return *this;
+    }
+    const_iterator operator+(difference_type n) const {
+        const_iterator tmp(*this);
+        return tmp += n;
+    }
+    friend const_iterator operator+(difference_type n, const const_iterator& it) { return it + n; }
+    const_iterator operator-(difference_type n) const {
+        const_iterator tmp(*this);
+        return tmp -= n;
+    }
+    difference_type operator-(const const_iterator& o) const {
+        return static_cast<difference_type>(m_pos) - static_cast<difference_type>(o.m_pos);
+    }
+    bool operator==(const const_iterator& o) const { return m_pos == o.m_pos; }
+    bool operator!=(const const_iterator& o) const { return m_pos != o.m_pos; }
+    bool operator<(const const_iterator& o) const { return m_pos < o.m_pos; }
+    bool operator>(const const_iterator& o) const { return m_pos > o.m_pos; }
+    bool operator<=(const const_iterator& o) const { return m_pos <= o.m_pos; }
+    bool operator>=(const const_iterator& o) const { return m_pos >= o.m_pos; }
+private:
+    const MyPersistentVector* m_vec;
+    size_type m_pos;
+    mutable const T* m_leaf = nullptr;
+    mutable size_type m_base = 0;
+};
+
+template <typename T>
+bool operator==(const MyPersistentVector<T>& lhs, const MyPersistentVector<T>& rhs) {
+    return lhs.size() == rhs.size() && (lhs.shares_with(rhs) || std::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+template <typename T>
+bool operator!=(const MyPersistentVector<T>& lhs, const MyPersistentVector<T>& rhs) {
+    return !(lhs == rhs);
+}
+
+#endif // MY_PERSISTENT_VECTOR_H
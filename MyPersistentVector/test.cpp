@@ -0,0 +1,209 @@
+#include "my_persistent_vector.hpp"
+#include <iostream>
+#include <cassert>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 统计拷贝次数，用于检查修改时只复制被共享的叶子
+struct Counted {
+    static int copies;
+    int value;
+    Counted(int v) : value(v) {}
+    Counted(const Counted& o) : value(o.value) { ++copies; }
+    Counted& operator=(const Counted& o) {
+        value = o.value;
+        return *this;
+    }
+};
+int Counted::copies = 0;
+
+// 辅助函数，用于输出 MyPersistentVector 的内容
+template <typename T>
+void printMyPersistentVector(const MyPersistentVector<T>& vec, const std::string& message = "") {
+    if (!message.empty()) {
+        std::cout << message << ": ";
+    }
+    std::cout << "[";
+    for (size_t i = 0; i < vec.size(); ++i) {
+        std::cout << vec[i];
+        if (i + 1 != vec.size()) {
+            std::cout << ", ";
+        }
+    }
+    std::cout << "]" << std::endl;
+}
+
+template <typename T>
+bool sameAs(const MyPersistentVector<T>& vec, const std::vector<T>& ref) {
+    if (vec.size() != ref.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < ref.size(); ++i) {
+        if (vec[i] != ref[i]) {
+            return false;
+        }
+    }
+    // 迭代器遍历同样需要一致
+    return std::equal(vec.begin(), vec.end(), ref.begin());
+}
+
+int main() {
+    // 1) 构造与 push/pop 测试
+    std::cout << "===== 1) push/pop test =====" << std::endl;
+    {
+        MyPersistentVector<int> vec1;
+        assert(vec1.empty() && vec1.begin() == vec1.end());
+        MyPersistentVector<int> vec2 = {1, 2, 3};
+        MyPersistentVector<int> vec3(5, 7);
+        printMyPersistentVector(vec2, "vec2");
+        assert(vec3.size() == 5 && vec3.back() == 7);
+
+        // 跨越多层树高的增长与收缩
+        std::vector<int> ref;
+        for (int i = 0; i < 40000; ++i) {
+            vec1.push_back(i);
+            ref.push_back(i);
+        }
+        assert(sameAs(vec1, ref));
+        while (vec1.size() > 10) {
+            vec1.pop_back();
+            ref.pop_back();
+            if (ref.size() % 997 == 0) {
+                assert(sameAs(vec1, ref));
+            }
+        }
+        assert(sameAs(vec1, ref));
+        bool thrown = false;
+        try {
+            vec1.at(10);
+        } catch (const std::out_of_range&) {
+            thrown = true;
+        }
+        assert(thrown);
+        MyVector<int> plain(100, 3);
+        MyPersistentVector<int> vec4(plain);
+        assert(vec4.size() == 100 && vec4[99] == 3);
+        std::cout << "push/pop test passed.\n" << std::endl;
+    }
+
+    // 2) 快照隔离测试
+    std::cout << "===== 2) snapshot test =====" << std::endl;
+    {
+        std::mt19937 rng(7);
+        MyPersistentVector<int> vec;
+        std::vector<int> ref;
+        std::vector<std::pair<MyPersistentVector<int>, std::vector<int>>> history;
+        for (int step = 0; step < 30000; ++step) {
+            unsigned op = rng() % 10;
+            if (op < 5 || ref.empty()) {
+                int v = static_cast<int>(rng());
+                vec.push_back(v);
+                ref.push_back(v);
+            } else if (op < 8) {
+                size_t pos = rng() % ref.size();
+                int v = static_cast<int>(rng());
+                vec.set(pos, v);
+                ref[pos] = v;
+            } else {
+                vec.pop_back();
+                ref.pop_back();
+            }
+            if (step % 1500 == 0) {
+                history.emplace_back(vec.snapshot(), ref);
+                assert(history.back().first.shares_with(vec));
+            }
+        }
+        assert(sameAs(vec, ref));
+        // 之后的修改不影响任何历史快照
+        for (auto& h : history) {
+            assert(sameAs(h.first, h.second));
+        }
+        std::cout << "snapshot test passed.\n" << std::endl;
+    }
+
+    // 3) 结构共享测试
+    std::cout << "===== 3) structural sharing test =====" << std::endl;
+    {
+        MyPersistentVector<Counted> vec;
+        for (int i = 0; i < 5000; ++i) {
+            vec.emplace_back(i);
+        }
+        // 未被共享时原地修改，不产生拷贝
+        Counted::copies = 0;
+        for (int i = 0; i < 5000; i += 7) {
+            vec.set(i, Counted(-i));
+        }
+        assert(Counted::copies == 0);
+
+        MyPersistentVector<Counted> snap = vec;
+        assert(Counted::copies == 0 && snap.shares_with(vec));
+        // 修改快照只复制一个叶子
+        vec.set(1234, Counted(1));
+        assert(Counted::copies == 32);
+        vec.set(1235, Counted(2));
+        assert(Counted::copies == 32);
+        assert(snap[1234].value == 1234 && vec[1234].value == 1);
+        assert(!snap.shares_with(vec));
+        std::cout << "structural sharing test passed.\n" << std::endl;
+    }
+
+    // 4) 跨线程读取快照测试
+    std::cout << "===== 4) concurrent snapshot test =====" << std::endl;
+    {
+        MyPersistentVector<int> vec;
+        for (int i = 0; i < 10000; ++i) {
+            vec.push_back(i);
+        }
+        std::vector<std::thread> readers;
+        for (int t = 0; t < 3; ++t) {
+            MyPersistentVector<int> snap = vec.snapshot();
+            long expect = 0;
+            for (int x : vec) {
+                expect += x;
+            }
+            readers.emplace_back([snap, expect] {
+                long sum = 0;
+                for (int x : snap) {
+                    sum += x;
+                }
+                assert(sum == expect);
+            });
+            // 读者线程遍历快照的同时修改原向量
+            for (int i = t; i < 10000; i += 3) {
+                vec.set(i, -1);
+            }
+        }
+        for (auto& th : readers) {
+            th.join();
+        }
+        std::cout << "concurrent snapshot test passed.\n" << std::endl;
+    }
+
+    // 5) 非平凡类型与迭代器测试
+    std::cout << "===== 5) string and iterator test =====" << std::endl;
+    {
+        MyPersistentVector<std::string> vec;
+        for (int i = 0; i < 100; ++i) {
+            vec.push_back(std::string(20, static_cast<char>('a' + i % 26)));
+        }
+        MyPersistentVector<std::string> copy = vec;
+        copy.set(50, "changed");
+        copy.pop_back();
+        assert(vec.size() == 100 && vec[50] == std::string(20, 'y'));
+        assert(copy.size() == 99 && copy[50] == "changed");
+        auto it = vec.begin() + 40;
+        assert(it - vec.begin() == 40 && it[2] == vec[42]);
+        assert(*vec.rbegin() == vec.back());
+        assert(vec != copy);
+        copy = vec;
+        assert(copy == vec);
+        copy.clear();
+        assert(copy.empty() && vec.size() == 100);
+        std::cout << "string and iterator test passed.\n" << std::endl;
+    }
+
+    std::cout << "All MyPersistentVector tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,90 @@
+#include "my_ranges.hpp"
+#include "../MyList/my_list.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+
+using namespace my_views;
+
+std::uint64_t g_sink = 0;
+
+template <typename Fn>
+double timeMs(Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// 每一步都生成一个临时 MyVector 的写法
+template <typename Container>
+MyVector<std::uint64_t> eagerPipeline(const Container& in) {
+    MyVector<std::uint32_t> kept;
+    for (std::uint32_t x : in) {
+        if (x % 3 != 0) {
+            kept.push_back(x);
+        }
+    }
+    MyVector<std::uint64_t> mapped;
+    for (std::uint32_t x : kept) {
+        mapped.push_back(std::uint64_t(x) * x + 1);
+    }
+    MyVector<std::uint64_t> odd;
+    for (std::uint64_t x : mapped) {
+        if (x & 1) {
+            odd.push_back(x);
+        }
+    }
+    return odd;
+}
+
+template <typename Container>
+MyVector<std::uint64_t> lazyPipeline(const Container& in) {
+    return in | filter([](std::uint32_t x) { return x % 3 != 0; })
+              | transform([](std::uint32_t x) { return std::uint64_t(x) * x + 1; })
+              | filter([](std::uint64_t x) { return (x & 1) != 0; })
+              | to<MyVector>();
+}
+
+template <typename Container>
+void run(const char* name, const Container& in) {
+    MyVector<std::uint64_t> a, b;
+    double eager = timeMs([&] { a = eagerPipeline(in); });
+    double lazy = timeMs([&] { b = lazyPipeline(in); });
+    if (!(a == b)) {
+        std::cout << "mismatch" << std::endl;
+        std::exit(1);
+    }
+    // 终端 reduce：完全不生成容器
+    double reduceMs = timeMs([&] {
+        g_sink += in | filter([](std::uint32_t x) { return x % 3 != 0; })
+                     | transform([](std::uint32_t x) { return std::uint64_t(x) * x + 1; })
+                     | filter([](std::uint64_t x) { return (x & 1) != 0; })
+                     | reduce(std::uint64_t(0), [](std::uint64_t acc, std::uint64_t x) { return acc + x; });
+    });
+    std::cout << std::left << std::setw(10) << name << std::right << std::fixed << std::setprecision(1)
+              << "eager " << std::setw(8) << eager << " ms   lazy to<MyVector> " << std::setw(8) << lazy
+              << " ms   lazy reduce " << std::setw(8) << reduceMs << " ms   speedup " << std::setprecision(2)
+              << eager / lazy << "x / " << eager / reduceMs << "x" << std::endl;
+    g_sink += b.size();
+}
+
+// filter -> transform -> filter 三级流水线，比较逐级生成临时容器与惰性视图，参数为元素个数
+int main(int argc, char** argv) {
+    std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : (std::size_t(1) << 24);
+    MyVector<std::uint32_t> v;
+    MyList<std::uint32_t> l;
+    std::uint32_t x = 2463534242u;
+    for (std::size_t i = 0; i < n; ++i) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        v.push_back(x);
+        l.push_back(x);
+    }
+    std::cout << "elements: " << n << std::endl;
+    run("MyVector", v);
+    run("MyList", l);
+    return g_sink == 1 ? 1 : 0;
+}
@@ -0,0 +1,945 @@
+#ifndef MY_RANGES_H
+#define MY_RANGES_H
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <type_traits>
+#include <stdexcept>
+#include <exception>
+
+#include "../MyVector/my_vector.hpp"
+
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#include <coroutine>
+#define MY_RANGES_HAS_COROUTINE 1
+#endif
+#endif
+
+// 惰性视图：filter / transform / take / drop / chunk / zip / enumerate / stride，用 | 串联，
+// 最后用 to / reduce / for_each 求值，中间不生成任何临时容器
+//
+// 每个视图同时提供两种遍历方式：
+// - 迭代器（begin() / end()，end() 为哨兵），可以用在范围 for 里
+// - drive(sink)：把元素逐个推给 sink，sink 返回 false 时停止；终端操作走这条路径，
+//   各级视图的处理逻辑内联进最内层源的一个循环，没有逐级的迭代器比较
+// 相邻的同类视图在串联时直接合并：filter | filter 合并谓词，transform | transform 复合函数，
+// take | take 取较小值，drop | drop 相加，stride | stride 相乘
+//
+// 视图对左值容器只保存引用，容器必须比视图活得久；对右值容器取得其所有权
+// 视图只从头到尾遍历一次源，源可以是只能遍历一次的（如生成器）
+
+// 所有视图的基类，用于识别视图类型
+struct MyViewBase {};
+
+// 视图迭代器的终点
+struct MyViewSentinel {};
+
+// 视图迭代器与哨兵的比较：派生类提供 done()
+template <typename Derived>
+struct MyViewIterator {
+    friend bool operator==(const Derived& it, MyViewSentinel) { return it.done(); }
+    friend bool operator!=(const Derived& it, MyViewSentinel) { return !it.done(); }
+};
+
+namespace my_ranges_detail {
+
+template <typename T>
+using remove_cvref_t = std::remove_cv_t<std::remove_reference_t<T>>;
+
+template <typename R>
+constexpr bool is_view = std::is_base_of<MyViewBase, remove_cvref_t<R>>::value;
+
+template <typename R, typename = void>
+struct has_size : std::false_type {};
+template <typename R>
+struct has_size<R, std::void_t<decltype(std::declval<const R&>().size())>> : std::true_type {};
+
+// 被引用对象本身是视图时沿用它的 value_type 与 sized，否则由容器推出
+template <typename R, typename Reference, bool = is_view<R>>
+struct ref_traits {
+    using value_type = remove_cvref_t<Reference>;
+    static constexpr bool sized = has_size<R>::value;
+};
+template <typename R, typename Reference>
+struct ref_traits<R, Reference, true> {
+    using value_type = typename R::value_type;
+    static constexpr bool sized = R::sized;
+};
+
+template <typename C, typename = void>
+struct has_reserve : std::false_type {};
+template <typename C>
+struct has_reserve<C, std::void_t<decltype(std::declval<C&>().reserve(std::size_t(0)))>> : std::true_type {};
+
+// 饱和加法与乘法，避免 drop / stride 合并时溢出
+inline std::size_t add_sat(std::size_t a, std::size_t b) {
+    return a + b < a ? static_cast<std::size_t>(-1) : a + b;
+}
+inline std::size_t mul_sat(std::size_t a, std::size_t b) {
+    return b != 0 && a > static_cast<std::size_t>(-1) / b ? static_cast<std::size_t>(-1) : a * b;
+}
+
+// 合并后的谓词与函数
+template <typename P1, typename P2>
+struct And {
+    P1 first;
+    P2 second;
+    template <typename X>
+    bool operator()(X&& x) const { return first(x) && second(x); }
+};
+
+template <typename F1, typename F2>
+struct Compose {
+    F1 inner;
+    F2 outer;
+    template <typename X>
+    decltype(auto) operator()(X&& x) const { return outer(inner(std::forward<X>(x))); }
+};
+
+} // namespace my_ranges_detail
+
+// 容器或视图的引用
+template <typename R>
+class MyRefView : public MyViewBase {
+    using base_iterator = decltype(std::declval<R&>().begin());
+    using base_sentinel = decltype(std::declval<R&>().end());
+
+public:
+    class iterator;
+    using reference = decltype(*std::declval<base_iterator&>());
+    using value_type = typename my_ranges_detail::ref_traits<R, reference>::value_type;
+    using size_type = std::size_t;
+    static constexpr bool sized = my_ranges_detail::ref_traits<R, reference>::sized;
+
+    explicit MyRefView(R& r) : m_r(std::addressof(r)) {}
+
+    iterator begin() const { return iterator(m_r->begin(), m_r->end()); }
+    MyViewSentinel end() const { return {}; }
+    size_type size() const { return static_cast<size_type>(m_r->size()); }
+
+    template <typename Sink>
+    bool drive(Sink&& sink) const {
+        if constexpr(my_ranges_detail::is_view<R>) {
+            return m_r->drive(sink);
+        } else {
+            for(auto it = m_r->begin(), last = m_r->end(); it != last; ++it) {
+                if(!sink(*it)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    class iterator : public MyViewIterator<iterator> {
+    public:
+        iterator(base_iterator it, base_sentinel last) : m_it(it), m_last(last) {}
+        bool done() const { return !(m_it != m_last); }
+        reference operator*() const { return *m_it; }
+        iterator& operator++() {
+            ++m_it;
+            return *this;
+        }
+
+    private:
+        base_iterator m_it;
+        base_sentinel m_last;
+    };
+
+private:
+    R* m_r;
+};
+
+// 右值容器的视图：取得容器的所有权，只能移动
+template <typename R>
+class MyOwningView : public MyViewBase {
+public:
+    using reference = typename MyRefView<const R>::reference;
+    using value_type = typename MyRefView<const R>::value_type;
+    using iterator = typename MyRefView<const R>::iterator;
+    using size_type = std::size_t;
+    static constexpr bool sized = MyRefView<const R>::sized;
+
+    explicit MyOwningView(R&& r) : m_r(std::move(r)) {}
+    MyOwningView(MyOwningView&&) = default;
+    MyOwningView& operator=(MyOwningView&&) = default;
+
+    iterator begin() const { return MyRefView<const R>(m_r).begin(); }
+    MyViewSentinel end() const { return {}; }
+    size_type size() const { return static_cast<size_type>(m_r.size()); }
+
+    template <typename Sink>
+    bool drive(Sink&& sink) const { return MyRefView<const R>(m_r).drive(sink); }
+
+private:
+    R m_r;
+};
+
+namespace my_views {
+
+// 把容器或视图转成视图：视图右值原样移动，可复制的视图左值复制，其余左值取引用，容器右值取得所有权
+template <typename R>
+auto all(R&& r) {
+    using D = my_ranges_detail::remove_cvref_t<R>;
+    if constexpr(my_ranges_detail::is_view<D> && (!std::is_lvalue_reference<R>::value || std::is_copy_constructible<D>::value)) {
+        return D(std::forward<R>(r));
+    } else if constexpr(std::is_lvalue_reference<R>::value) {
+        return MyRefView<std::remove_reference_t<R>>(r);
+    } else {
+        return MyOwningView<D>(std::move(r));
+    }
+}
+
+template <typename R>
+using all_t = decltype(all(std::declval<R>()));
+
+} // namespace my_views
+
+template <typename V, typename P>
+class MyFilterView : public MyViewBase {
+public:
+    class iterator;
+    using reference = typename V::reference;
+    using value_type = typename V::value_type;
+    using size_type = std::size_t;
+    static constexpr bool sized = false;
+
+    MyFilterView(V base, P pred) : m_base(std::move(base)), m_pred(std::move(pred)) {}
+
+    const V& base() const& { return m_base; }
+    V base() && { return std::move(m_base); }
+    const P& predicate() const { return m_pred; }
+
+    iterator begin() const { return iterator(this, m_base.begin()); }
+    MyViewSentinel end() const { return {}; }
+
+    template <typename Sink>
+    bool drive(Sink&& sink) const {
+        return m_base.drive([&](auto&& x) { return !m_pred(x) || sink(std::forward<decltype(x)>(x)); });
+    }
+
+    class iterator : public MyViewIterator<iterator> {
+    public:
+        iterator(const MyFilterView* view, typename V::iterator it) : m_view(view), m_it(std::move(it)) { skip(); }
+        bool done() const { return m_it.done(); }
+        reference operator*() const { return *m_it; }
+        iterator& operator++() {
+            ++m_it;
+            skip();
+            return *this;
+        }
+
+    private:
+        const MyFilterView* m_view;
+        typename V::iterator m_it;
+
+        void skip() {
+            while(!m_it.done() && !m_view->m_pred(*m_it)) {
+                ++m_it;
+            }
+        }
+    };
+
+private:
+    V m_base;
+    P m_pred;
+};
+
+template <typename V, typename F>
+class MyTransformView : public MyViewBase {
+public:
+    class iterator;
+    using reference = std::invoke_result_t<const F&, typename V::reference>;
+    using value_type = my_ranges_detail::remove_cvref_t<reference>;
+    using size_type = std::size_t;
+    static constexpr bool sized = V::sized;
+
+    MyTransformView(V base, F fn) : m_base(std::move(base)), m_fn(std::move(fn)) {}
+
+    const V& base() const& { return m_base; }
+    V base() && { return std::move(m_base); }
+    const F& function() const { return m_fn; }
+
+    iterator begin() const { return iterator(this, m_base.begin()); }
+    MyViewSentinel end() const { return {}; }
+    size_type size() const { return m_base.size(); }
+
+    template <typename Sink>
+    bool drive(Sink&& sink) const {
+        return m_base.drive([&](auto&& x) { return sink(m_fn(std::forward<decltype(x)>(x))); });
+    }
+
+    class iterator : public MyViewIterator<iterator> {
+    public:
+        iterator(const MyTransformView* view, typename V::iterator it) : m_view(view), m_it(std::move(it)) {}
+        bool done() const { return m_it.done(); }
+        reference operator*() const { return m_view->m_fn(*m_it); }
+        iterator& operator++() {
+            ++m_it;
+            return *this;
+        }
+
+    private:
+        const MyTransformView* m_view;
+        typename V::iterator m_it;
+    };
+
+private:
+    V m_base;
+    F m_fn;
+};
+
+template <typename V>
+class MyTakeView : public MyViewBase {
+public:
+    class iterator;
+    using reference = typename V::reference;
+    using value_type = typename V::value_type;
+    using size_type = std::size_t;
+    static constexpr bool sized = V::sized;
+
+    MyTakeView(V base, size_type n) : m_base(std::move(base)), m_n(n) {}
+
+    const V& base() const& { return m_base; }
+    V base() && { return std::move(m_base); }
+    size_type count() const { return m_n; }
+
+    iterator begin() const { return iterator(m_base.begin(), m_n); }
+    MyViewSentinel end() const { return {}; }
+    size_type size() const {
+        size_type n = m_base.size();
+        return n < m_n ? n : m_n;
+    }
+
+    template <typename Sink>
+    bool drive(Sink&& sink) const {
+        if(m_n == 0) {
+            return true;
+        }
+        size_type left = m_n;
+        bool stopped = false;
+        m_base.drive([&](auto&& x) {
+            if(!sink(std::forward<decltype(x)>(x))) {
+                stopped = true;
+                return false;
+            }
+            return --left != 0;
+        });
+        return !stopped;
+    }
+
+    class iterator : public MyViewIterator<iterator> {
+    public:
+        iterator(typename V::iterator it, size_type left) : m_it(std::move(it)), m_left(left) {}
+        bool done() const { return m_left == 0 || m_it.done(); }
+        reference operator*() const { return *m_it; }
+        // 取满 n 个后不再推进底层迭代器，避免 filter 等视图多扫描元素
+        iterator& operator++() {
+            if(--m_left != 0) {
+                ++m_it;
+            }
+            return *this;
+        }
+
+    private:
+        typename V::iterator m_it;
+        size_type m_left;
+    };
+
+private:
+    V m_base;
+    size_type m_n;
+};
+
+template <typename V>
+class MyDropView : public MyViewBase {
+public:
+    using iterator = typename V::iterator;
+    using reference = typename V::reference;
+    using value_type = typename V::value_type;
+    using size_type = std::size_t;
+    static constexpr bool sized = V::sized;
+
+    MyDropView(V base, size_type n) : m_base(std::move(base)), m_n(n) {}
+
+    const V& base() const& { return m_base; }
+    V base() && { return std::move(m_base); }
+    size_type count() const { return m_n; }
+
+    iterator begin() const {
+        iterator it = m_base.begin();
+        for(size_type i = 0; i < m_n && !it.done(); ++i) {
+            ++it;
+        }
+        return it;
+    }
+    MyViewSentinel end() const { return {}; }
+    size_type size() const {
+        size_type n = m_base.size();
+        return n > m_n ? n - m_n : 0;
+    }
+
+    template <typename Sink>
+    bool drive(Sink&& sink) const {
+        size_type skip = m_n;
+        return m_base.drive([&](auto&& x) {
+            if(skip != 0) {
+                --skip;
+                return true;
+            }
+            return sink(std::forward<decltype(x)>(x));
+        });
+    }
+
+private:
+    V m_base;
+    size_type m_n;
+};
+
+// 从第一个元素开始每 step 个取一个
+template <typename V>
+class MyStrideView : public MyViewBase {
+public:
+    class iterator;
+    using reference = typename V::reference;
+    using value_type = typename V::value_type;
+    using size_type = std::size_t;
+    static constexpr bool sized = V::sized;
+
+    MyStrideView(V base, size_type step) : m_base(std::move(base)), m_step(step) {
+        if(step == 0) {
+            throw std::invalid_argument("MyStrideView: step must be positive");
+        }
+    }
+
+    const V& base() const& { return m_base; }
+    V base() && { return std::move(m_base); }
+    size_type step() const { return m_step; }
+
+    iterator begin() const { return iterator(m_base.begin(), m_step); }
+    MyViewSentinel end() const { return {}; }
+    size_type size() const { return (m_base.size() + m_step - 1) / m_step; }
+
+    template <typename Sink>
+    bool drive(Sink&& sink) const {
+        size_type phase = 0;
+        return m_base.drive([&](auto&& x) {
+            bool emit = phase == 0;
+            phase = phase + 1 == m_step ? 0 : phase + 1;
+            return !emit || sink(std::forward<decltype(x)>(x));
+        });
+    }
+
+    class iterator : public MyViewIterator<iterator> {
+    public:
+        iterator(typename V::iterator it, size_type step) : m_it(std::move(it)), m_step(step) {}
+        bool done() const { return m_it.done(); }
+        reference operator*() const { return *m_it; }
+        iterator& operator++() {
+            for(size_type i = 0; i < m_step && !m_it.done(); ++i) {
+                ++m_it;
+            }
+            return *this;
+        }
+
+    private:
+        typename V::iterator m_it;
+        size_type m_step;
+    };
+
+private:
+    V m_base;
+    size_type m_step;
+};
+
+// 每 n 个元素一组，最后一组可能不足 n 个
+// 组内元素复制到一个复用的 MyVector 缓冲区，得到的引用在取下一组之前有效；源可以只遍历一次
+template <typename V>
+class MyChunkView : public MyViewBase {
+public:
+    class iterator;
+    using value_type = MyVector<typename V::value_type>;
+    using reference = const value_type&;
+    using size_type = std::size_t;
+    static constexpr bool sized = V::sized;
+
+    MyChunkView(V base, size_type n) : m_base(std::move(base)), m_n(n) {
+        if(n == 0) {
+            throw std::invalid_argument("MyChunkView: chunk size must be positive");
+        }
+    }
+
+    const V& base() const& { return m_base; }
+    size_type chunk_size() const { return m_n; }
+
+    iterator begin() const { return iterator(m_base.begin(), m_n); }
+    MyViewSentinel end() const { return {}; }
+    size_type size() const { return (m_base.size() + m_n - 1) / m_n; }
+
+    template <typename Sink>
+    bool drive(Sink&& sink) const {
+        value_type buf;
+        buf.reserve(m_n);
+        bool stopped = false;
+        m_base.drive([&](auto&& x) {
+            buf.push_back(std::forward<decltype(x)>(x));
+            if(buf.size() < m_n) {
+                return true;
+            }
+            stopped = !sink(static_cast<const value_type&>(buf));
+            buf.clear();
+            return !stopped;
+        });
+        if(!stopped && !buf.empty()) {
+            return sink(static_cast<const value_type&>(buf));
+        }
+        return !stopped;
+    }
+
+    class iterator : public MyViewIterator<iterator> {
+    public:
+        iterator(typename V::iterator it, size_type n) : m_it(std::move(it)), m_n(n) {
+            m_buf.reserve(n);
+            fill();
+        }
+        bool done() const { return m_buf.empty(); }
+        reference operator*() const { return m_buf; }
+        iterator& operator++() {
+            fill();
+            return *this;
+        }
+
+    private:
+        typename V::iterator m_it;
+        size_type m_n;
+        value_type m_buf;
+
+        void fill() {
+            m_buf.clear();
+            for(; m_buf.size() < m_n && !m_it.done(); ++m_it) {
+                m_buf.push_back(*m_it);
+            }
+        }
+    };
+
+private:
+    V m_base;
+    size_type m_n;
+};
+
+// 元素与其下标组成的 pair
+template <typename V>
+class MyEnumerateView : public MyViewBase {
+public:
+    class iterator;
+    using size_type = std::size_t;
+    using reference = std::pair<size_type, typename V::reference>;
+    using value_type = std::pair<size_type, typename V::value_type>;
+    static constexpr bool sized = V::sized;
+
+    explicit MyEnumerateView(V base) : m_base(std::move(base)) {}
+
+    const V& base() const& { return m_base; }
+
+    iterator begin() const { return iterator(m_base.begin()); }
+    MyViewSentinel end() const { return {}; }
+    size_type size() const { return m_base.size(); }
+
+    template <typename Sink>
+    bool drive(Sink&& sink) const {
+        size_type index = 0;
+        return m_base.drive([&](auto&& x) { return sink(reference(index++, std::forward<decltype(x)>(x))); });
+    }
+
+    class iterator : public MyViewIterator<iterator> {
+    public:
+        explicit iterator(typename V::iterator it) : m_it(std::move(it)) {}
+        bool done() const { return m_it.done(); }
+        reference operator*() const { return reference(m_index, *m_it); }
+        iterator& operator++() {
+            ++m_it;
+            ++m_index;
+            return *this;
+        }
+
+    private:
+        typename V::iterator m_it;
+        size_type m_index = 0;
+    };
+
+private:
+    V m_base;
+};
+
+// 两个视图对应位置的元素组成的 pair，长度取较短者
+template <typename V1, typename V2>
+class MyZipView : public MyViewBase {
+public:
+    class iterator;
+    using size_type = std::size_t;
+    using reference = std::pair<typename V1::reference, typename V2::reference>;
+    using value_type = std::pair<typename V1::value_type, typename V2::value_type>;
+    static constexpr bool sized = V1::sized && V2::sized;
+
+    MyZipView(V1 first, V2 second) : m_first(std::move(first)), m_second(std::move(second)) {}
+
+    iterator begin() const { return iterator(m_first.begin(), m_second.begin()); }
+    MyViewSentinel end() const { return {}; }
+    size_type size() const {
+        size_type a = m_first.size();
+        size_type b = m_second.size();
+        return a < b ? a : b;
+    }
+
+    // 第一个视图推送元素，第二个视图用迭代器跟随
+    template <typename Sink>
+    bool drive(Sink&& sink) const {
+        typename V2::iterator other = m_second.begin();
+        bool stopped = false;
+        m_first.drive([&](auto&& x) {
+            if(other.done()) {
+                return false;
+            }
+            if(!sink(reference(std::forward<decltype(x)>(x), *other))) {
+                stopped = true;
+                return false;
+            }
+            ++other;
+            return true;
+        });
+        return !stopped;
+    }
+
+    class iterator : public MyViewIterator<iterator> {
+    public:
+        iterator(typename V1::iterator a, typename V2::iterator b) : m_a(std::move(a)), m_b(std::move(b)) {}
+        bool done() const { return m_a.done() || m_b.done(); }
+        reference operator*() const { return reference(*m_a, *m_b); }
+        iterator& operator++() {
+            ++m_a;
+            ++m_b;
+            return *this;
+        }
+
+    private:
+        typename V1::iterator m_a;
+        typename V2::iterator m_b;
+    };
+
+private:
+    V1 m_first;
+    V2 m_second;
+};
+
+#if defined(MY_RANGES_HAS_COROUTINE)
+// C++20 协程生成器，作为自定义的源接入视图：co_yield 逐个产生元素，只能遍历一次
+// 协程体内抛出的异常在推进迭代器时重新抛出
+template <typename T>
+class MyGenerator : public MyViewBase {
+public:
+    class iterator;
+    using value_type = my_ranges_detail::remove_cvref_t<T>;
+    using reference = const value_type&;
+    using size_type = std::size_t;
+    static constexpr bool sized = false;
+
+    struct promise_type {
+        const value_type* value = nullptr;
+        std::exception_ptr error;
+
+        MyGenerator get_return_object() { return MyGenerator(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        // co_yield 的操作数在协程恢复之前一直有效，保存地址即可
+        std::suspend_always yield_value(const value_type& v) noexcept {
+            value = std::addressof(v);
+            return {};
+        }
+        void return_void() noexcept {}
+        void unhandled_exception() { error = std::current_exception(); }
+    };
+
+    MyGenerator(MyGenerator&& o) noexcept : m_handle(std::exchange(o.m_handle, nullptr)) {}
+    MyGenerator& operator=(MyGenerator&& o) noexcept {
+        if(this != &o) {
+            destroy();
+            m_handle = std::exchange(o.m_handle, nullptr);
+        }
+        return *this;
+    }
+    ~MyGenerator() { destroy(); }
+
+    // 第一次调用时启动协程，之后从当前位置继续
+    iterator begin() const {
+        if(m_handle && !m_handle.done() && m_handle.promise().value == nullptr) {
+            resume(m_handle);
+        }
+        return iterator(m_handle);
+    }
+    MyViewSentinel end() const { return {}; }
+
+    template <typename Sink>
+    bool drive(Sink&& sink) const {
+        for(iterator it = begin(); !it.done(); ++it) {
+            if(!sink(*it)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    class iterator : public MyViewIterator<iterator> {
+    public:
+        explicit iterator(std::coroutine_handle<promise_type> h) : m_h(h) {}
+        bool done() const { return !m_h || m_h.done(); }
+        reference operator*() const { return *m_h.promise().value; }
+        iterator& operator++() {
+            resume(m_h);
+            return *this;
+        }
+
+    private:
+        std::coroutine_handle<promise_type> m_h;
+    };
+
+private:
+    std::coroutine_handle<promise_type> m_handle;
+
+    explicit MyGenerator(std::coroutine_handle<promise_type> h) : m_handle(h) {}
+
+    static void resume(std::coroutine_handle<promise_type> h) {
+        h.resume();
+        if(h.promise().error) {
+            std::rethrow_exception(std::exchange(h.promise().error, nullptr));
+        }
+    }
+
+    void destroy() {
+        if(m_handle) {
+            m_handle.destroy();
+        }
+    }
+};
+#endif
+
+namespace my_views {
+
+// 串联：r | adaptor 等价于 adaptor(r)
+struct MyAdaptorBase {};
+
+template <typename R, typename A, typename = std::enable_if_t<std::is_base_of<MyAdaptorBase, my_ranges_detail::remove_cvref_t<A>>::value>>
+decltype(auto) operator|(R&& r, A&& adaptor) {
+    return std::forward<A>(adaptor)(std::forward<R>(r));
+}
+
+template <typename P>
+struct FilterAdaptor : MyAdaptorBase {
+    P pred;
+
+    template <typename R>
+    auto operator()(R&& r) const {
+        using D = my_ranges_detail::remove_cvref_t<R>;
+        if constexpr(is_filter<D>::value) {
+            using Base = decltype(std::forward<R>(r).base());
+            using Pred = my_ranges_detail::And<my_ranges_detail::remove_cvref_t<decltype(r.predicate())>, P>;
+            return MyFilterView<my_ranges_detail::remove_cvref_t<Base>, Pred>(std::forward<R>(r).base(), Pred{r.predicate(), pred});
+        } else {
+            return MyFilterView<all_t<R>, P>(all(std::forward<R>(r)), pred);
+        }
+    }
+
+private:
+    template <typename D>
+    struct is_filter : std::false_type {};
+    template <typename V, typename Q>
+    struct is_filter<MyFilterView<V, Q>> : std::true_type {};
+};
+
+template <typename F>
+struct TransformAdaptor : MyAdaptorBase {
+    F fn;
+
+    template <typename R>
+    auto operator()(R&& r) const {
+        using D = my_ranges_detail::remove_cvref_t<R>;
+        if constexpr(is_transform<D>::value) {
+            using Base = decltype(std::forward<R>(r).base());
+            using Fn = my_ranges_detail::Compose<my_ranges_detail::remove_cvref_t<decltype(r.function())>, F>;
+            return MyTransformView<my_ranges_detail::remove_cvref_t<Base>, Fn>(std::forward<R>(r).base(), Fn{r.function(), fn});
+        } else {
+            return MyTransformView<all_t<R>, F>(all(std::forward<R>(r)), fn);
+        }
+    }
+
+private:
+    template <typename D>
+    struct is_transform : std::false_type {};
+    template <typename V, typename G>
+    struct is_transform<MyTransformView<V, G>> : std::true_type {};
+};
+
+// take / drop / stride 及其合并规则
+template <template <typename> class View, std::size_t (*Merge)(std::size_t, std::size_t)>
+struct CountAdaptor : MyAdaptorBase {
+    std::size_t n;
+
+    template <typename R>
+    auto operator()(R&& r) const {
+        using D = my_ranges_detail::remove_cvref_t<R>;
+        if constexpr(is_same_view<D>::value) {
+            using Base = my_ranges_detail::remove_cvref_t<decltype(std::forward<R>(r).base())>;
+            std::size_t merged = Merge(count_of(r), n);
+            return View<Base>(std::forward<R>(r).base(), merged);
+        } else {
+            return View<all_t<R>>(all(std::forward<R>(r)), n);
+        }
+    }
+
+private:
+    template <typename D>
+    struct is_same_view : std::false_type {};
+    template <typename V>
+    struct is_same_view<View<V>> : std::true_type {};
+
+    template <typename V>
+    static std::size_t count_of(const MyStrideView<V>& v) { return v.step(); }
+    template <typename V>
+    static std::size_t count_of(const MyTakeView<V>& v) { return v.count(); }
+    template <typename V>
+    static std::size_t count_of(const MyDropView<V>& v) { return v.count(); }
+};
+
+inline std::size_t merge_min(std::size_t a, std::size_t b) { return a < b ? a : b; }
+
+struct ChunkAdaptor : MyAdaptorBase {
+    std::size_t n;
+
+    template <typename R>
+    auto operator()(R&& r) const { return MyChunkView<all_t<R>>(all(std::forward<R>(r)), n); }
+};
+
+struct EnumerateAdaptor : MyAdaptorBase {
+    template <typename R>
+    auto operator()(R&& r) const { return MyEnumerateView<all_t<R>>(all(std::forward<R>(r))); }
+};
+
+template <typename V2>
+struct ZipAdaptor : MyAdaptorBase {
+    V2 other;
+
+    template <typename R>
+    auto operator()(R&& r) const& { return MyZipView<all_t<R>, V2>(all(std::forward<R>(r)), other); }
+    template <typename R>
+    auto operator()(R&& r) && { return MyZipView<all_t<R>, V2>(all(std::forward<R>(r)), std::move(other)); }
+};
+
+// 对容器或视图逐个推送元素
+template <typename R, typename Sink>
+bool drive(R&& r, Sink&& sink) {
+    if constexpr(my_ranges_detail::is_view<R>) {
+        return r.drive(sink);
+    } else {
+        return MyRefView<std::remove_reference_t<R>>(r).drive(sink);
+    }
+}
+
+template <typename C>
+struct ToAdaptor : MyAdaptorBase {
+    template <typename R>
+    C operator()(R&& r) const {
+        C out;
+        if constexpr(my_ranges_detail::has_reserve<C>::value) {
+            if constexpr(all_t<R&>::sized) {
+                out.reserve(all(r).size());
+            }
+        }
+        drive(r, [&out](auto&& x) {
+            out.push_back(std::forward<decltype(x)>(x));
+            return true;
+        });
+        return out;
+    }
+};
+
+template <template <typename...> class C>
+struct ToTemplateAdaptor : MyAdaptorBase {
+    template <typename R>
+    auto operator()(R&& r) const {
+        using T = typename all_t<R&>::value_type;
+        return ToAdaptor<C<T>>()(std::forward<R>(r));
+    }
+};
+
+template <typename T, typename Op>
+struct ReduceAdaptor : MyAdaptorBase {
+    T init;
+    Op op;
+
+    template <typename R>
+    T operator()(R&& r) const {
+        T acc = init;
+        drive(r, [&](auto&& x) {
+            acc = op(std::move(acc), std::forward<decltype(x)>(x));
+            return true;
+        });
+        return acc;
+    }
+};
+
+template <typename F>
+struct ForEachAdaptor : MyAdaptorBase {
+    F fn;
+
+    template <typename R>
+    void operator()(R&& r) const {
+        drive(r, [this](auto&& x) {
+            fn(std::forward<decltype(x)>(x));
+            return true;
+        });
+    }
+};
+
+// 视图
+template <typename P>
+FilterAdaptor<std::decay_t<P>> filter(P&& pred) { return {{}, std::forward<P>(pred)}; }
+
+template <typename F>
+TransformAdaptor<std::decay_t<F>> transform(F&& fn) { return {{}, std::forward<F>(fn)}; }
+
+inline auto take(std::size_t n) { return CountAdaptor<MyTakeView, merge_min>{{}, n}; }
+inline auto drop(std::size_t n) { return CountAdaptor<MyDropView, my_ranges_detail::add_sat>{{}, n}; }
+inline auto stride(std::size_t step) {
+    if(step == 0) {
+        throw std::invalid_argument("my_views::stride");
+    }
+    return CountAdaptor<MyStrideView, my_ranges_detail::mul_sat>{{}, step};
+}
+inline ChunkAdaptor chunk(std::size_t n) {
+    if(n == 0) {
+        throw std::invalid_argument("my_views::chunk");
+    }
+    return {{}, n};
+}
+inline EnumerateAdaptor enumerate() { return {}; }
+
+template <typename R>
+ZipAdaptor<all_t<R>> zip(R&& other) { return {{}, all(std::forward<R>(other))}; }
+
+// 终端操作
+// to<MyVector>() 按视图的 value_type 实例化容器；视图长度已知且容器有 reserve 时一次预留
+template <template <typename...> class C>
+ToTemplateAdaptor<C> to() { return {}; }
+template <typename C>
+ToAdaptor<C> to() { return {}; }
+
+template <typename T, typename Op>
+ReduceAdaptor<T, std::decay_t<Op>> reduce(T init, Op&& op) { return {{}, std::move(init), std::forward<Op>(op)}; }
+
+template <typename F>
+ForEachAdaptor<std::decay_t<F>> for_each(F&& fn) { return {{}, std::forward<F>(fn)}; }
+
+} // namespace my_views
+
+#endif // MY_RANGES_H
@@ -0,0 +1,292 @@
+#include "my_ranges.hpp"
+#include "../MyList/my_list.hpp"
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <stdexcept>
+#include <type_traits>
+
+using namespace my_views;
+
+template <typename Range, typename T>
+bool sameAs(const Range& r, std::initializer_list<T> expect) {
+    auto it = expect.begin();
+    for (auto&& x : r) {
+        if (it == expect.end() || !(x == *it)) {
+            return false;
+        }
+        ++it;
+    }
+    return it == expect.end();
+}
+
+MyVector<int> iota(int first, int last) {
+    MyVector<int> v;
+    for (int i = first; i < last; ++i) {
+        v.push_back(i);
+    }
+    return v;
+}
+
+#if defined(MY_RANGES_HAS_COROUTINE)
+MyGenerator<long> fibonacci() {
+    long a = 0, b = 1;
+    while (true) {
+        co_yield a;
+        long c = a + b;
+        a = b;
+        b = c;
+    }
+}
+
+MyGenerator<std::string> words(int n) {
+    for (int i = 0; i < n; ++i) {
+        co_yield "w" + std::to_string(i);
+    }
+}
+
+MyGenerator<int> failing() {
+    co_yield 1;
+    throw std::runtime_error("generator failed");
+}
+#endif
+
+int main() {
+    std::cout << "===== 1) 容器视图与范围 for =====" << std::endl;
+    {
+        MyVector<int> v = {1, 2, 3, 4};
+        MyList<int> l = {5, 6, 7};
+        assert(sameAs(all(v), {1, 2, 3, 4}));
+        assert(sameAs(all(l), {5, 6, 7}));
+        assert(all(v).size() == 4 && all(l).size() == 3);
+        // 左值容器按引用保存，可以通过视图修改元素
+        v | filter([](int x) { return x % 2 == 0; }) | for_each([](int& x) { x *= 10; });
+        assert(sameAs(v, {1, 20, 3, 40}));
+        for (int& x : l | take(2)) {
+            x = -x;
+        }
+        assert(sameAs(l, {-5, -6, 7}));
+        MyVector<int> empty;
+        assert(sameAs(empty | transform([](int x) { return x + 1; }), std::initializer_list<int>{}));
+        assert((empty | to<MyVector>()).empty());
+    }
+
+    std::cout << "===== 2) filter / transform / take / drop / stride =====" << std::endl;
+    {
+        MyVector<int> v = iota(0, 20);
+        MyList<int> l;
+        for (int x : v) {
+            l.push_back(x);
+        }
+        auto odd = [](int x) { return x % 2 == 1; };
+        auto square = [](int x) { return x * x; };
+
+        assert(sameAs(v | filter(odd) | transform(square) | take(4), {1, 9, 25, 49}));
+        assert(sameAs(l | filter(odd) | transform(square) | take(4), {1, 9, 25, 49}));
+        assert(sameAs(v | drop(17), {17, 18, 19}));
+        assert(sameAs(v | drop(25), std::initializer_list<int>{}));
+        assert(sameAs(v | stride(7), {0, 7, 14}));
+        assert(sameAs(l | drop(3) | stride(5) | take(2), {3, 8}));
+        assert(sameAs(v | take(0), std::initializer_list<int>{}));
+
+        // 迭代器与 drive 两条路径结果一致
+        MyVector<int> a = v | filter(odd) | transform(square) | drop(1) | stride(2) | to<MyVector>();
+        MyVector<int> b;
+        for (int x : v | filter(odd) | transform(square) | drop(1) | stride(2)) {
+            b.push_back(x);
+        }
+        assert(a.size() == 5 && a == b);
+        assert(sameAs(a, {9, 49, 121, 225, 361}));
+
+        int sum = l | transform(square) | reduce(0, [](int acc, int x) { return acc + x; });
+        assert(sum == 2470);
+        std::string joined = v | take(3) | transform([](int x) { return std::to_string(x); })
+                               | reduce(std::string(), [](std::string acc, const std::string& s) { return acc + s; });
+        assert(joined == "012");
+    }
+
+    std::cout << "===== 3) 相邻视图合并 =====" << std::endl;
+    {
+        MyVector<int> v = iota(0, 100);
+        auto even = [](int x) { return x % 2 == 0; };
+        auto by3 = [](int x) { return x % 3 == 0; };
+        auto ff = v | filter(even) | filter(by3);
+        static_assert(std::is_same<std::remove_reference_t<decltype(ff.base())>, const MyRefView<MyVector<int>>>::value,
+                      "filter | filter should fuse into one view");
+        assert(sameAs(ff | take(4), {0, 6, 12, 18}));
+
+        auto tt = v | transform([](int x) { return x + 1; }) | transform([](int x) { return x * 2; });
+        static_assert(std::is_same<std::remove_reference_t<decltype(tt.base())>, const MyRefView<MyVector<int>>>::value,
+                      "transform | transform should fuse into one view");
+        assert(sameAs(tt | take(3), {2, 4, 6}));
+
+        auto t = v | take(10) | take(3) | take(5);
+        assert(t.count() == 3 && t.size() == 3);
+        assert(sameAs(t, {0, 1, 2}));
+        auto d = v | drop(10) | drop(5);
+        assert(d.count() == 15 && d.size() == 85);
+        auto s = v | stride(3) | stride(4);
+        assert(s.step() == 12 && s.size() == 9);
+        assert(sameAs(s | take(3), {0, 12, 24}));
+    }
+
+    std::cout << "===== 4) chunk / enumerate / zip =====" << std::endl;
+    {
+        MyVector<int> v = iota(1, 8);
+        MyVector<MyVector<int>> chunks = v | chunk(3) | to<MyVector>();
+        assert(chunks.size() == 3 && (v | chunk(3)).size() == 3);
+        assert(sameAs(chunks[0], {1, 2, 3}) && sameAs(chunks[1], {4, 5, 6}) && sameAs(chunks[2], {7}));
+        std::size_t n = 0;
+        for (const MyVector<int>& c : v | chunk(3)) {
+            assert(c == chunks[n++]);
+        }
+        assert(n == 3);
+        auto sums = v | chunk(2) | transform([](const MyVector<int>& c) {
+            int s = 0;
+            for (int x : c) {
+                s += x;
+            }
+            return s;
+        });
+        assert(sameAs(sums, {3, 7, 11, 7}));
+        assert((v | chunk(2) | take(2) | to<MyVector>()).size() == 2);
+
+        MyList<char> letters = {'a', 'b', 'c'};
+        std::string s;
+        for (auto [i, c] : letters | enumerate()) {
+            s += std::to_string(i) + c;
+        }
+        assert(s == "0a1b2c");
+        auto pairs = letters | enumerate() | to<MyVector>();
+        static_assert(std::is_same<decltype(pairs), MyVector<std::pair<std::size_t, char>>>::value, "enumerate value_type");
+        assert(pairs.size() == 3 && pairs[2].first == 2 && pairs[2].second == 'c');
+
+        auto zipped = v | zip(letters) | to<MyVector>();
+        assert(zipped.size() == 3 && zipped[1].first == 2 && zipped[1].second == 'b');
+        assert((v | zip(letters)).size() == 3);
+        int dot = v | zip(v | drop(1)) | transform([](auto p) { return p.first * p.second; })
+                    | reduce(0, [](int acc, int x) { return acc + x; });
+        assert(dot == 1 * 2 + 2 * 3 + 3 * 4 + 4 * 5 + 5 * 6 + 6 * 7);
+        MyVector<int> out;
+        for (auto [a, b] : letters | zip(v | stride(2))) {
+            out.push_back(a + b);
+        }
+        assert(sameAs(out, {'a' + 1, 'b' + 3, 'c' + 5}));
+        // 通过 zip 修改第二个容器
+        MyVector<int> target(3, 0);
+        v | zip(target) | for_each([](auto p) { p.second = p.first * 100; });
+        assert(sameAs(target, {100, 200, 300}));
+    }
+
+    std::cout << "===== 5) 终端操作与预留 =====" << std::endl;
+    {
+        MyVector<int> v = iota(0, 1000);
+        MyVector<long> sq = v | transform([](int x) { return long(x) * x; }) | drop(10) | to<MyVector>();
+        // 长度已知时一次预留，没有扩容
+        assert(sq.size() == 990 && sq.capacity() == 990 && sq[0] == 100);
+        MyVector<double> d = v | take(5) | to<MyVector<double>>();
+        assert(d.size() == 5 && d.capacity() == 5 && d[4] == 4.0);
+        MyList<int> l = v | filter([](int x) { return x % 250 == 0; }) | to<MyList>();
+        assert(sameAs(l, {0, 250, 500, 750}));
+        long count = 0;
+        v | stride(10) | for_each([&count](int) { ++count; });
+        assert(count == 100);
+    }
+
+    std::cout << "===== 6) 惰性与提前结束 =====" << std::endl;
+    {
+        MyVector<int> v = iota(0, 1000);
+        int calls = 0;
+        auto counted = [&calls](int x) {
+            ++calls;
+            return x % 10 == 0;
+        };
+        MyVector<int> firsts = v | filter(counted) | take(3) | to<MyVector>();
+        assert(sameAs(firsts, {0, 10, 20}));
+        // 取到第三个满足条件的元素后立即停止
+        assert(calls == 21);
+
+        calls = 0;
+        auto view = v | filter(counted) | take(3);
+        assert(calls == 0);
+        int seen = 0;
+        for (int x : view) {
+            (void)x;
+            ++seen;
+        }
+        assert(seen == 3 && calls == 21);
+
+        calls = 0;
+        auto mapped = v | transform([&calls](int x) {
+            ++calls;
+            return x;
+        });
+        auto it = mapped.begin();
+        assert(calls == 0 && *it == 0 && calls == 1);
+    }
+
+    std::cout << "===== 7) 右值容器 =====" << std::endl;
+    {
+        auto view = iota(0, 10) | filter([](int x) { return x > 6; });
+        assert(sameAs(view, {7, 8, 9}));
+        MyVector<int> out = MyList<int>{3, 1, 2} | transform([](int x) { return x * 2; }) | to<MyVector>();
+        assert(sameAs(out, {6, 2, 4}) && out.capacity() == 3);
+        auto moved = std::move(view);
+        assert(sameAs(moved | take(1), {7}));
+    }
+
+    std::cout << "===== 8) 参数检查 =====" << std::endl;
+    {
+        bool thrown = false;
+        try {
+            stride(0);
+        } catch (const std::invalid_argument&) {
+            thrown = true;
+        }
+        assert(thrown);
+        thrown = false;
+        try {
+            chunk(0);
+        } catch (const std::invalid_argument&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+
+#if defined(MY_RANGES_HAS_COROUTINE)
+    std::cout << "===== 9) 协程生成器 =====" << std::endl;
+    {
+        MyVector<long> fib = fibonacci() | take(10) | to<MyVector>();
+        assert(sameAs(fib, {0L, 1L, 1L, 2L, 3L, 5L, 8L, 13L, 21L, 34L}));
+        long evens = fibonacci() | filter([](long x) { return x % 2 == 0; }) | take(5)
+                     | reduce(0L, [](long acc, long x) { return acc + x; });
+        assert(evens == 0 + 2 + 8 + 34 + 144);
+
+        // 左值生成器按引用使用，遍历会推进它
+        MyGenerator<long> g = fibonacci();
+        assert(sameAs(g | take(3), {0L, 1L, 1L}));
+        assert(sameAs(g | take(2), {1L, 2L}));
+
+        MyVector<std::string> ws = words(7) | stride(3) | to<MyVector>();
+        assert(ws.size() == 3 && ws[2] == "w6");
+        std::size_t chunks = 0;
+        for (const auto& c : words(5) | chunk(2)) {
+            chunks += c.size();
+        }
+        assert(chunks == 5);
+        auto z = words(2) | enumerate() | to<MyVector>();
+        assert(z.size() == 2 && z[1].first == 1 && z[1].second == "w1");
+
+        bool thrown = false;
+        try {
+            failing() | for_each([](int) {});
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+#endif
+
+    std::cout << "All MyRanges tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,491 @@
+#ifndef MY_RANKED_LIST_H
+#define MY_RANKED_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <initializer_list>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <iterator>
+#include <utility>
+
+// 可按位置访问的双向链表：节点同时挂在双向环与一棵按位置排序的 treap 上
+// 环负责 O(1) 的 ++ / --，treap 的子树计数负责 O(log n) 的 nth / index_of
+template <typename T>
+class MyRankedList {
+public:
+    // 类型别名
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+
+    class iterator;
+    class const_iterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    // 构造函数
+    MyRankedList() noexcept { reset_root(); }
+    explicit MyRankedList(size_type count) : MyRankedList() {
+        for(size_type i = 0; i < count; ++i) {
+            emplace(cend());
+        }
+    }
+    MyRankedList(size_type count, const_reference value) : MyRankedList() {
+        for(size_type i = 0; i < count; ++i) {
+            emplace(cend(), value);
+        }
+    }
+    MyRankedList(std::initializer_list<T> init) : MyRankedList() {
+        for(const_reference val : init) {
+            emplace(cend(), val);
+        }
+    }
+    MyRankedList(const MyRankedList& o) : MyRankedList() {
+        for(const_reference val : o) {
+            emplace(cend(), val);
+        }
+    }
+    MyRankedList(MyRankedList&& o) noexcept : MyRankedList() { take_links(o); }
+    // 析构函数
+    ~MyRankedList() { clear(); }
+
+    // 赋值运算符
+    MyRankedList& operator=(const MyRankedList& o) {
+        if(this != &o) {
+            clear();
+            for(const_reference val : o) {
+                emplace(cend(), val);
+            }
+        }
+        return *this;
+    }
+    MyRankedList& operator=(MyRankedList&& o) noexcept {
+        if(this != &o) {
+            clear();
+            take_links(o);
+        }
+        return *this;
+    }
+    MyRankedList& operator=(std::initializer_list<T> init) {
+        clear();
+        for(const_reference val : init) {
+            emplace(cend(), val);
+        }
+        return *this;
+    }
+
+    // 容量
+    size_type size() const noexcept { return count_of(m_tree); }
+    bool empty() const noexcept { return m_tree == nullptr; }
+
+    // 元素访问
+    reference front() {
+        if(empty()) {
+            throw std::out_of_range("MyRankedList::front");
+        }
+        return value_of(m_root.next);
+    }
+    const_reference front() const {
+        if(empty()) {
+            throw std::out_of_range("MyRankedList::front");
+        }
+        return value_of(m_root.next);
+    }
+    reference back() {
+        if(empty()) {
+            throw std::out_of_range("MyRankedList::back");
+        }
+        return value_of(m_root.prev);
+    }
+    const_reference back() const {
+        if(empty()) {
+            throw std::out_of_range("MyRankedList::back");
+        }
+        return value_of(m_root.prev);
+    }
+
+    // 按位置访问，k == size() 时返回 end()
+    iterator nth(size_type k) {
+        if(k > size()) {
+            throw std::out_of_range("MyRankedList::nth");
+        }
+        return iterator(k == size() ? root() : node_at(k));
+    }
+    const_iterator nth(size_type k) const {
+        if(k > size()) {
+            throw std::out_of_range("MyRankedList::nth");
+        }
+        return const_iterator(k == size() ? root() : node_at(k));
+    }
+    // 迭代器所指元素的位置，end() 返回 size()
+    size_type index_of(const_iterator pos) const noexcept {
+        return pos.m_node == root() ? size() : rank_of(static_cast<Node*>(pos.m_node));
+    }
+
+    // 修改器
+    // 在迭代器旁插入只需 O(1) 定位，沿父链更新计数与旋转为 O(log n)
+    void push_front(const_reference val) { emplace(cbegin(), val); }
+    void push_front(T&& val) { emplace(cbegin(), std::move(val)); }
+    void push_back(const_reference val) { emplace(cend(), val); }
+    void push_back(T&& val) { emplace(cend(), std::move(val)); }
+    template <typename... Args>
+    reference emplace_front(Args&&... args) { return *emplace(cbegin(), std::forward<Args>(args)...); }
+    template <typename... Args>
+    reference emplace_back(Args&&... args) { return *emplace(cend(), std::forward<Args>(args)...); }
+    void pop_front() {
+        if(empty()) {
+            throw std::out_of_range("MyRankedList::pop_front");
+        }
+        erase(cbegin());
+    }
+    void pop_back() {
+        if(empty()) {
+            throw std::out_of_range("MyRankedList::pop_back");
+        }
+        erase(--cend());
+    }
+    iterator insert(const_iterator pos, const_reference val) { return emplace(pos, val); }
+    iterator insert(const_iterator pos, T&& val) { return emplace(pos, std::move(val)); }
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        Node* n = create_node(std::forward<Args>(args)...);
+        attach(n, pos.m_node);
+        return iterator(n);
+    }
+    iterator insert_at(size_type k, const_reference val) { return emplace(nth(k), val); }
+    iterator insert_at(size_type k, T&& val) { return emplace(nth(k), std::move(val)); }
+    template <typename... Args>
+    iterator emplace_at(size_type k, Args&&... args) { return emplace(nth(k), std::forward<Args>(args)...); }
+    iterator erase(const_iterator pos) {
+        if(pos.m_node == root()) {
+            throw std::out_of_range("MyRankedList::erase");
+        }
+        NodeBase* next = pos.m_node->next;
+        Node* n = static_cast<Node*>(pos.m_node);
+        detach(n);
+        destroy_node(n);
+        return iterator(next);
+    }
+    iterator erase(const_iterator first, const_iterator last) {
+        while(first != last) {
+            first = erase(first);
+        }
+        return iterator(last.m_node);
+    }
+    iterator erase_at(size_type k) {
+        if(k >= size()) {
+            throw std::out_of_range("MyRankedList::erase_at");
+        }
+        return erase(const_iterator(node_at(k)));
+    }
+    void clear() noexcept {
+        for(NodeBase* p = m_root.next; p != &m_root;) {
+            NodeBase* next = p->next;
+            destroy_node(static_cast<Node*>(p));
+            p = next;
+        }
+        reset_root();
+    }
+    // 缩小时直接定位到第 count 个元素
+    void resize(size_type count) {
+        if(count < size()) {
+            erase(nth(count), cend());
+        }
+        while(size() < count) {
+            emplace(cend());
+        }
+    }
+    void resize(size_type count, const_reference value) {
+        if(count < size()) {
+            erase(nth(count), cend());
+        }
+        while(size() < count) {
+            emplace(cend(), value);
+        }
+    }
+
+    // 迭代器
+    iterator begin() noexcept { return iterator(m_root.next); }
+    const_iterator begin() const noexcept { return const_iterator(m_root.next); }
+    iterator end() noexcept { return iterator(root()); }
+    const_iterator end() const noexcept { return const_iterator(root()); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator crend() const noexcept { return const_reverse_iterator(begin()); }
+
+    // 交换
+    void swap(MyRankedList& o) noexcept {
+        MyRankedList tmp(std::move(o));
+        o.take_links(*this);
+        take_links(tmp);
+    }
+
+private:
+    struct NodeBase {
+        NodeBase* prev;
+        NodeBase* next;
+    };
+    // treap 按位置排序，priority 满足小根堆
+    struct Node : NodeBase {
+        Node* parent;
+        Node* left;
+        Node* right;
+        size_type count;
+        std::uint32_t priority;
+        T data;
+
+        template <typename... Args>
+        explicit Node(std::in_place_t, Args&&... args) : data(std::forward<Args>(args)...) {}
+    };
+    using node_allocator = std::allocator<Node>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    NodeBase m_root;
+    Node* m_tree = nullptr;
+    std::uint32_t m_seed = 2463534242u;
+    node_allocator m_alloc;
+
+    // 辅助函数
+    NodeBase* root() const noexcept { return const_cast<NodeBase*>(&m_root); }
+    static T& value_of(NodeBase* n) noexcept { return static_cast<Node*>(n)->data; }
+    static size_type count_of(const Node* n) noexcept { return n ? n->count : 0; }
+    void reset_root() noexcept {
+        m_root.prev = &m_root;
+        m_root.next = &m_root;
+        m_tree = nullptr;
+    }
+    // 接管 o 的全部节点，o 变为空链表；调用前本链表必须为空
+    void take_links(MyRankedList& o) noexcept {
+        if(o.m_tree) {
+            m_root = o.m_root;
+            m_root.next->prev = &m_root;
+            m_root.prev->next = &m_root;
+            m_tree = o.m_tree;
+        }
+        m_seed = o.m_seed;
+        o.reset_root();
+    }
+    // xorshift32
+    std::uint32_t next_priority() noexcept {
+        m_seed ^= m_seed << 13;
+        m_seed ^= m_seed >> 17;
+        m_seed ^= m_seed << 5;
+        return m_seed;
+    }
+    template <typename... Args>
+    Node* create_node(Args&&... args) {
+        Node* n = node_traits::allocate(m_alloc, 1);
+        try {
+            node_traits::construct(m_alloc, n, std::in_place, std::forward<Args>(args)...);
+        } catch(...) {
+            node_traits::deallocate(m_alloc, n, 1);
+            throw;
+        }
+        return n;
+    }
+    void destroy_node(Node* n) noexcept {
+        node_traits::destroy(m_alloc, n);
+        node_traits::deallocate(m_alloc, n, 1);
+    }
+    Node* node_at(size_type k) const noexcept {
+        Node* n = m_tree;
+        for(;;) {
+            size_type l = count_of(n->left);
+            if(k < l) {
+                n = n->left;
+            } else if(k == l) {
+                return n;
+            } else {
+                k -= l + 1;
+                n = n->right;
+            }
+        }
+    }
+    static size_type rank_of(const Node* n) noexcept {
+        size_type r = count_of(n->left);
+        for(; n->parent; n = n->parent) {
+            if(n == n->parent->right) {
+                r += count_of(n->parent->left) + 1;
+            }
+        }
+        return r;
+    }
+    void replace_child(Node* parent, Node* old_child, Node* new_child) noexcept {
+        if(!parent) {
+            m_tree = new_child;
+        } else if(parent->left == old_child) {
+            parent->left = new_child;
+        } else {
+            parent->right = new_child;
+        }
+    }
+    // 将 x 旋转到其父节点的位置，只需重算两个节点的计数
+    void rotate_up(Node* x) noexcept {
+        Node* p = x->parent;
+        if(x == p->left) {
+            p->left = x->right;
+            if(x->right) {
+                x->right->parent = p;
+            }
+            x->right = p;
+        } else {
+            p->right = x->left;
+            if(x->left) {
+                x->left->parent = p;
+            }
+            x->left = p;
+        }
+        replace_child(p->parent, p, x);
+        x->parent = p->parent;
+        p->parent = x;
+        p->count = count_of(p->left) + count_of(p->right) + 1;
+        x->count = count_of(x->left) + count_of(x->right) + 1;
+    }
+    // 将 n 插入到 pos 之前：pos 无左子树时作为其左孩子，否则作为前驱的右孩子
+    void attach(Node* n, NodeBase* pos) noexcept {
+        n->left = nullptr;
+        n->right = nullptr;
+        n->count = 1;
+        n->priority = next_priority();
+        NodeBase* prev = pos->prev;
+        if(pos != &m_root && !static_cast<Node*>(pos)->left) {
+            n->parent = static_cast<Node*>(pos);
+            n->parent->left = n;
+        } else if(prev != &m_root) {
+            n->parent = static_cast<Node*>(prev);
+            n->parent->right = n;
+        } else {
+            n->parent = nullptr;
+            m_tree = n;
+        }
+        n->prev = prev;
+        n->next = pos;
+        prev->next = n;
+        pos->prev = n;
+        for(Node* a = n->parent; a; a = a->parent) {
+            ++a->count;
+        }
+        while(n->parent && n->priority < n->parent->priority) {
+            rotate_up(n);
+        }
+    }
+    // 将 n 旋转到至多只有一个孩子，再由孩子顶替其位置
+    void detach(Node* n) noexcept {
+        while(n->left && n->right) {
+            rotate_up(n->left->priority < n->right->priority ? n->left : n->right);
+        }
+        Node* child = n->left ? n->left : n->right;
+        if(child) {
+            child->parent = n->parent;
+        }
+        replace_child(n->parent, n, child);
+        for(Node* a = n->parent; a; a = a->parent) {
+            --a->count;
+        }
+        n->prev->next = n->next;
+        n->next->prev = n->prev;
+    }
+};
+
+template <typename T>
+class MyRankedList<T>::iterator {
+    friend class MyRankedList<T>;
+public:
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using pointer = T*;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    iterator() : m_node(nullptr) {}
+    explicit iterator(NodeBase* node) : m_node(node) {}
+
+    reference operator*() const { return value_of(m_node); }
+    pointer operator->() const { return &value_of(m_node); }
+    iterator& operator++() {
+        m_node = m_node->next;
+        return *this;
+    }
+    iterator operator++(int) {
+        iterator tmp(*this);
+        m_node = m_node->next;
+        return tmp;
+    }
+    iterator& operator--() {
+        m_node = m_node->prev;
+        return *this;
+    }
+    iterator operator--(int) {
+        iterator tmp(*this);
+        m_node = m_node->prev;
+        return tmp;
+    }
+    bool operator==(const iterator& o) const { return m_node == o.m_node; }
+    bool operator!=(const iterator& o) const { return m_node != o.m_node; }
+private:
+    NodeBase* m_node;
+};
+
+template <typename T>
+class MyRankedList<T>::const_iterator {
+    friend class MyRankedList<T>;
+public:
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = const T&;
+    using pointer = const T*;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    const_iterator() : m_node(nullptr) {}
+    explicit const_iterator(NodeBase* node) : m_node(node) {}
+    const_iterator(const iterator& o) : m_node(o.m_node) {}
+
+    reference operator*() const { return value_of(m_node); }
+    pointer operator->() const { return &value_of(m_node); }
+    const_iterator& operator++() {
+        m_node = m_node->next;
+        return *this;
+    }
+    const_iterator operator++(int) {
+        const_iterator tmp(*this);
+        m_node = m_node->next;
+        return tmp;
+    }
+    const_iterator& operator--() {
+        m_node = m_node->prev;
+        return *this;
+    }
+    const_iterator operator--(int) {
+        const_iterator tmp(*this);
+        m_node = m_node->prev;
+        return tmp;
+    }
+    bool operator==(const const_iterator& o) const { return m_node == o.m_node; }
+    bool operator!=(const const_iterator& o) const { return m_node != o.m_node; }
+private:
+    NodeBase* m_node;
+};
+
+template <typename T>
+bool operator==(const MyRankedList<T>& lhs, const MyRankedList<T>& rhs) {
+    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename T>
+bool operator!=(const MyRankedList<T>& lhs, const MyRankedList<T>& rhs) {
+    return !(lhs == rhs);
+}
+
+#endif // MY_RANKED_LIST_H
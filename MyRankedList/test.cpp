@@ -0,0 +1,168 @@
+#include "my_ranked_list.hpp"
+#include <iostream>
+#include <cassert>
+#include <list>
+#include <random>
+#include <string>
+
+// 辅助函数，用于输出 MyRankedList 的内容
+template <typename T>
+void printMyRankedList(const MyRankedList<T>& lst, const std::string& message = "") {
+    if (!message.empty()) {
+        std::cout << message << ": ";
+    }
+    std::cout << "[";
+    for (auto it = lst.begin(); it != lst.end(); ++it) {
+        std::cout << *it;
+        auto temp = it;
+        ++temp;
+        if (temp != lst.end()) {
+            std::cout << ", ";
+        }
+    }
+    std::cout << "]" << std::endl;
+}
+
+template <typename T>
+bool sameAs(const MyRankedList<T>& lst, const std::list<T>& ref) {
+    if (lst.size() != ref.size()) {
+        return false;
+    }
+    auto it = ref.begin();
+    for (const T& x : lst) {
+        if (x != *it++) {
+            return false;
+        }
+    }
+    // 反向遍历同样需要一致
+    auto rit = ref.rbegin();
+    for (auto r = lst.rbegin(); r != lst.rend(); ++r) {
+        if (*r != *rit++) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+    // 1) 构造函数测试
+    std::cout << "===== 1) Constructor test =====" << std::endl;
+    {
+        MyRankedList<int> list1;
+        assert(list1.empty() && list1.begin() == list1.end());
+
+        MyRankedList<int> list2(10, 7);
+        assert(list2.size() == 10);
+        for (int x : list2) {
+            assert(x == 7);
+        }
+
+        MyRankedList<int> list3 = {1, 2, 3, 4, 5};
+        MyRankedList<int> list4(list3);
+        assert(list3 == list4);
+        printMyRankedList(list4, "list4 copy of list3");
+
+        MyRankedList<int> list5(std::move(list4));
+        assert(list5 == list3 && list4.empty());
+        // 被移动的链表可以继续使用
+        list4.push_back(1);
+        assert(list4.size() == 1 && list4.front() == 1);
+        std::cout << "Constructor test passed.\n" << std::endl;
+    }
+
+    // 2) nth / index_of 测试
+    std::cout << "===== 2) nth/index_of test =====" << std::endl;
+    {
+        MyRankedList<int> listA;
+        for (int i = 0; i < 1000; ++i) {
+            listA.push_back(i);
+        }
+        for (int i = 0; i < 1000; i += 37) {
+            auto it = listA.nth(i);
+            assert(*it == i && listA.index_of(it) == static_cast<size_t>(i));
+        }
+        assert(listA.nth(1000) == listA.end());
+        assert(listA.index_of(listA.end()) == 1000);
+        bool thrown = false;
+        try {
+            listA.nth(1001);
+        } catch (const std::out_of_range&) {
+            thrown = true;
+        }
+        assert(thrown);
+        const MyRankedList<int>& clistA = listA;
+        assert(*clistA.nth(999) == 999);
+        std::cout << "nth/index_of test passed.\n" << std::endl;
+    }
+
+    // 3) 按位置插入删除与迭代器稳定性测试
+    std::cout << "===== 3) insert_at/erase_at test =====" << std::endl;
+    {
+        MyRankedList<int> listB = {0, 1, 2, 3, 4};
+        auto three = listB.nth(3);
+        assert(*listB.insert_at(0, -1) == -1);
+        assert(*listB.insert_at(6, 5) == 5);
+        assert(*listB.emplace_at(3, 100) == 100);
+        // 其他位置的插入不影响已有迭代器
+        assert(*three == 3 && listB.index_of(three) == 5);
+        auto it = listB.erase_at(3);
+        assert(*it == 2);
+        listB.erase(three);
+        printMyRankedList(listB, "listB after insert_at/erase_at");
+        assert((listB == MyRankedList<int>{-1, 0, 1, 2, 4, 5}));
+        listB.resize(2);
+        assert((listB == MyRankedList<int>{-1, 0}));
+        listB.resize(4, 9);
+        assert(listB.back() == 9 && listB.index_of(--listB.end()) == 3);
+        std::cout << "insert_at/erase_at test passed.\n" << std::endl;
+    }
+
+    // 4) 随机操作与 std::list 对比
+    std::cout << "===== 4) randomized test =====" << std::endl;
+    {
+        std::mt19937 rng(42);
+        MyRankedList<int> lst;
+        std::list<int> ref;
+        for (int step = 0; step < 20000; ++step) {
+            size_t pos = ref.empty() ? 0 : rng() % (ref.size() + 1);
+            auto rit = ref.begin();
+            std::advance(rit, pos);
+            if (rng() % 3 != 0 || ref.empty()) {
+                int v = static_cast<int>(rng() % 1000);
+                auto it = lst.insert_at(pos, v);
+                assert(*it == v && lst.index_of(it) == pos);
+                ref.insert(rit, v);
+            } else if (rit != ref.end()) {
+                lst.erase(lst.nth(pos));
+                ref.erase(rit);
+            }
+        }
+        assert(sameAs(lst, ref));
+        size_t k = 0;
+        for (auto it = lst.begin(); it != lst.end(); ++it, ++k) {
+            assert(lst.index_of(it) == k && lst.nth(k) == it);
+        }
+        std::cout << "randomized test passed.\n" << std::endl;
+    }
+
+    // 5) 非平凡类型与 swap 测试
+    std::cout << "===== 5) string and swap test =====" << std::endl;
+    {
+        MyRankedList<std::string> listC = {"a", "b", "c", "d"};
+        MyRankedList<std::string> listD = {"x"};
+        listC.emplace(++listC.begin(), 5, 'z');
+        listC.swap(listD);
+        assert(listC.size() == 1 && listC.front() == "x");
+        assert(listD.size() == 5 && *listD.nth(1) == "zzzzz");
+        printMyRankedList(listD, "listD after swap");
+        listD.pop_front();
+        listD.pop_back();
+        assert(listD.front() == "zzzzz" && listD.back() == "c");
+        listC = listD;
+        assert(listC == listD);
+        std::cout << "string and swap test passed.\n" << std::endl;
+    }
+
+    std::cout << "All MyRankedList tests passed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,67 @@
+#include "my_soa_vector.hpp"
+#include "../MyVector/my_vector.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+
+// 十个字段的粒子，更新循环只读写其中两个
+struct Particle {
+    float x, y, z;
+    float vx, vy, vz;
+    float mass, charge;
+    int id, flags;
+};
+
+using ParticleColumns = MySoAVector<float, float, float, float, float, float, float, float, int, int>;
+
+double g_sink = 0;
+
+template <typename F>
+double timeMs(F fn, int rounds) {
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        fn();
+    }
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count() / rounds;
+}
+
+int main(int argc, char** argv) {
+    std::size_t n = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 4000000;
+    int rounds = 20;
+    const float dt = 0.01f;
+
+    MyVector<Particle> aos;
+    ParticleColumns soa;
+    aos.reserve(n);
+    soa.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        float f = static_cast<float>(i % 1000);
+        aos.push_back(Particle{f, f, f, 1.0f, 2.0f, 3.0f, 1.0f, 0.0f, static_cast<int>(i), 0});
+        soa.push_back(f, f, f, 1.0f, 2.0f, 3.0f, 1.0f, 0.0f, static_cast<int>(i), 0);
+    }
+
+    double aosMs = timeMs([&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            aos[i].x += aos[i].vx * dt;
+        }
+    }, rounds);
+    double soaMs = timeMs([&] {
+        float* x = soa.data<0>();
+        const float* vx = soa.data<3>();
+        for (std::size_t i = 0; i < n; ++i) {
+            x[i] += vx[i] * dt;
+        }
+    }, rounds);
+    for (std::size_t i = 0; i < n; i += 4096) {
+        g_sink += aos[i].x + soa.get<0>(i);
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "particles: " << n << ", x += vx * dt" << std::endl;
+    std::cout << "MyVector<Particle>: " << aosMs << " ms/round" << std::endl;
+    std::cout << "MySoAVector:        " << soaMs << " ms/round" << std::endl;
+    std::cout << "speedup:            " << aosMs / soaMs << "x" << std::endl;
+    return g_sink == 0.5 ? 1 : 0;
+}
@@ -0,0 +1,421 @@
+#ifndef MY_SOA_VECTOR_H
+#define MY_SOA_VECTOR_H
+
+#include <cstddef>
+#include <new>
+#include <memory>
+#include <tuple>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <iterator>
+#include <utility>
+
+// 按列存储的动态数组：每个字段存放在各自连续、按缓存行对齐的数组中，所有列共享 size 与 capacity
+// 只访问少数字段的循环只会把这几列读入缓存，且每列都是可向量化的连续数组
+template <typename... Fields>
+class MySoAVector {
+    static_assert(sizeof...(Fields) > 0, "MySoAVector requires at least one field");
+
+    template <bool Const>
+    class basic_iterator;
+
+public:
+    // 类型别名
+    using value_type = std::tuple<Fields...>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::tuple<Fields&...>;
+    using const_reference = std::tuple<const Fields&...>;
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+    template <std::size_t I>
+    using field_type = std::tuple_element_t<I, value_type>;
+
+    static constexpr std::size_t column_count = sizeof...(Fields);
+    // 每列起始地址的对齐字节数，满足 AVX-512 对齐加载
+    static constexpr std::size_t alignment = 64;
+
+    // 单列的连续视图
+    template <typename U>
+    class column_view {
+    public:
+        column_view(U* data, size_type size) noexcept : m_data(data), m_size(size) {}
+        U* data() const noexcept { return m_data; }
+        size_type size() const noexcept { return m_size; }
+        bool empty() const noexcept { return m_size == 0; }
+        U& operator[](size_type pos) const noexcept { return m_data[pos]; }
+        U* begin() const noexcept { return m_data; }
+        U* end() const noexcept { return m_data + m_size; }
+
+    private:
+        U* m_data;
+        size_type m_size;
+    };
+
+    // 构造函数
+    MySoAVector() noexcept = default;
+    explicit MySoAVector(size_type cnt) : MySoAVector() { resize(cnt); }
+    // 委托默认构造后对象已完整构造，中途抛出异常时由析构函数释放
+    MySoAVector(const MySoAVector& o) : MySoAVector() {
+        reserve(o.m_size);
+        for(; m_size < o.m_size; ++m_size) {
+            construct_row(m_size, [&](auto I, auto* p) {
+                ::new (static_cast<void*>(p)) field_type<I>(std::get<I>(o.m_columns)[m_size]);
+            });
+        }
+    }
+    MySoAVector(MySoAVector&& o) noexcept
+        : m_columns(std::exchange(o.m_columns, std::tuple<Fields*...>{})),
+          m_size(std::exchange(o.m_size, 0)),
+          m_capacity(std::exchange(o.m_capacity, 0)) {}
+
+    // 析构函数
+    ~MySoAVector() {
+        clear();
+        deallocate_columns(m_columns);
+    }
+
+    // 赋值运算符
+    MySoAVector& operator=(const MySoAVector& o) {
+        if(this != &o) {
+            MySoAVector tmp(o);
+            swap(tmp);
+        }
+        return *this;
+    }
+    MySoAVector& operator=(MySoAVector&& o) noexcept {
+        if(this != &o) {
+            MySoAVector tmp(std::move(o));
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    // 容量
+    size_type size() const noexcept { return m_size; }
+    size_type capacity() const noexcept { return m_capacity; }
+    bool empty() const noexcept { return m_size == 0; }
+    void reserve(size_type n) {
+        if(n > m_capacity) {
+            allocate_space(n);
+        }
+    }
+    void shrink_to_fit() {
+        if(m_capacity > m_size) {
+            allocate_space(m_size);
+        }
+    }
+
+    // 元素访问，整行以引用元组返回，可用结构化绑定读写
+    reference operator[](size_type pos) noexcept { return row(pos, std::index_sequence_for<Fields...>{}); }
+    const_reference operator[](size_type pos) const noexcept { return row(pos, std::index_sequence_for<Fields...>{}); }
+    reference at(size_type pos) {
+        if(pos >= m_size) {
+            throw std::out_of_range("MySoAVector::at");
+        }
+        return (*this)[pos];
+    }
+    const_reference at(size_type pos) const {
+        if(pos >= m_size) {
+            throw std::out_of_range("MySoAVector::at");
+        }
+        return (*this)[pos];
+    }
+    reference front() noexcept { return (*this)[0]; }
+    const_reference front() const noexcept { return (*this)[0]; }
+    reference back() noexcept { return (*this)[m_size - 1]; }
+    const_reference back() const noexcept { return (*this)[m_size - 1]; }
+    // 单个字段
+    template <std::size_t I>
+    field_type<I>& get(size_type pos) noexcept { return std::get<I>(m_columns)[pos]; }
+    template <std::size_t I>
+    const field_type<I>& get(size_type pos) const noexcept { return std::get<I>(m_columns)[pos]; }
+
+    // 列访问，data<I>() 按 alignment 对齐，扩容后失效
+    template <std::size_t I>
+    field_type<I>* data() noexcept { return std::get<I>(m_columns); }
+    template <std::size_t I>
+    const field_type<I>* data() const noexcept { return std::get<I>(m_columns); }
+    template <std::size_t I>
+    column_view<field_type<I>> column() noexcept { return {data<I>(), m_size}; }
+    template <std::size_t I>
+    column_view<const field_type<I>> column() const noexcept { return {data<I>(), m_size}; }
+
+    // 修改器
+    void push_back(const Fields&... vals) { emplace_row(std::forward_as_tuple(vals...)); }
+    void push_back(Fields&&... vals) { emplace_row(std::forward_as_tuple(std::move(vals)...)); }
+    void push_back(const value_type& val) { emplace_row(val); }
+    void push_back(value_type&& val) { emplace_row(std::move(val)); }
+    void pop_back() {
+        if(m_size > 0) {
+            destroy_row(--m_size);
+        }
+    }
+    iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+    iterator erase(const_iterator first, const_iterator last) {
+        if(first.m_vec != this || first.m_pos > last.m_pos || last.m_pos > m_size || first.m_pos == last.m_pos) {
+            throw std::out_of_range("MySoAVector::erase");
+        }
+        size_type gap = last.m_pos - first.m_pos;
+        for_each_column([&](auto I) {
+            field_type<I>* col = std::get<I>(m_columns);
+            std::move(col + last.m_pos, col + m_size, col + first.m_pos);
+        });
+        for(size_type i = m_size - gap; i < m_size; ++i) {
+            destroy_row(i);
+        }
+        m_size -= gap;
+        return iterator(this, first.m_pos);
+    }
+    void clear() noexcept {
+        for(size_type i = 0; i < m_size; ++i) {
+            destroy_row(i);
+        }
+        m_size = 0;
+    }
+    // 新增的行逐字段值初始化
+    void resize(size_type n) {
+        if(n > m_capacity) {
+            allocate_space(n);
+        }
+        for(; m_size < n; ++m_size) {
+            construct_row(m_size, [](auto I, auto* p) {
+                ::new (static_cast<void*>(p)) field_type<I>();
+            });
+        }
+        while(m_size > n) {
+            destroy_row(--m_size);
+        }
+    }
+    void resize(size_type n, const value_type& val) {
+        if(n > m_capacity) {
+            allocate_space(n);
+        }
+        for(; m_size < n; ++m_size) {
+            construct_row(m_size, [&](auto I, auto* p) {
+                ::new (static_cast<void*>(p)) field_type<I>(std::get<I>(val));
+            });
+        }
+        while(m_size > n) {
+            destroy_row(--m_size);
+        }
+    }
+    // 交换两行的所有字段
+    void swap_rows(size_type a, size_type b) {
+        using std::swap;
+        for_each_column([&](auto I) {
+            swap(std::get<I>(m_columns)[a], std::get<I>(m_columns)[b]);
+        });
+    }
+
+    // 迭代器
+    iterator begin() noexcept { return iterator(this, 0); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    iterator end() noexcept { return iterator(this, m_size); }
+    const_iterator end() const noexcept { return const_iterator(this, m_size); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    // 交换
+    void swap(MySoAVector& o) noexcept {
+        std::swap(m_columns, o.m_columns);
+        std::swap(m_size, o.m_size);
+        std::swap(m_capacity, o.m_capacity);
+    }
+
+private:
+    std::tuple<Fields*...> m_columns{};
+    size_type m_size = 0;
+    size_type m_capacity = 0;
+
+    template <typename F, std::size_t... I>
+    static void for_each_column_impl(F& f, std::index_sequence<I...>) {
+        (f(std::integral_constant<std::size_t, I>{}), ...);
+    }
+    // 依次以 integral_constant<I> 调用 f
+    template <typename F>
+    static void for_each_column(F&& f) {
+        for_each_column_impl(f, std::index_sequence_for<Fields...>{});
+    }
+
+    template <std::size_t... I>
+    reference row(size_type pos, std::index_sequence<I...>) noexcept {
+        return reference(std::get<I>(m_columns)[pos]...);
+    }
+    template <std::size_t... I>
+    const_reference row(size_type pos, std::index_sequence<I...>) const noexcept {
+        return const_reference(std::get<I>(m_columns)[pos]...);
+    }
+
+    template <typename U>
+    static U* allocate_column(size_type n) {
+        return static_cast<U*>(::operator new(n * sizeof(U), std::align_val_t(std::max(alignment, alignof(U)))));
+    }
+    template <typename U>
+    static void deallocate_column(U* p) noexcept {
+        if(p) {
+            ::operator delete(p, std::align_val_t(std::max(alignment, alignof(U))));
+        }
+    }
+    static void deallocate_columns(std::tuple<Fields*...>& columns) noexcept {
+        for_each_column([&](auto I) { deallocate_column(std::get<I>(columns)); });
+    }
+
+    // init(I, p) 在 p 处构造第 I 列的元素；某列构造失败时析构本行已构造的列
+    template <typename Init>
+    void construct_row(size_type pos, Init&& init) {
+        std::size_t built = 0;
+        try {
+            for_each_column([&](auto I) {
+                init(I, std::get<I>(m_columns) + pos);
+                ++built;
+            });
+        } catch(...) {
+            for_each_column([&](auto I) {
+                if(I < built) {
+                    std::destroy_at(std::get<I>(m_columns) + pos);
+                }
+            });
+            throw;
+        }
+    }
+    void destroy_row(size_type pos) noexcept {
+        for_each_column([&](auto I) {
+            std::destroy_at(std::get<I>(m_columns) + pos);
+        });
+    }
+
+    template <typename Tuple>
+    void emplace_row(Tuple&& vals) {
+        if(m_size == m_capacity) {
+            // 参数可能引用本容器中的元素，扩容前先复制
+            value_type tmp(std::forward<Tuple>(vals));
+            allocate_space(m_capacity ? m_capacity * 2 : 1);
+            construct_row(m_size, [&](auto I, auto* p) {
+                ::new (static_cast<void*>(p)) field_type<I>(std::get<I>(std::move(tmp)));
+            });
+        } else {
+            construct_row(m_size, [&](auto I, auto* p) {
+                ::new (static_cast<void*>(p)) field_type<I>(std::get<I>(std::forward<Tuple>(vals)));
+            });
+        }
+        ++m_size;
+    }
+
+    // 所有列一起扩容：先在新空间构造全部元素，成功后才析构旧元素，失败时原容器不变
+    void allocate_space(size_type new_capacity) {
+        std::tuple<Fields*...> fresh{};
+        try {
+            for_each_column([&](auto I) {
+                std::get<I>(fresh) = allocate_column<field_type<I>>(new_capacity);
+            });
+        } catch(...) {
+            deallocate_columns(fresh);
+            throw;
+        }
+        std::size_t col = 0;
+        size_type moved = 0;
+        try {
+            for_each_column([&](auto I) {
+                using U = field_type<I>;
+                U* src = std::get<I>(m_columns);
+                U* dst = std::get<I>(fresh);
+                for(moved = 0; moved < m_size; ++moved) {
+                    ::new (static_cast<void*>(dst + moved)) U(std::move_if_noexcept(src[moved]));
+                }
+                ++col;
+            });
+        } catch(...) {
+            for_each_column([&](auto I) {
+                size_type built = I < col ? m_size : (I == col ? moved : 0);
+                for(size_type i = 0; i < built; ++i) {
+                    std::destroy_at(std::get<I>(fresh) + i);
+                }
+            });
+            deallocate_columns(fresh);
+            throw;
+        }
+        for(size_type i = 0; i < m_size; ++i) {
+            destroy_row(i);
+        }
+        deallocate_columns(m_columns);
+        m_columns = fresh;
+        m_capacity = new_capacity;
+    }
+};
+
+// 行迭代器，解引用得到引用元组
+template <typename... Fields>
+template <bool Const>
+class MySoAVector<Fields...>::basic_iterator {
+    using container = std::conditional_t<Const, const MySoAVector, MySoAVector>;
+    friend class MySoAVector;
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = typename MySoAVector::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::conditional_t<Const, typename MySoAVector::const_reference, typename MySoAVector::reference>;
+    using pointer = void;
+
+    basic_iterator() noexcept = default;
+    basic_iterator(container* vec, size_type pos) noexcept : m_vec(vec), m_pos(pos) {}
+    // 非 const 迭代器可以隐式转换为 const 迭代器
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    basic_iterator(const basic_iterator<false>& o) noexcept : m_vec(o.m_vec), m_pos(o.m_pos) {}
+
+    reference operator*() const noexcept { return (*m_vec)[m_pos]; }
+    reference operator[](difference_type n) const noexcept { return (*m_vec)[m_pos + n]; }
+    size_type index() const noexcept { return m_pos; }
+
+    basic_iterator& operator++() noexcept { ++m_pos; return *this; }
+    basic_iterator operator++(int) noexcept { basic_iterator tmp = *this; ++m_pos; return tmp; }
+    basic_iterator& operator--() noexcept { --m_pos; return *this; }
+    basic_iterator operator--(int) noexcept { basic_iterator tmp = *this; --m_pos; return tmp; }
+    basic_iterator& operator+=(difference_type n) noexcept { m_pos += n; return *this; }
+    basic_iterator& operator-=(difference_type n) noexcept { m_pos -= n; return *this; }
+    friend basic_iterator operator+(basic_iterator it, difference_type n) noexcept { return it += n; }
+    friend basic_iterator operator+(difference_type n, basic_iterator it) noexcept { return it += n; }
+    friend basic_iterator operator-(basic_iterator it, difference_type n) noexcept { return it -= n; }
+    friend difference_type operator-(const basic_iterator& a, const basic_iterator& b) noexcept {
+        return static_cast<difference_type>(a.m_pos) - static_cast<difference_type>(b.m_pos);
+    }
+
+    friend bool operator==(const basic_iterator& a, const basic_iterator& b) noexcept { return a.m_pos == b.m_pos; }
+    friend bool operator!=(const basic_iterator& a, const basic_iterator& b) noexcept { return a.m_pos != b.m_pos; }
+    friend bool operator<(const basic_iterator& a, const basic_iterator& b) noexcept { return a.m_pos < b.m_pos; }
+    friend bool operator>(const basic_iterator& a, const basic_iterator& b) noexcept { return a.m_pos > b.m_pos; }
+    friend bool operator<=(const basic_iterator& a, const basic_iterator& b) noexcept { return a.m_pos <= b.m_pos; }
+    friend bool operator>=(const basic_iterator& a, const basic_iterator& b) noexcept { return a.m_pos >= b.m_pos; }
+
+private:
+    container* m_vec = nullptr;
+    size_type m_pos = 0;
+};
+
+// 全局运算符重载
+template <typename... Fields>
+bool operator==(const MySoAVector<Fields...>& lhs, const MySoAVector<Fields...>& rhs) {
+    if(lhs.size() != rhs.size()) {
+        return false;
+    }
+    for(std::size_t i = 0; i < lhs.size(); ++i) {
+        if(lhs[i] != rhs[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename... Fields>
+bool operator!=(const MySoAVector<Fields...>& lhs, const MySoAVector<Fields...>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename... Fields>
+void swap(MySoAVector<Fields...>& lhs, MySoAVector<Fields...>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+#endif // MY_SOA_VECTOR_H
@@ -0,0 +1,235 @@
+#include "my_soa_vector.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+#include <tuple>
+#include <random>
+#include <string>
+
+// 辅助函数，用于输出 MySoAVector 的内容
+template <typename... Fields>
+void printMySoAVector(const MySoAVector<Fields...>& vec, const std::string& message = "") {
+    if (!message.empty()) {
+        std::cout << message << ": ";
+    }
+    std::cout << "[";
+    for (std::size_t i = 0; i < vec.size(); ++i) {
+        std::cout << "(";
+        std::apply([](const auto&... f) {
+            std::size_t n = 0;
+            ((std::cout << (n++ ? ", " : "") << f), ...);
+        }, vec[i]);
+        std::cout << ")";
+        if (i + 1 < vec.size()) {
+            std::cout << ", ";
+        }
+    }
+    std::cout << "]" << std::endl;
+}
+
+template <typename... Fields>
+bool sameAs(const MySoAVector<Fields...>& vec, const std::vector<std::tuple<Fields...>>& ref) {
+    if (vec.size() != ref.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < ref.size(); ++i) {
+        if (vec[i] != ref[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename U>
+bool aligned(const U* p) {
+    return reinterpret_cast<std::uintptr_t>(p) % 64 == 0;
+}
+
+// 统计存活对象数量，用于检查构造与析构是否配对
+struct Tracked {
+    static int alive;
+    int value;
+    Tracked(int v = 0) : value(v) { ++alive; }
+    Tracked(const Tracked& o) : value(o.value) { ++alive; }
+    Tracked(Tracked&& o) noexcept : value(o.value) { ++alive; }
+    Tracked& operator=(const Tracked&) = default;
+    Tracked& operator=(Tracked&&) = default;
+    ~Tracked() { --alive; }
+    bool operator==(const Tracked& o) const { return value == o.value; }
+    bool operator!=(const Tracked& o) const { return value != o.value; }
+};
+int Tracked::alive = 0;
+
+int main() {
+    std::cout << "===== 1) 构造与 push_back =====" << std::endl;
+    {
+        MySoAVector<int, double, std::string> v;
+        assert(v.empty() && v.capacity() == 0);
+        v.push_back(1, 1.5, "one");
+        std::string two = "two";
+        v.push_back(2, 2.5, two);
+        v.push_back(std::make_tuple(3, 3.5, std::string("three")));
+        assert(v.size() == 3);
+        assert(v.get<0>(2) == 3 && v.get<1>(1) == 2.5 && v.get<2>(0) == "one");
+        assert(std::get<2>(v.back()) == "three");
+        printMySoAVector(v, "v");
+
+        MySoAVector<int, float> z(4);
+        assert(z.size() == 4 && z.get<0>(3) == 0 && z.get<1>(3) == 0.0f);
+
+        bool thrown = false;
+        try {
+            v.at(3);
+        } catch (const std::out_of_range&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+
+    std::cout << "===== 2) 行引用与结构化绑定 =====" << std::endl;
+    {
+        MySoAVector<int, double> v;
+        for (int i = 0; i < 5; ++i) {
+            v.push_back(i, i * 0.5);
+        }
+        auto [id, w] = v[2];
+        id = 20;
+        w = 9.0;
+        assert(v.get<0>(2) == 20 && v.get<1>(2) == 9.0);
+        v[3] = std::make_tuple(30, 1.0);
+        assert(v.get<0>(3) == 30);
+        int sum = 0;
+        for (auto [a, b] : v) {
+            sum += a;
+            b += 1.0;
+        }
+        assert(sum == 0 + 1 + 20 + 30 + 4);
+        assert(v.get<1>(0) == 1.0);
+        const auto& cv = v;
+        assert(std::get<0>(*(cv.begin() + 4)) == 4 && cv.end() - cv.begin() == 5);
+    }
+
+    std::cout << "===== 3) 按列访问与对齐 =====" << std::endl;
+    {
+        MySoAVector<char, float, double, std::uint64_t> v;
+        for (int i = 0; i < 1000; ++i) {
+            v.push_back('a', static_cast<float>(i), i * 2.0, static_cast<std::uint64_t>(i));
+            assert(aligned(v.data<0>()) && aligned(v.data<1>()) && aligned(v.data<2>()) && aligned(v.data<3>()));
+        }
+        float* xs = v.data<1>();
+        for (std::size_t i = 0; i < v.size(); ++i) {
+            xs[i] *= 2.0f;
+        }
+        double total = 0;
+        for (double d : v.column<2>()) {
+            total += d;
+        }
+        assert(total == 999.0 * 1000.0);
+        assert(v.column<1>().size() == 1000 && v.column<1>()[10] == 20.0f);
+    }
+
+    std::cout << "===== 4) erase / pop_back / resize / swap =====" << std::endl;
+    {
+        MySoAVector<int, std::string> v;
+        for (int i = 0; i < 8; ++i) {
+            v.push_back(i, std::to_string(i));
+        }
+        auto it = v.erase(v.begin() + 1, v.begin() + 3);
+        assert(std::get<0>(*it) == 3 && v.size() == 6);
+        v.erase(v.begin());
+        v.pop_back();
+        std::vector<std::tuple<int, std::string>> ref = {{3, "3"}, {4, "4"}, {5, "5"}, {6, "6"}};
+        assert(sameAs(v, ref));
+        v.swap_rows(0, 3);
+        assert(v.get<0>(0) == 6 && v.get<1>(3) == "3");
+        v.resize(6, std::make_tuple(-1, std::string("x")));
+        assert(v.size() == 6 && v.get<1>(5) == "x");
+        v.resize(2);
+        assert(v.size() == 2);
+
+        MySoAVector<int, std::string> u;
+        u.push_back(100, "hundred");
+        v.swap(u);
+        assert(v.size() == 1 && u.size() == 2 && v.get<1>(0) == "hundred");
+        v.shrink_to_fit();
+        assert(v.capacity() == 1);
+        v.clear();
+        assert(v.empty());
+    }
+
+    std::cout << "===== 5) 拷贝、移动与比较 =====" << std::endl;
+    {
+        MySoAVector<int, std::string> a;
+        for (int i = 0; i < 10; ++i) {
+            a.push_back(i, std::string(i, 'k'));
+        }
+        MySoAVector<int, std::string> b = a;
+        assert(a == b);
+        b.get<1>(4) = "changed";
+        assert(a != b);
+        MySoAVector<int, std::string> c = std::move(b);
+        assert(b.empty() && c.get<1>(4) == "changed");
+        c = a;
+        assert(c == a);
+        b = std::move(c);
+        assert(b == a && c.empty());
+        // 参数引用自身元素时扩容仍然正确
+        a.shrink_to_fit();
+        a.push_back(a.get<0>(9), a.get<1>(9));
+        assert(a.get<1>(10) == std::string(9, 'k'));
+    }
+
+    std::cout << "===== 6) 对象生命周期 =====" << std::endl;
+    {
+        {
+            MySoAVector<Tracked, int, Tracked> v;
+            for (int i = 0; i < 20; ++i) {
+                v.push_back(Tracked(i), i, Tracked(-i));
+            }
+            v.erase(v.begin() + 5, v.begin() + 10);
+            v.resize(10);
+            MySoAVector<Tracked, int, Tracked> w = v;
+            w.resize(12);
+            assert(Tracked::alive == 44);
+            v.clear();
+            assert(Tracked::alive == 24);
+        }
+        assert(Tracked::alive == 0);
+    }
+
+    std::cout << "===== 7) 随机操作对比 std::vector =====" << std::endl;
+    {
+        std::mt19937 rng(2024);
+        MySoAVector<int, std::string, double> v;
+        std::vector<std::tuple<int, std::string, double>> ref;
+        for (int step = 0; step < 20000; ++step) {
+            int op = rng() % 6;
+            int k = static_cast<int>(rng() % 1000);
+            if (op <= 1) {
+                v.push_back(k, std::to_string(k), k * 0.25);
+                ref.emplace_back(k, std::to_string(k), k * 0.25);
+            } else if (op == 2 && !ref.empty()) {
+                std::size_t pos = rng() % ref.size();
+                v.erase(v.begin() + pos);
+                ref.erase(ref.begin() + pos);
+            } else if (op == 3 && !ref.empty()) {
+                v.pop_back();
+                ref.pop_back();
+            } else if (op == 4 && !ref.empty()) {
+                std::size_t a = rng() % ref.size();
+                std::size_t b = rng() % ref.size();
+                v.swap_rows(a, b);
+                std::swap(ref[a], ref[b]);
+            } else if (op == 5) {
+                std::size_t n = rng() % 64;
+                v.resize(n);
+                ref.resize(n);
+            }
+            assert(sameAs(v, ref));
+        }
+    }
+
+    std::cout << "All MySoAVector tests passed successfully!" << std::endl;
+    return 0;
+}
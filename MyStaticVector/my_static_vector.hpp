@@ -0,0 +1,404 @@
+#ifndef MY_STATIC_VECTOR_H
+#define MY_STATIC_VECTOR_H
+
+#include <cstddef>
+#include <new>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <iterator>
+#include <utility>
+
+// 元素可平凡拷贝且可平凡析构时，MyStaticVector 的拷贝、析构也是平凡操作
+template <typename T>
+inline constexpr bool my_static_vector_trivial = std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>;
+
+// 存储方式：
+// - array：平凡类型且可默认构造、可移动赋值，直接存放 T 数组，全部接口可用于常量求值
+// - trivial_buffer：其余平凡类型，存放在原始缓冲区中，拷贝与析构仍为平凡操作
+// - buffer：非平凡类型，存放在原始缓冲区中按需构造与析构
+enum class MyStaticVectorLayout { array, trivial_buffer, buffer };
+
+template <typename T>
+inline constexpr MyStaticVectorLayout my_static_vector_layout =
+    !my_static_vector_trivial<T> ? MyStaticVectorLayout::buffer
+    : std::is_default_constructible_v<T> && std::is_move_assignable_v<T> ? MyStaticVectorLayout::array
+    : MyStaticVectorLayout::trivial_buffer;
+
+template <typename T, std::size_t N, MyStaticVectorLayout Layout = my_static_vector_layout<T>>
+class MyStaticVectorStorage;
+
+template <typename T, std::size_t N>
+class MyStaticVectorStorage<T, N, MyStaticVectorLayout::array> {
+protected:
+    // 常量求值不允许读取未初始化的对象，因此值初始化整个数组
+    T m_data[N ? N : 1] = {};
+    std::size_t m_size = 0;
+
+    constexpr T* ptr() noexcept { return m_data; }
+    constexpr const T* ptr() const noexcept { return m_data; }
+
+    template <typename... Args>
+    constexpr void construct(T* p, Args&&... args) { *p = T(std::forward<Args>(args)...); }
+    constexpr void destroy(T*) noexcept {}
+};
+
+// 不可默认构造的平凡类型：原始缓冲区，拷贝、移动与析构均使用默认的平凡实现
+template <typename T, std::size_t N>
+class MyStaticVectorStorage<T, N, MyStaticVectorLayout::trivial_buffer> {
+protected:
+    alignas(T) unsigned char m_buffer[sizeof(T) * (N ? N : 1)];
+    std::size_t m_size = 0;
+
+    T* ptr() noexcept { return std::launder(reinterpret_cast<T*>(m_buffer)); }
+    const T* ptr() const noexcept { return std::launder(reinterpret_cast<const T*>(m_buffer)); }
+
+    template <typename... Args>
+    void construct(T* p, Args&&... args) { ::new (static_cast<void*>(p)) T(std::forward<Args>(args)...); }
+    void destroy(T*) noexcept {}
+
+    MyStaticVectorStorage() noexcept {}
+};
+
+// 非平凡类型存放在对齐的原始缓冲区中，按需构造与析构
+template <typename T, std::size_t N>
+class MyStaticVectorStorage<T, N, MyStaticVectorLayout::buffer> {
+protected:
+    alignas(T) unsigned char m_buffer[sizeof(T) * (N ? N : 1)];
+    std::size_t m_size = 0;
+
+    T* ptr() noexcept { return std::launder(reinterpret_cast<T*>(m_buffer)); }
+    const T* ptr() const noexcept { return std::launder(reinterpret_cast<const T*>(m_buffer)); }
+
+    template <typename... Args>
+    void construct(T* p, Args&&... args) { ::new (static_cast<void*>(p)) T(std::forward<Args>(args)...); }
+    void destroy(T* p) noexcept { p->~T(); }
+
+    MyStaticVectorStorage() noexcept {}
+    MyStaticVectorStorage(const MyStaticVectorStorage& o) {
+        for(; m_size < o.m_size; ++m_size) {
+            construct(ptr() + m_size, o.ptr()[m_size]);
+        }
+    }
+    MyStaticVectorStorage(MyStaticVectorStorage&& o) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        for(; m_size < o.m_size; ++m_size) {
+            construct(ptr() + m_size, std::move(o.ptr()[m_size]));
+        }
+    }
+    MyStaticVectorStorage& operator=(const MyStaticVectorStorage& o) {
+        if(this != &o) {
+            assign(o.ptr(), o.m_size);
+        }
+        return *this;
+    }
+    MyStaticVectorStorage& operator=(MyStaticVectorStorage&& o) noexcept(std::is_nothrow_move_assignable_v<T> &&
+                                                                          std::is_nothrow_move_constructible_v<T>) {
+        if(this != &o) {
+            assign(std::make_move_iterator(o.ptr()), o.m_size);
+        }
+        return *this;
+    }
+    ~MyStaticVectorStorage() {
+        for(std::size_t i = 0; i < m_size; ++i) {
+            destroy(ptr() + i);
+        }
+    }
+
+private:
+    // 已有元素赋值，不足部分构造，多余部分析构
+    template <typename InputIterator>
+    void assign(InputIterator first, std::size_t cnt) {
+        std::size_t i = 0;
+        for(; i < cnt && i < m_size; ++i) {
+            ptr()[i] = *first++;
+        }
+        for(; m_size < cnt; ++m_size) {
+            construct(ptr() + m_size, *first++);
+        }
+        for(; cnt < m_size; --m_size) {
+            destroy(ptr() + m_size - 1);
+        }
+    }
+};
+
+// 定长容量的动态数组：元素存放在对象内部，容量固定为 N，从不分配堆内存
+// 超出容量时 push_back / insert 抛出 std::length_error，try_push_back 返回 false
+template <typename T, std::size_t N>
+class MyStaticVector : private MyStaticVectorStorage<T, N> {
+    using base = MyStaticVectorStorage<T, N>;
+    using base::m_size;
+    using base::ptr;
+    using base::construct;
+    using base::destroy;
+
+public:
+    // 类型别名
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    // 构造函数，拷贝、移动与析构由存储层提供
+    constexpr MyStaticVector() = default;
+    constexpr explicit MyStaticVector(size_type cnt) { resize(cnt); }
+    constexpr MyStaticVector(size_type cnt, const_reference value) { resize(cnt, value); }
+    constexpr MyStaticVector(std::initializer_list<T> list) { insert(end(), list.begin(), list.end()); }
+
+    // 赋值运算符
+    constexpr MyStaticVector& operator=(std::initializer_list<T> list) {
+        clear();
+        insert(end(), list.begin(), list.end());
+        return *this;
+    }
+
+    // 容量
+    constexpr size_type size() const noexcept { return m_size; }
+    static constexpr size_type capacity() noexcept { return N; }
+    static constexpr size_type max_size() noexcept { return N; }
+    constexpr bool empty() const noexcept { return m_size == 0; }
+    constexpr bool full() const noexcept { return m_size == N; }
+    // 容量固定，reserve 仅检查 n 是否超出 N
+    constexpr void reserve(size_type n) const {
+        if(n > N) {
+            throw std::length_error("MyStaticVector::reserve");
+        }
+    }
+    constexpr void shrink_to_fit() noexcept {}
+
+    // 元素访问
+    constexpr reference operator[](size_type pos) { return ptr()[pos]; }
+    constexpr const_reference operator[](size_type pos) const { return ptr()[pos]; }
+    constexpr reference at(size_type pos) {
+        if(pos >= m_size) {
+            throw std::out_of_range("MyStaticVector::at");
+        }
+        return ptr()[pos];
+    }
+    constexpr const_reference at(size_type pos) const {
+        if(pos >= m_size) {
+            throw std::out_of_range("MyStaticVector::at");
+        }
+        return ptr()[pos];
+    }
+    constexpr reference front() { return ptr()[0]; }
+    constexpr const_reference front() const { return ptr()[0]; }
+    constexpr reference back() { return ptr()[m_size - 1]; }
+    constexpr const_reference back() const { return ptr()[m_size - 1]; }
+    constexpr pointer data() noexcept { return ptr(); }
+    constexpr const_pointer data() const noexcept { return ptr(); }
+
+    // 修改器
+    constexpr void push_back(const_reference val) { emplace_back(val); }
+    constexpr void push_back(T&& val) { emplace_back(std::move(val)); }
+    template <typename... Args>
+    constexpr reference emplace_back(Args&&... args) {
+        if(full()) {
+            throw std::length_error("MyStaticVector::emplace_back");
+        }
+        construct(ptr() + m_size, std::forward<Args>(args)...);
+        return ptr()[m_size++];
+    }
+    // 容量已满时不做任何修改并返回 false / nullptr
+    constexpr bool try_push_back(const_reference val) { return try_emplace_back(val) != nullptr; }
+    constexpr bool try_push_back(T&& val) { return try_emplace_back(std::move(val)) != nullptr; }
+    template <typename... Args>
+    constexpr pointer try_emplace_back(Args&&... args) {
+        if(full()) {
+            return nullptr;
+        }
+        construct(ptr() + m_size, std::forward<Args>(args)...);
+        return ptr() + m_size++;
+    }
+    constexpr void pop_back() {
+        if(m_size > 0) {
+            destroy(ptr() + --m_size);
+        }
+    }
+    constexpr iterator insert(const_iterator pos, const_reference val) { return emplace(pos, val); }
+    constexpr iterator insert(const_iterator pos, T&& val) { return emplace(pos, std::move(val)); }
+    constexpr iterator insert(const_iterator pos, size_type cnt, const_reference val) {
+        size_type offset = check_insert(pos, cnt, "MyStaticVector::insert");
+        append_tail<std::is_nothrow_copy_constructible_v<T>>(cnt, [&](T* p) { construct(p, val); });
+        rotate_tail(offset, cnt);
+        return ptr() + offset;
+    }
+    template <typename InputIterator>
+    constexpr typename std::enable_if_t<
+        !std::is_void_v<typename std::iterator_traits<InputIterator>::value_type> &&
+        std::is_same_v<T, typename std::iterator_traits<InputIterator>::value_type>,
+        iterator
+    >
+    insert(const_iterator pos, InputIterator first, InputIterator last) {
+        size_type cnt = static_cast<size_type>(std::distance(first, last));
+        size_type offset = check_insert(pos, cnt, "MyStaticVector::insert");
+        constexpr bool nothrow = std::is_nothrow_constructible_v<T, typename std::iterator_traits<InputIterator>::reference> &&
+                                 noexcept(*first) && noexcept(++first);
+        append_tail<nothrow>(cnt, [&](T* p) {
+            construct(p, *first);
+            ++first;
+        });
+        rotate_tail(offset, cnt);
+        return ptr() + offset;
+    }
+    template <typename... Args>
+    constexpr iterator emplace(const_iterator pos, Args&&... args) {
+        size_type offset = check_insert(pos, 1, "MyStaticVector::emplace");
+        construct(ptr() + m_size, std::forward<Args>(args)...);
+        ++m_size;
+        rotate_tail(offset, 1);
+        return ptr() + offset;
+    }
+    constexpr iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+    constexpr iterator erase(const_iterator first, const_iterator last) {
+        if(first < begin() || last > end() || first >= last) {
+            throw std::out_of_range("MyStaticVector::erase");
+        }
+        size_type dest = static_cast<size_type>(first - cbegin());
+        size_type src = static_cast<size_type>(last - cbegin());
+        for(; src < m_size; ++src, ++dest) {
+            ptr()[dest] = std::move(ptr()[src]);
+        }
+        while(m_size > dest) {
+            destroy(ptr() + --m_size);
+        }
+        return ptr() + (first - cbegin());
+    }
+    constexpr void clear() noexcept {
+        while(m_size > 0) {
+            destroy(ptr() + --m_size);
+        }
+    }
+    constexpr void resize(size_type n) {
+        reserve(n);
+        while(m_size > n) {
+            destroy(ptr() + --m_size);
+        }
+        for(; m_size < n; ++m_size) {
+            construct(ptr() + m_size);
+        }
+    }
+    constexpr void resize(size_type n, const_reference val) {
+        reserve(n);
+        while(m_size > n) {
+            destroy(ptr() + --m_size);
+        }
+        for(; m_size < n; ++m_size) {
+            construct(ptr() + m_size, val);
+        }
+    }
+
+    // 迭代器
+    constexpr iterator begin() noexcept { return ptr(); }
+    constexpr const_iterator begin() const noexcept { return ptr(); }
+    constexpr iterator end() noexcept { return ptr() + m_size; }
+    constexpr const_iterator end() const noexcept { return ptr() + m_size; }
+    constexpr const_iterator cbegin() const noexcept { return ptr(); }
+    constexpr const_iterator cend() const noexcept { return ptr() + m_size; }
+    constexpr reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    constexpr const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    constexpr reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    constexpr const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    constexpr const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(end()); }
+    constexpr const_reverse_iterator crend() const noexcept { return const_reverse_iterator(begin()); }
+
+    // 交换，元素逐个交换或移动，复杂度 O(size)
+    constexpr void swap(MyStaticVector& o) {
+        MyStaticVector& small = m_size < o.m_size ? *this : o;
+        MyStaticVector& large = m_size < o.m_size ? o : *this;
+        size_type common = small.m_size;
+        for(size_type i = 0; i < common; ++i) {
+            T tmp(std::move(small.ptr()[i]));
+            small.ptr()[i] = std::move(large.ptr()[i]);
+            large.ptr()[i] = std::move(tmp);
+        }
+        for(size_type i = common; i < large.m_size; ++i) {
+            small.construct(small.ptr() + i, std::move(large.ptr()[i]));
+            ++small.m_size;
+        }
+        while(large.m_size > common) {
+            large.destroy(large.ptr() + --large.m_size);
+        }
+    }
+
+private:
+    // 检查插入位置与剩余容量，返回插入位置的下标
+    constexpr size_type check_insert(const_iterator pos, size_type cnt, const char* what) const {
+        if(pos < begin() || pos > end()) {
+            throw std::out_of_range(what);
+        }
+        if(cnt > N - m_size) {
+            throw std::length_error(what);
+        }
+        return static_cast<size_type>(pos - begin());
+    }
+    // 在尾部逐个构造 cnt 个元素，make(p) 构造其中一个；抛出异常时析构已构造的部分后重新抛出，容器不变
+    // 构造不会抛出时直接循环，保持可用于常量求值
+    template <bool Nothrow, typename Make>
+    constexpr void append_tail(size_type cnt, Make make) {
+        if constexpr(Nothrow) {
+            for(size_type i = 0; i < cnt; ++i) {
+                make(ptr() + m_size);
+                ++m_size;
+            }
+        } else {
+            append_tail_guarded(cnt, make);
+        }
+    }
+    template <typename Make>
+    void append_tail_guarded(size_type cnt, Make& make) {
+        size_type old_size = m_size;
+        try {
+            for(size_type i = 0; i < cnt; ++i) {
+                make(ptr() + m_size);
+                ++m_size;
+            }
+        } catch(...) {
+            while(m_size > old_size) {
+                destroy(ptr() + --m_size);
+            }
+            throw;
+        }
+    }
+    // 新元素已构造在尾部，三次翻转把末尾 cnt 个元素轮换到 offset 处
+    // 先构造后轮换，参数引用本容器中的元素时也安全
+    constexpr void rotate_tail(size_type offset, size_type cnt) {
+        reverse(offset, m_size - cnt);
+        reverse(m_size - cnt, m_size);
+        reverse(offset, m_size);
+    }
+    constexpr void reverse(size_type first, size_type last) {
+        for(; first + 1 < last; ++first, --last) {
+            T tmp(std::move(ptr()[first]));
+            ptr()[first] = std::move(ptr()[last - 1]);
+            ptr()[last - 1] = std::move(tmp);
+        }
+    }
+};
+
+// 全局运算符重载
+template <typename T, std::size_t N>
+constexpr bool operator==(const MyStaticVector<T, N>& lhs, const MyStaticVector<T, N>& rhs) {
+    if(lhs.size() != rhs.size()) {
+        return false;
+    }
+    for(std::size_t i = 0; i < lhs.size(); ++i) {
+        if(!(lhs[i] == rhs[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T, std::size_t N>
+constexpr bool operator!=(const MyStaticVector<T, N>& lhs, const MyStaticVector<T, N>& rhs) {
+    return !(lhs == rhs);
+}
+
+#endif // MY_STATIC_VECTOR_H
@@ -0,0 +1,332 @@
+#include "my_static_vector.hpp"
+#include <iostream>
+#include <cassert>
+#include <vector>
+#include <random>
+#include <string>
+#include <stdexcept>
+
+// 辅助函数，用于输出 MyStaticVector 的内容
+template <typename T, std::size_t N>
+void printMyStaticVector(const MyStaticVector<T, N>& vec, const std::string& message = "") {
+    if (!message.empty()) {
+        std::cout << message << ": ";
+    }
+    std::cout << "[";
+    for (std::size_t i = 0; i < vec.size(); ++i) {
+        std::cout << vec[i];
+        if (i + 1 < vec.size()) {
+            std::cout << ", ";
+        }
+    }
+    std::cout << "]" << std::endl;
+}
+
+template <typename T, std::size_t N>
+bool sameAs(const MyStaticVector<T, N>& vec, const std::vector<T>& ref) {
+    if (vec.size() != ref.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < ref.size(); ++i) {
+        if (!(vec[i] == ref[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 统计存活对象数量，用于检查构造与析构是否配对
+struct Tracked {
+    static int alive;
+    int value;
+    Tracked(int v = 0) : value(v) { ++alive; }
+    Tracked(const Tracked& o) : value(o.value) { ++alive; }
+    Tracked(Tracked&& o) noexcept : value(o.value) { ++alive; }
+    Tracked& operator=(const Tracked&) = default;
+    Tracked& operator=(Tracked&&) = default;
+    ~Tracked() { --alive; }
+    bool operator==(const Tracked& o) const { return value == o.value; }
+};
+int Tracked::alive = 0;
+
+// 第 throw_at 次拷贝时抛出异常
+struct ThrowOnCopy {
+    static int copies;
+    static int throw_at;
+    int value;
+    ThrowOnCopy(int v = 0) : value(v) {}
+    ThrowOnCopy(const ThrowOnCopy& o) : value(o.value) {
+        if (++copies == throw_at) {
+            throw std::runtime_error("copy");
+        }
+    }
+    ThrowOnCopy(ThrowOnCopy&&) noexcept = default;
+    ThrowOnCopy& operator=(const ThrowOnCopy&) = default;
+    ThrowOnCopy& operator=(ThrowOnCopy&&) noexcept = default;
+};
+int ThrowOnCopy::copies = 0;
+int ThrowOnCopy::throw_at = 0;
+
+// 可平凡拷贝但默认构造不平凡，以及不可默认构造的平凡类型
+struct Point {
+    int x = 0;
+};
+struct Pinned {
+    int v;
+    explicit Pinned(int x) : v(x) {}
+};
+
+struct Header {
+    int key;
+    int value;
+    constexpr bool operator==(const Header& o) const { return key == o.key && value == o.value; }
+};
+
+// 编译期使用
+constexpr MyStaticVector<int, 8> makeSquares() {
+    MyStaticVector<int, 8> v;
+    for (int i = 0; v.try_push_back(i * i); ++i) {}
+    v.erase(v.begin());
+    v.pop_back();
+    v.insert(v.begin() + 2, 2, -1);
+    return v;
+}
+
+constexpr MyStaticVector<int, 8> squares = makeSquares();
+static_assert(squares.size() == 8);
+static_assert(squares[0] == 1 && squares[1] == 4 && squares[2] == -1 && squares[4] == 9 && squares[7] == 36);
+static_assert(MyStaticVector<int, 3>{1, 2, 3} == MyStaticVector<int, 3>{1, 2, 3});
+static_assert(std::is_trivially_copyable_v<MyStaticVector<Header, 16>>);
+static_assert(!std::is_trivially_copyable_v<MyStaticVector<std::string, 4>>);
+static_assert(std::is_trivially_copyable_v<MyStaticVector<Point, 4>> && MyStaticVector<Point, 4>(2)[1].x == 0);
+static_assert(std::is_trivially_copyable_v<MyStaticVector<Pinned, 4>>);
+static_assert(sizeof(MyStaticVector<Header, 16>) == sizeof(Header) * 16 + sizeof(std::size_t));
+
+int main() {
+    std::cout << "===== 1) 构造与容量 =====" << std::endl;
+    {
+        MyStaticVector<int, 4> v1;
+        assert(v1.empty() && v1.size() == 0 && v1.capacity() == 4);
+        MyStaticVector<int, 4> v2(3);
+        assert(v2.size() == 3 && v2[0] == 0 && v2[2] == 0);
+        MyStaticVector<int, 4> v3(2, 7);
+        assert(v3.size() == 2 && v3[0] == 7 && v3[1] == 7);
+        MyStaticVector<int, 4> v4 = {1, 2, 3, 4};
+        assert(v4.full() && v4.front() == 1 && v4.back() == 4);
+        printMyStaticVector(v4, "v4");
+
+        bool thrown = false;
+        try {
+            MyStaticVector<int, 2> bad = {1, 2, 3};
+            (void)bad;
+        } catch (const std::length_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+        thrown = false;
+        try {
+            v4.reserve(5);
+        } catch (const std::length_error&) {
+            thrown = true;
+        }
+        assert(thrown);
+        thrown = false;
+        try {
+            v4.at(4);
+        } catch (const std::out_of_range&) {
+            thrown = true;
+        }
+        assert(thrown);
+    }
+
+    std::cout << "===== 2) push_back 与 try_push_back =====" << std::endl;
+    {
+        MyStaticVector<std::string, 3> v;
+        assert(v.try_push_back("a"));
+        v.push_back("b");
+        std::string c = "c";
+        assert(v.try_push_back(c));
+        assert(!v.try_push_back("d"));
+        assert(v.try_emplace_back(1, 'x') == nullptr);
+        assert(v.size() == 3 && v.back() == "c");
+
+        bool thrown = false;
+        try {
+            v.push_back("d");
+        } catch (const std::length_error&) {
+            thrown = true;
+        }
+        assert(thrown && v.size() == 3);
+        v.pop_back();
+        std::string* p = v.try_emplace_back(3, 'z');
+        assert(p == &v.back() && *p == "zzz");
+        printMyStaticVector(v, "strings");
+    }
+
+    std::cout << "===== 3) insert / emplace / erase =====" << std::endl;
+    {
+        MyStaticVector<int, 10> v = {1, 2, 3};
+        auto it = v.insert(v.begin() + 1, 9);
+        assert(*it == 9);
+        v.insert(v.end(), 2, 5);
+        v.emplace(v.begin(), 0);
+        int arr[] = {7, 8};
+        v.insert(v.begin() + 3, arr, arr + 2);
+        assert(sameAs(v, std::vector<int>{0, 1, 9, 7, 8, 2, 3, 5, 5}));
+        // 插入引用自身元素
+        v.insert(v.begin(), v.back());
+        assert(v.front() == 5 && v.full());
+        it = v.erase(v.begin() + 1, v.begin() + 4);
+        assert(*it == 7);
+        v.erase(v.end() - 1);
+        assert(sameAs(v, std::vector<int>{5, 7, 8, 2, 3, 5}));
+        printMyStaticVector(v, "after insert / erase");
+
+        bool thrown = false;
+        try {
+            v.insert(v.begin(), 5, 0);
+        } catch (const std::length_error&) {
+            thrown = true;
+        }
+        assert(thrown && v.size() == 6);
+    }
+
+    std::cout << "===== 4) 拷贝、移动与交换 =====" << std::endl;
+    {
+        MyStaticVector<std::string, 4> a = {"x", "y", "z"};
+        MyStaticVector<std::string, 4> b = a;
+        assert(a == b);
+        b[0] = "w";
+        assert(a != b);
+        MyStaticVector<std::string, 4> c = std::move(b);
+        assert(c[0] == "w" && c.size() == 3);
+        c = {"q"};
+        assert(c.size() == 1);
+        c = a;
+        assert(c == a);
+        MyStaticVector<std::string, 4> d = {"1"};
+        a.swap(d);
+        assert(a.size() == 1 && a[0] == "1" && d.size() == 3 && d[2] == "z");
+
+        MyStaticVector<Header, 16> h1;
+        h1.push_back({1, 2});
+        MyStaticVector<Header, 16> h2 = h1;
+        assert(h2 == h1);
+    }
+
+    std::cout << "===== 5) 迭代器 =====" << std::endl;
+    {
+        MyStaticVector<int, 5> v = {1, 2, 3, 4, 5};
+        int sum = 0;
+        for (int x : v) {
+            sum += x;
+        }
+        assert(sum == 15);
+        int expect = 5;
+        for (auto it = v.crbegin(); it != v.crend(); ++it) {
+            assert(*it == expect--);
+        }
+        assert(v.end() - v.begin() == 5 && v.data() == &v[0]);
+    }
+
+    std::cout << "===== 6) 对象生命周期 =====" << std::endl;
+    {
+        {
+            MyStaticVector<Tracked, 8> v;
+            for (int i = 0; i < 6; ++i) {
+                v.emplace_back(i);
+            }
+            v.insert(v.begin() + 2, 2, Tracked(42));
+            v.erase(v.begin(), v.begin() + 3);
+            v.resize(3);
+            MyStaticVector<Tracked, 8> w = v;
+            w.resize(7, Tracked(1));
+            v = w;
+            assert(Tracked::alive == 14);
+            v.clear();
+            assert(Tracked::alive == 7);
+        }
+        assert(Tracked::alive == 0);
+
+        // 插入中途抛出异常时容器不变
+        MyStaticVector<ThrowOnCopy, 8> t;
+        t.emplace_back(1);
+        t.emplace_back(2);
+        ThrowOnCopy x(9);
+        ThrowOnCopy::copies = 0;
+        ThrowOnCopy::throw_at = 3;
+        bool thrown = false;
+        try {
+            t.insert(t.begin(), 3, x);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown && t.size() == 2 && t[0].value == 1 && t[1].value == 2);
+        ThrowOnCopy src[3] = {7, 8, 9};
+        ThrowOnCopy::copies = 0;
+        ThrowOnCopy::throw_at = 2;
+        thrown = false;
+        try {
+            t.insert(t.begin() + 1, src, src + 3);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown && t.size() == 2 && t[1].value == 2);
+        ThrowOnCopy::copies = 0;
+        ThrowOnCopy::throw_at = 1;
+        thrown = false;
+        try {
+            t.emplace(t.begin(), x);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown && t.size() == 2 && t[0].value == 1);
+        ThrowOnCopy::throw_at = 0;
+        t.insert(t.begin(), 2, x);
+        assert(t.size() == 4 && t[0].value == 9 && t[2].value == 1);
+
+        MyStaticVector<Pinned, 4> pins;
+        pins.emplace_back(3);
+        pins.emplace(pins.begin(), 1);
+        MyStaticVector<Pinned, 4> pins2 = pins;
+        assert(pins2.size() == 2 && pins2[0].v == 1 && pins2[1].v == 3);
+    }
+
+    std::cout << "===== 7) 随机操作对比 std::vector =====" << std::endl;
+    {
+        std::mt19937 rng(12345);
+        MyStaticVector<std::string, 32> v;
+        std::vector<std::string> ref;
+        for (int step = 0; step < 20000; ++step) {
+            int op = rng() % 5;
+            std::string s = std::to_string(rng() % 1000);
+            if (op == 0 && !v.full()) {
+                std::size_t pos = rng() % (v.size() + 1);
+                v.insert(v.begin() + pos, s);
+                ref.insert(ref.begin() + pos, s);
+            } else if (op == 1 && !v.empty()) {
+                std::size_t pos = rng() % v.size();
+                v.erase(v.begin() + pos);
+                ref.erase(ref.begin() + pos);
+            } else if (op == 2) {
+                bool full = v.full();
+                bool ok = v.try_push_back(s);
+                if (ok) {
+                    ref.push_back(s);
+                }
+                assert(ok == !full);
+            } else if (op == 3 && !v.empty()) {
+                v.pop_back();
+                ref.pop_back();
+            } else if (op == 4) {
+                std::size_t n = rng() % 33;
+                v.resize(n, s);
+                ref.resize(n, s);
+            }
+            assert(sameAs(v, ref));
+        }
+    }
+
+    std::cout << "All MyStaticVector tests passed successfully!" << std::endl;
+    return 0;
+}
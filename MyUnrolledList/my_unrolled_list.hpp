@@ -0,0 +1,460 @@
+#ifndef MY_UNROLLED_LIST_H
+#define MY_UNROLLED_LIST_H
+
+#include <cstddef>
+#include <memory>
+#include <initializer_list>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <iterator>
+
+// 默认每个节点约占 4 条 64 字节缓存行
+template <typename T>
+constexpr std::size_t unrolled_default_capacity() {
+    constexpr std::size_t bytes = 256 - 3 * sizeof(void*);
+    return bytes / sizeof(T) > 4 ? bytes / sizeof(T) : 4;
+}
+
+template <typename T, std::size_t K = unrolled_default_capacity<T>()>
+class MyUnrolledList {
+    static_assert(K >= 2, "MyUnrolledList: node capacity must be at least 2");
+public:
+    // 类型别名
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+
+    class iterator;
+    class const_iterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr size_type node_capacity = K;
+
+    // 构造函数
+    MyUnrolledList() : m_size(0) { reset_sentinel(); }
+    explicit MyUnrolledList(size_type count) : MyUnrolledList() {
+        for(size_type i = 0; i < count; ++i) {
+            emplace_back_impl();
+        }
+    }
+    MyUnrolledList(size_type count, const_reference value) : MyUnrolledList() {
+        for(size_type i = 0; i < count; ++i) {
+            emplace_back_impl(value);
+        }
+    }
+    MyUnrolledList(std::initializer_list<T> init) : MyUnrolledList() {
+        for(const_reference val : init) {
+            emplace_back_impl(val);
+        }
+    }
+    MyUnrolledList(const MyUnrolledList& o) : MyUnrolledList() {
+        for(const_reference val : o) {
+            emplace_back_impl(val);
+        }
+    }
+    MyUnrolledList(MyUnrolledList&& o) noexcept : m_size(0) {
+        reset_sentinel();
+        take_links(o);
+    }
+    // 析构函数
+    ~MyUnrolledList() { clear(); }
+
+    // 赋值运算符
+    MyUnrolledList& operator=(const MyUnrolledList& o) {
+        if(this != &o) {
+            clear();
+            for(const_reference val : o) {
+                emplace_back_impl(val);
+            }
+        }
+        return *this;
+    }
+    MyUnrolledList& operator=(MyUnrolledList&& o) noexcept {
+        if(this != &o) {
+            clear();
+            take_links(o);
+        }
+        return *this;
+    }
+    MyUnrolledList& operator=(std::initializer_list<T> init) {
+        clear();
+        for(const_reference val : init) {
+            emplace_back_impl(val);
+        }
+        return *this;
+    }
+
+    // 容量
+    size_type size() const noexcept { return m_size; }
+    bool empty() const noexcept { return m_size == 0; }
+    size_type node_count() const noexcept { return m_nodes; }
+
+    // 元素访问
+    reference front() {
+        if(empty()) {
+            throw std::out_of_range("MyUnrolledList::front");
+        }
+        return first_node()->data()[0];
+    }
+    const_reference front() const {
+        if(empty()) {
+            throw std::out_of_range("MyUnrolledList::front");
+        }
+        return first_node()->data()[0];
+    }
+    reference back() {
+        if(empty()) {
+            throw std::out_of_range("MyUnrolledList::back");
+        }
+        Node* n = last_node();
+        return n->data()[n->count - 1];
+    }
+    const_reference back() const {
+        if(empty()) {
+            throw std::out_of_range("MyUnrolledList::back");
+        }
+        Node* n = last_node();
+        return n->data()[n->count - 1];
+    }
+
+    // 修改器
+    void push_front(const_reference val) { emplace(cbegin(), val); }
+    void push_front(T&& val) { emplace(cbegin(), std::move(val)); }
+    void pop_front() {
+        if(empty()) {
+            throw std::out_of_range("MyUnrolledList::pop_front");
+        }
+        erase(cbegin());
+    }
+    void push_back(const_reference val) { emplace_back_impl(val); }
+    void push_back(T&& val) { emplace_back_impl(std::move(val)); }
+    void pop_back() {
+        if(empty()) {
+            throw std::out_of_range("MyUnrolledList::pop_back");
+        }
+        Node* n = last_node();
+        std::destroy_at(n->data() + n->count - 1);
+        --m_size;
+        if(--n->count == 0) {
+            destroy_node(n);
+        }
+    }
+    // 插入与删除会使受影响节点（至多两个）内的迭代器失效
+    iterator insert(const_iterator pos, const_reference val) { return emplace(pos, val); }
+    iterator insert(const_iterator pos, T&& val) { return emplace(pos, std::move(val)); }
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        NodeBase* base = pos.m_node;
+        size_type idx = pos.m_index;
+        // 位于节点开头时优先追加到前一个节点末尾，避免移动元素
+        if(idx == 0 && base->prev != &m_sentinel) {
+            Node* prev = static_cast<Node*>(base->prev);
+            if(prev->count < K) {
+                return insert_at(prev, prev->count, std::forward<Args>(args)...);
+            }
+        }
+        if(base == &m_sentinel) {
+            return insert_new_node(m_sentinel.prev, std::forward<Args>(args)...);
+        }
+        Node* n = static_cast<Node*>(base);
+        if(n->count < K) {
+            return insert_at(n, idx, std::forward<Args>(args)...);
+        }
+        // 节点已满，将后半部分移入新节点；args 可能引用将被移动的元素，先构造出新元素
+        T value(std::forward<Args>(args)...);
+        Node* m = create_node(n);
+        constexpr size_type half = K / 2;
+        relocate(n->data() + half, K - half, m->data());
+        m->count = K - half;
+        n->count = half;
+        if(idx <= half) {
+            return insert_at(n, idx, std::move(value));
+        }
+        return insert_at(m, idx - half, std::move(value));
+    }
+
+    iterator erase(const_iterator pos) {
+        if(pos == cend()) {
+            throw std::out_of_range("MyUnrolledList::erase");
+        }
+        Node* n = static_cast<Node*>(pos.m_node);
+        size_type idx = pos.m_index;
+        T* data = n->data();
+        std::move(data + idx + 1, data + n->count, data + idx);
+        std::destroy_at(data + n->count - 1);
+        --n->count;
+        --m_size;
+        if(n->count == 0) {
+            NodeBase* next = n->next;
+            destroy_node(n);
+            return iterator(next, 0);
+        }
+        // 节点不足半满时尝试并入后继节点
+        if(n->count < K / 2 && n->next != &m_sentinel) {
+            Node* next = static_cast<Node*>(n->next);
+            if(n->count + next->count <= K) {
+                relocate(next->data(), next->count, data + n->count);
+                n->count += next->count;
+                next->count = 0;
+                destroy_node(next);
+            }
+        }
+        if(idx == n->count) {
+            return iterator(n->next, 0);
+        }
+        return iterator(n, idx);
+    }
+    iterator erase(const_iterator first, const_iterator last) {
+        // 删除可能合并节点使 last 失效，因此按元素个数删除
+        size_type count = static_cast<size_type>(std::distance(first, last));
+        iterator it(first.m_node, first.m_index);
+        for(; count > 0; --count) {
+            it = erase(it);
+        }
+        return it;
+    }
+    void clear() noexcept {
+        for(NodeBase* p = m_sentinel.next; p != &m_sentinel;) {
+            Node* n = static_cast<Node*>(p);
+            p = p->next;
+            std::destroy(n->data(), n->data() + n->count);
+            m_alloc.deallocate(n, 1);
+        }
+        reset_sentinel();
+        m_size = 0;
+        m_nodes = 0;
+    }
+
+    // 迭代器
+    iterator begin() noexcept { return iterator(m_sentinel.next, 0); }
+    const_iterator begin() const noexcept { return const_iterator(m_sentinel.next, 0); }
+    iterator end() noexcept { return iterator(&m_sentinel, 0); }
+    const_iterator end() const noexcept { return const_iterator(sentinel(), 0); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator crend() const noexcept { return const_reverse_iterator(begin()); }
+
+    // 交换
+    void swap(MyUnrolledList& o) noexcept {
+        MyUnrolledList tmp(std::move(o));
+        o.take_links(*this);
+        take_links(tmp);
+    }
+
+private:
+    struct NodeBase {
+        NodeBase* prev;
+        NodeBase* next;
+    };
+    struct Node : NodeBase {
+        size_type count;
+        alignas(T) unsigned char storage[K * sizeof(T)];
+
+        T* data() noexcept { return reinterpret_cast<T*>(storage); }
+    };
+
+    NodeBase m_sentinel;
+    size_type m_size;
+    size_type m_nodes = 0;
+    std::allocator<Node> m_alloc;
+
+    // 辅助函数
+    NodeBase* sentinel() const noexcept { return const_cast<NodeBase*>(&m_sentinel); }
+    Node* first_node() const noexcept { return static_cast<Node*>(m_sentinel.next); }
+    Node* last_node() const noexcept { return static_cast<Node*>(m_sentinel.prev); }
+    void reset_sentinel() noexcept {
+        m_sentinel.prev = &m_sentinel;
+        m_sentinel.next = &m_sentinel;
+    }
+    // 接管 o 的全部节点，o 变为空链表；调用前本链表必须为空
+    void take_links(MyUnrolledList& o) noexcept {
+        if(o.m_sentinel.next != &o.m_sentinel) {
+            m_sentinel = o.m_sentinel;
+            m_sentinel.next->prev = &m_sentinel;
+            m_sentinel.prev->next = &m_sentinel;
+        }
+        m_size = o.m_size;
+        m_nodes = o.m_nodes;
+        o.reset_sentinel();
+        o.m_size = 0;
+        o.m_nodes = 0;
+    }
+    Node* create_node(NodeBase* prev) {
+        Node* n = m_alloc.allocate(1);
+        n->count = 0;
+        n->prev = prev;
+        n->next = prev->next;
+        prev->next->prev = n;
+        prev->next = n;
+        ++m_nodes;
+        return n;
+    }
+    void destroy_node(Node* n) noexcept {
+        n->prev->next = n->next;
+        n->next->prev = n->prev;
+        m_alloc.deallocate(n, 1);
+        --m_nodes;
+    }
+    // 将 count 个元素移动构造到未初始化的 dest，并销毁源元素
+    static void relocate(T* src, size_type count, T* dest) {
+        std::uninitialized_move(src, src + count, dest);
+        std::destroy(src, src + count);
+    }
+    // 在未满节点 n 的 idx 处构造元素
+    template <typename... Args>
+    iterator insert_at(Node* n, size_type idx, Args&&... args) {
+        T* data = n->data();
+        if(idx == n->count) {
+            ::new (static_cast<void*>(data + idx)) T(std::forward<Args>(args)...);
+        } else {
+            T tmp(std::forward<Args>(args)...);
+            ::new (static_cast<void*>(data + n->count)) T(std::move(data[n->count - 1]));
+            std::move_backward(data + idx, data + n->count - 1, data + n->count);
+            data[idx] = std::move(tmp);
+        }
+        ++n->count;
+        ++m_size;
+        return iterator(n, idx);
+    }
+    // 在 prev 之后新建节点并构造第一个元素；构造失败时移除新节点，不留下空节点
+    template <typename... Args>
+    iterator insert_new_node(NodeBase* prev, Args&&... args) {
+        Node* n = create_node(prev);
+        try {
+            return insert_at(n, 0, std::forward<Args>(args)...);
+        } catch(...) {
+            destroy_node(n);
+            throw;
+        }
+    }
+    // 尾部追加时总是填满最后一个节点再开新节点
+    template <typename... Args>
+    void emplace_back_impl(Args&&... args) {
+        if(m_sentinel.prev == &m_sentinel || last_node()->count == K) {
+            insert_new_node(m_sentinel.prev, std::forward<Args>(args)...);
+            return;
+        }
+        Node* n = last_node();
+        insert_at(n, n->count, std::forward<Args>(args)...);
+    }
+};
+
+template <typename T, std::size_t K>
+class MyUnrolledList<T, K>::iterator {
+    friend class MyUnrolledList<T, K>;
+public:
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using pointer = T*;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    iterator() : m_node(nullptr), m_index(0) {}
+    iterator(NodeBase* node, size_type index) : m_node(node), m_index(index) {}
+
+    reference operator*() const { return static_cast<Node*>(m_node)->data()[m_index]; }
+    pointer operator->() const { return static_cast<Node*>(m_node)->data() + m_index; }
+    iterator& operator++() {
+        if(++m_index == static_cast<Node*>(m_node)->count) {
+            m_node = m_node->next;
+            m_index = 0;
+        }
+        return *this;
+    }
+    iterator operator++(int) {
+        iterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+    iterator& operator--() {
+        if(m_index == 0) {
+            m_node = m_node->prev;
+            m_index = static_cast<Node*>(m_node)->count - 1;
+        } else {
+            --m_index;
+        }
+        return *this;
+    }
+    iterator operator--(int) {
+        iterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+    bool operator==(const iterator& o) const { return m_node == o.m_node && m_index == o.m_index; }
+    bool operator!=(const iterator& o) const { return !(*this == o); }
+private:
+    NodeBase* m_node;
+    size_type m_index;
+};
+
+template <typename T, std::size_t K>
+class MyUnrolledList<T, K>::const_iterator {
+    friend class MyUnrolledList<T, K>;
+public:
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using reference = const T&;
+    using pointer = const T*;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    const_iterator() : m_node(nullptr), m_index(0) {}
+    const_iterator(NodeBase* node, size_type index) : m_node(node), m_index(index) {}
+    const_iterator(const iterator& o) : m_node(o.m_node), m_index(o.m_index) {}
+
+    reference operator*() const { return static_cast<Node*>(m_node)->data()[m_index]; }
+    pointer operator->() const { return static_cast<Node*>(m_node)->data() + m_index; }
+    const_iterator& operator++() {
+        if(++m_index == static_cast<Node*>(m_node)->count) {
+            m_node = m_node->next;
+            m_index = 0;
+        }
+        return *this;
+    }
+    const_iterator operator++(int) {
+        const_iterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+    const_iterator& operator--() {
+        if(m_index == 0) {
+            m_node = m_node->prev;
+            m_index = static_cast<Node*>(m_node)->count - 1;
+        } else {
+            --m_index;
+        }
+        return *this;
+    }
+    const_iterator operator--(int) {
+        const_iterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+    bool operator==(const const_iterator& o) const { return m_node == o.m_node && m_index == o.m_index; }
+    bool operator!=(const const_iterator& o) const { return !(*this == o); }
+private:
+    NodeBase* m_node;
+    size_type m_index;
+};
+
+template <typename T, std::size_t K>
+bool operator==(const MyUnrolledList<T, K>& lhs, const MyUnrolledList<T, K>& rhs) {
+    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename T, std::size_t K>
+bool operator!=(const MyUnrolledList<T, K>& lhs, const MyUnrolledList<T, K>& rhs) {
+    return !(lhs == rhs);
+}
+
+#endif // MY_UNROLLED_LIST_H
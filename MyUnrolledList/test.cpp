@@ -0,0 +1,248 @@
+#include "my_unrolled_list.hpp"
+#include <iostream>
+#include <cassert>
+#include <list>
+#include <random>
+#include <string>
+#include <stdexcept>
+
+// 辅助函数，用于输出 MyUnrolledList 的内容
+template <typename T, std::size_t K>
+void printMyUnrolledList(const MyUnrolledList<T, K>& lst, const std::string& message = "") {
+    if (!message.empty()) {
+        std::cout << message << ": ";
+    }
+    std::cout << "[";
+    for (auto it = lst.begin(); it != lst.end(); ++it) {
+        std::cout << *it;
+        auto temp = it;
+        ++temp;
+        if (temp != lst.end()) {
+            std::cout << ", ";
+        }
+    }
+    std::cout << "]" << std::endl;
+}
+
+template <typename T, std::size_t K>
+bool sameAs(const MyUnrolledList<T, K>& lst, const std::list<T>& ref) {
+    if (lst.size() != ref.size()) {
+        return false;
+    }
+    auto it = ref.begin();
+    for (const T& x : lst) {
+        if (x != *it++) {
+            return false;
+        }
+    }
+    // 反向遍历同样需要一致
+    auto rit = ref.rbegin();
+    for (auto r = lst.rbegin(); r != lst.rend(); ++r) {
+        if (*r != *rit++) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 拷贝时可以按需抛出异常的元素类型
+struct ThrowOnCopy {
+    int value;
+    bool fail = false;
+
+    explicit ThrowOnCopy(int v) : value(v) {}
+    ThrowOnCopy(const ThrowOnCopy& o) : value(o.value) {
+        if (o.fail) {
+            throw std::runtime_error("ThrowOnCopy");
+        }
+    }
+    ThrowOnCopy(ThrowOnCopy&& o) noexcept : value(o.value) {}
+    ThrowOnCopy& operator=(const ThrowOnCopy&) = default;
+    ThrowOnCopy& operator=(ThrowOnCopy&&) noexcept = default;
+};
+
+int main() {
+    // 1) 构造函数测试
+    std::cout << "===== 1) Constructor test =====" << std::endl;
+    {
+        MyUnrolledList<int> list1;
+        assert(list1.empty() && list1.node_count() == 0);
+
+        MyUnrolledList<int, 4> list2(10, 7);
+        assert(list2.size() == 10);
+        // 尾部追加会填满节点
+        assert(list2.node_count() == 3);
+        for (int x : list2) {
+            assert(x == 7);
+        }
+
+        MyUnrolledList<int, 4> list3 = {1, 2, 3, 4, 5};
+        MyUnrolledList<int, 4> list4(list3);
+        assert(list3 == list4);
+        printMyUnrolledList(list4, "list4 copy of list3");
+
+        MyUnrolledList<int, 4> list5(std::move(list4));
+        assert(list5 == list3 && list4.empty());
+        // 被移动的链表可以继续使用
+        list4.push_back(1);
+        assert(list4.size() == 1 && list4.front() == 1);
+        std::cout << "Constructor test passed.\n" << std::endl;
+    }
+
+    // 2) push / pop 测试
+    std::cout << "===== 2) push/pop test =====" << std::endl;
+    {
+        MyUnrolledList<int, 4> listA;
+        for (int i = 0; i < 10; ++i) {
+            listA.push_back(i);
+            listA.push_front(-i);
+        }
+        assert(listA.size() == 20);
+        assert(listA.front() == -9 && listA.back() == 9);
+        listA.pop_front();
+        listA.pop_back();
+        assert(listA.front() == -8 && listA.back() == 8);
+        while (!listA.empty()) {
+            listA.pop_back();
+        }
+        assert(listA.node_count() == 0);
+        std::cout << "push/pop test passed.\n" << std::endl;
+    }
+
+    // 3) 中间插入分裂与删除合并测试
+    std::cout << "===== 3) insert/erase test =====" << std::endl;
+    {
+        MyUnrolledList<int, 4> listB = {0, 1, 2, 3};
+        assert(listB.node_count() == 1);
+        auto it = listB.begin();
+        ++it;
+        ++it;
+        it = listB.insert(it, 100);
+        assert(*it == 100);
+        // 满节点插入后分裂
+        assert(listB.node_count() == 2);
+        printMyUnrolledList(listB, "listB after insert into full node");
+
+        it = listB.erase(it);
+        assert(*it == 2);
+        it = listB.erase(listB.begin());
+        assert(*it == 1);
+        // 不足半满的节点与后继合并
+        assert(listB.node_count() == 1);
+        printMyUnrolledList(listB, "listB after erase");
+
+        auto last = listB.end();
+        --last;
+        it = listB.erase(listB.begin(), last);
+        assert(listB.size() == 1 && *it == 3);
+        std::cout << "insert/erase test passed.\n" << std::endl;
+    }
+
+    // 4) 随机操作与 std::list 对比
+    std::cout << "===== 4) randomized test =====" << std::endl;
+    {
+        std::mt19937 rng(42);
+        MyUnrolledList<int, 8> lst;
+        std::list<int> ref;
+        for (int step = 0; step < 20000; ++step) {
+            size_t pos = ref.empty() ? 0 : rng() % (ref.size() + 1);
+            auto it = lst.begin();
+            auto rit = ref.begin();
+            std::advance(it, pos);
+            std::advance(rit, pos);
+            if (rng() % 3 != 0 || ref.empty()) {
+                int v = static_cast<int>(rng() % 1000);
+                assert(*lst.insert(it, v) == v);
+                ref.insert(rit, v);
+            } else if (rit != ref.end()) {
+                lst.erase(it);
+                ref.erase(rit);
+            }
+        }
+        assert(sameAs(lst, ref));
+        // 节点平均至少半满
+        assert(lst.node_count() <= lst.size() / 4 + 1);
+        std::cout << "randomized test passed.\n" << std::endl;
+    }
+
+    // 5) 非平凡类型与 swap 测试
+    std::cout << "===== 5) string and swap test =====" << std::endl;
+    {
+        MyUnrolledList<std::string, 3> listC = {"a", "b", "c", "d"};
+        MyUnrolledList<std::string, 3> listD = {"x"};
+        listC.emplace(++listC.begin(), 5, 'z');
+        listC.swap(listD);
+        assert(listC.size() == 1 && listC.front() == "x");
+        assert(listD.size() == 5 && *++listD.begin() == "zzzzz");
+        printMyUnrolledList(listD, "listD after swap");
+        std::cout << "string and swap test passed.\n" << std::endl;
+    }
+
+    // 6) 插入链表自身的元素
+    std::cout << "===== 6) self insert test =====" << std::endl;
+    {
+        // 插入满节点时会把后半部分移入新节点，参数引用的元素不能先被移走
+        MyUnrolledList<std::string, 4> listE;
+        for (int i = 0; i < 4; ++i) {
+            listE.push_back(std::string(30, static_cast<char>('a' + i)));
+        }
+        listE.insert(listE.begin(), listE.back());
+        assert(listE.size() == 5 && listE.front() == std::string(30, 'd') && listE.back() == std::string(30, 'd'));
+        for (int i = 0; i < 50; ++i) {
+            auto mid = listE.begin();
+            std::advance(mid, listE.size() / 2);
+            listE.emplace(mid, listE.back());
+            listE.insert(listE.begin(), listE.front());
+        }
+        assert(listE.size() == 105);
+        for (const std::string& s : listE) {
+            assert(s.size() == 30);
+        }
+        std::cout << "self insert test passed.\n" << std::endl;
+    }
+
+    // 7) 元素构造抛出异常
+    std::cout << "===== 7) throwing constructor test =====" << std::endl;
+    {
+        // 新开节点后构造元素失败，不能留下空节点
+        MyUnrolledList<ThrowOnCopy, 4> listF;
+        for (int i = 0; i < 4; ++i) {
+            listF.push_back(ThrowOnCopy(i));
+        }
+        ThrowOnCopy bad(99);
+        bad.fail = true;
+        bool thrown = false;
+        try {
+            listF.push_back(bad);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown && listF.size() == 4 && listF.node_count() == 1);
+        thrown = false;
+        try {
+            listF.emplace(listF.end(), bad);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown && listF.size() == 4 && listF.node_count() == 1);
+        int expect = 0;
+        for (const ThrowOnCopy& x : listF) {
+            assert(x.value == expect++);
+        }
+        // 空链表同样如此
+        MyUnrolledList<ThrowOnCopy, 4> listG;
+        thrown = false;
+        try {
+            listG.push_back(bad);
+        } catch (const std::runtime_error&) {
+            thrown = true;
+        }
+        assert(thrown && listG.empty() && listG.node_count() == 0 && listG.begin() == listG.end());
+        listF.push_back(ThrowOnCopy(4));
+        assert(listF.size() == 5 && listF.node_count() == 2 && listF.back().value == 4);
+        std::cout << "throwing constructor test passed.\n" << std::endl;
+    }
+
+    std::cout << "All MyUnrolledList tests passed successfully!" << std::endl;
+    return 0;
+}
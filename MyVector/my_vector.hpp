@@ -2,18 +2,34 @@
 #define MY_VECTOR_H
 
 #include <cstddef>
+#include <cstring>
 #include <memory>
 #include <initializer_list>
 #include <algorithm>
 #include <stdexcept>
 #include <type_traits>
 #include <iterator>
-
-template <typename T>
+#include <utility>
+#include <array>
+
+// C++20 起常量求值中可以动态分配内存，此时所有成员函数均为 constexpr
+#if defined(__cpp_lib_constexpr_dynamic_alloc) && __cpp_lib_constexpr_dynamic_alloc >= 201907L
+#define MY_VECTOR_CONSTEXPR constexpr
+#define MY_VECTOR_HAS_CONSTEXPR 1
+#else
+#define MY_VECTOR_CONSTEXPR
+#define MY_VECTOR_HAS_CONSTEXPR 0
+#endif
+
+template <typename Vector>
+class MyVectorParallel;
+
+template <typename T, typename Allocator = std::allocator<T>>
 class MyVector {
 public:
     // 类型别名
-    using value_tpe = T;
+    using value_type = T;
+    using allocator_type = Allocator;
     using size_type = std::size_t;
     using difference_type = std::ptrdiff_t;
     using reference = T&;
@@ -26,171 +42,191 @@ public:
     using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
     // 构造函数
-    MyVector();
-    MyVector(size_type cnt);
-    MyVector(size_type cnt, const_reference value);
-    MyVector(std::initializer_list<T> list);
-    MyVector(const MyVector& o);
-    MyVector(MyVector&& o) noexcept;
+    MY_VECTOR_CONSTEXPR MyVector();
+    MY_VECTOR_CONSTEXPR MyVector(size_type cnt);
+    MY_VECTOR_CONSTEXPR MyVector(size_type cnt, const_reference value);
+    MY_VECTOR_CONSTEXPR MyVector(std::initializer_list<T> list);
+    MY_VECTOR_CONSTEXPR MyVector(const MyVector& o);
+    MY_VECTOR_CONSTEXPR MyVector(MyVector&& o) noexcept;
 
     // 析构函数
-    ~MyVector();
+    MY_VECTOR_CONSTEXPR ~MyVector();
 
     // 赋值运算符
-    MyVector& operator=(const MyVector& o);
-    MyVector& operator=(MyVector&& o) noexcept;
-    MyVector& operator=(std::initializer_list<T> list);
+    MY_VECTOR_CONSTEXPR MyVector& operator=(const MyVector& o);
+    MY_VECTOR_CONSTEXPR MyVector& operator=(MyVector&& o) noexcept;
+    MY_VECTOR_CONSTEXPR MyVector& operator=(std::initializer_list<T> list);
 
     // 容量
-    size_type size() const;
-    size_type capacity() const;
-    bool empty() const;
-    void reserve(size_type n);
-    void shrink_to_fit();
+    MY_VECTOR_CONSTEXPR size_type size() const;
+    MY_VECTOR_CONSTEXPR size_type capacity() const;
+    MY_VECTOR_CONSTEXPR bool empty() const;
+    MY_VECTOR_CONSTEXPR void reserve(size_type n);
+    MY_VECTOR_CONSTEXPR void shrink_to_fit();
 
     // 元素访问
-    reference operator[](size_type pos);
-    const_reference operator[](size_type pos) const;
-    reference at(size_type pos);
-    const_reference at(size_type pos) const;
-    reference front();
-    const_reference front() const;
-    reference back();
-    const_reference back() const;
-    pointer data();
-    const_pointer data() const;
+    MY_VECTOR_CONSTEXPR reference operator[](size_type pos);
+    MY_VECTOR_CONSTEXPR const_reference operator[](size_type pos) const;
+    MY_VECTOR_CONSTEXPR reference at(size_type pos);
+    MY_VECTOR_CONSTEXPR const_reference at(size_type pos) const;
+    MY_VECTOR_CONSTEXPR reference front();
+    MY_VECTOR_CONSTEXPR const_reference front() const;
+    MY_VECTOR_CONSTEXPR reference back();
+    MY_VECTOR_CONSTEXPR const_reference back() const;
+    MY_VECTOR_CONSTEXPR pointer data();
+    MY_VECTOR_CONSTEXPR const_pointer data() const;
 
     // 修改器
-    void push_back(const_reference val);
-    void push_back(T&& val);
-    void pop_back();
-    iterator insert(const_iterator pos, const_reference val);
-    iterator insert(const_iterator pos, T&& val);
-    iterator insert(const_iterator pos, size_type cnt, const_reference val);
+    MY_VECTOR_CONSTEXPR void push_back(const_reference val);
+    MY_VECTOR_CONSTEXPR void push_back(T&& val);
+    MY_VECTOR_CONSTEXPR void pop_back();
+    MY_VECTOR_CONSTEXPR iterator insert(const_iterator pos, const_reference val);
+    MY_VECTOR_CONSTEXPR iterator insert(const_iterator pos, T&& val);
+    MY_VECTOR_CONSTEXPR iterator insert(const_iterator pos, size_type cnt, const_reference val);
     template <typename InputIterator>
-    typename std::enable_if_t<
+    MY_VECTOR_CONSTEXPR typename std::enable_if_t<
         !std::is_void_v<typename std::iterator_traits<InputIterator>::value_type> &&
         std::is_same_v<T, typename std::iterator_traits<InputIterator>::value_type>,
         iterator
     >
     insert(const_iterator pos, InputIterator first, InputIterator last);
     template <typename... Args>
-    iterator emplace(const_iterator pos, Args&&... args);
-    iterator erase(const_iterator pos);
-    iterator erase(const_iterator first, const_iterator last);
-    void clear();
-    void resize(size_type n);
-    void resize(size_type n, const_reference val);
+    MY_VECTOR_CONSTEXPR iterator emplace(const_iterator pos, Args&&... args);
+    MY_VECTOR_CONSTEXPR iterator erase(const_iterator pos);
+    MY_VECTOR_CONSTEXPR iterator erase(const_iterator first, const_iterator last);
+    MY_VECTOR_CONSTEXPR iterator unordered_erase(const_iterator pos);
+    MY_VECTOR_CONSTEXPR size_type remove(const_reference value);
+    template <typename UnaryPredicate>
+    MY_VECTOR_CONSTEXPR size_type remove_if(UnaryPredicate pred);
+    MY_VECTOR_CONSTEXPR void clear();
+    MY_VECTOR_CONSTEXPR void resize(size_type n);
+    MY_VECTOR_CONSTEXPR void resize(size_type n, const_reference val);
 
     // 迭代器
-    iterator begin();
-    const_iterator begin() const;
-    iterator end();
-    const_iterator end() const;
-    const_iterator cbegin() const;
-    const_iterator cend() const;
-    reverse_iterator rbegin();
-    const_reverse_iterator rbegin() const;
-    reverse_iterator rend();
-    const_reverse_iterator rend() const;
-    const_reverse_iterator crbegin() const;
-    const_reverse_iterator crend() const;
+    MY_VECTOR_CONSTEXPR iterator begin();
+    MY_VECTOR_CONSTEXPR const_iterator begin() const;
+    MY_VECTOR_CONSTEXPR iterator end();
+    MY_VECTOR_CONSTEXPR const_iterator end() const;
+    MY_VECTOR_CONSTEXPR const_iterator cbegin() const;
+    MY_VECTOR_CONSTEXPR const_iterator cend() const;
+    MY_VECTOR_CONSTEXPR reverse_iterator rbegin();
+    MY_VECTOR_CONSTEXPR const_reverse_iterator rbegin() const;
+    MY_VECTOR_CONSTEXPR reverse_iterator rend();
+    MY_VECTOR_CONSTEXPR const_reverse_iterator rend() const;
+    MY_VECTOR_CONSTEXPR const_reverse_iterator crbegin() const;
+    MY_VECTOR_CONSTEXPR const_reverse_iterator crend() const;
 
     // 交换
-    void swap(MyVector& o) noexcept;
+    MY_VECTOR_CONSTEXPR void swap(MyVector& o) noexcept;
 
 private:
+    // 并行构造与 NUMA 放置在 my_vector_parallel.hpp 中实现
+    template <typename Vector>
+    friend class MyVectorParallel;
+
+    using alloc_traits = std::allocator_traits<Allocator>;
+
     pointer m_data;
     size_type m_size;
     size_type m_capacity;
-    std::allocator<T> m_allocator;
+    Allocator m_allocator;
 
-    void allocate_space(size_type new_capacity);
+    MY_VECTOR_CONSTEXPR void allocate_space(size_type new_capacity);
+    MY_VECTOR_CONSTEXPR void relocate_to(pointer new_data, size_type offset, size_type cnt);
+    MY_VECTOR_CONSTEXPR void destroy_range(pointer first, pointer last);
+    template <typename InputIterator>
+    MY_VECTOR_CONSTEXPR void assign_range(InputIterator first, size_type cnt);
+    MY_VECTOR_CONSTEXPR pointer open_gap(size_type offset, size_type cnt);
+    MY_VECTOR_CONSTEXPR void close_gap(size_type offset, size_type cnt);
 };
 
 // 全局运算符重载
-template <typename T>
-bool operator==(const MyVector<T>& lhs, const MyVector<T>& rhs);
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR bool operator==(const MyVector<T, Allocator>& lhs, const MyVector<T, Allocator>& rhs);
 
-template <typename T>
-bool operator!=(const MyVector<T>& lhs, const MyVector<T>& rhs);
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR bool operator!=(const MyVector<T, Allocator>& lhs, const MyVector<T, Allocator>& rhs);
 
-// 具体实现
+template <typename T, typename Allocator, typename U>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::size_type erase(MyVector<T, Allocator>& vec, const U& value);
 
-template <typename T>
-MyVector<T>::MyVector() : m_data(nullptr), m_size(0), m_capacity(0) {}
+template <typename T, typename Allocator, typename UnaryPredicate>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::size_type erase_if(MyVector<T, Allocator>& vec, UnaryPredicate pred);
 
-template <typename T>
-MyVector<T>::MyVector(size_type cnt) : m_data(nullptr), m_size(cnt), m_capacity(cnt) {
-    if (cnt > 0) {
-        m_data = m_allocator.allocate(cnt);
-        for (size_type i = 0; i < cnt; ++i) {
-            m_allocator.construct(m_data + i);
-        }
+#if MY_VECTOR_HAS_CONSTEXPR
+// 将编译期生成的 MyVector 固化为 std::array，Make 为返回 MyVector 的无捕获 lambda
+// 编译期分配的内存不能留到运行期，因此先求出长度，再逐个复制到定长数组
+template <auto Make>
+constexpr auto my_vector_freeze() {
+    using vector_type = decltype(Make());
+    constexpr std::size_t n = Make().size();
+    std::array<typename vector_type::value_type, n> out{};
+    vector_type vec = Make();
+    for(std::size_t i = 0; i < n; ++i) {
+        out[i] = vec[i];
     }
+    return out;
 }
+#endif
 
-template <typename T>
-MyVector<T>::MyVector(size_type cnt, const_reference value) : m_data(nullptr), m_size(cnt), m_capacity(cnt) {
-    if (cnt > 0) {
-        m_data = m_allocator.allocate(cnt);
-        for (size_type i = 0; i < cnt; ++i) {
-            m_allocator.construct(m_data + i, value);
-        }
-    }
+// 具体实现
+
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR MyVector<T, Allocator>::MyVector() : m_data(nullptr), m_size(0), m_capacity(0) {}
+
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR MyVector<T, Allocator>::MyVector(size_type cnt) : m_data(nullptr), m_size(0), m_capacity(0) {
+    resize(cnt);
 }
 
-template <typename T>
-MyVector<T>::MyVector(std::initializer_list<T> list) : m_data(nullptr), m_size(list.size()), m_capacity(list.size()) {
-    if (list.size() > 0) {
-        m_data = m_allocator.allocate(list.size());
-        std::copy(list.begin(), list.end(), m_data);
-    }
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR MyVector<T, Allocator>::MyVector(size_type cnt, const_reference value) : m_data(nullptr), m_size(0), m_capacity(0) {
+    resize(cnt, value);
 }
 
-template <typename T>
-MyVector<T>::MyVector(const MyVector& o) : m_data(nullptr), m_size(o.m_size), m_capacity(o.m_capacity) {
-    if (o.m_size > 0) {
-        m_data = m_allocator.allocate(o.m_capacity);
-         std::copy(o.m_data, o.m_data + m_size, m_data);
-    }
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR MyVector<T, Allocator>::MyVector(std::initializer_list<T> list) : m_data(nullptr), m_size(0), m_capacity(0) {
+    assign_range(list.begin(), list.size());
+}
+
+// 只按元素个数分配，不复制 o 的多余容量
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR MyVector<T, Allocator>::MyVector(const MyVector& o)
+    : m_data(nullptr), m_size(0), m_capacity(0), m_allocator(alloc_traits::select_on_container_copy_construction(o.m_allocator)) {
+    assign_range(o.m_data, o.m_size);
 }
 
-template <typename T>
-MyVector<T>::MyVector(MyVector&& o) noexcept : m_data(o.m_data), m_size(o.m_size), m_capacity(o.m_capacity) {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR MyVector<T, Allocator>::MyVector(MyVector&& o) noexcept
+    : m_data(o.m_data), m_size(o.m_size), m_capacity(o.m_capacity), m_allocator(std::move(o.m_allocator)) {
     o.m_data = nullptr;
     o.m_size = 0;
     o.m_capacity = 0;
 }
 
-template <typename T>
-MyVector<T>::~MyVector() {
-    for(size_type i = 0; i < m_size; ++i) {
-        m_allocator.destroy(m_data + i);
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR MyVector<T, Allocator>::~MyVector() {
+    destroy_range(m_data, m_data + m_size);
+    if(m_data) {
+        alloc_traits::deallocate(m_allocator, m_data, m_capacity);
     }
-    m_allocator.deallocate(m_data, m_capacity);
 }
 
-template <typename T>
-MyVector<T>& MyVector<T>::operator=(const MyVector& o) {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR MyVector<T, Allocator>& MyVector<T, Allocator>::operator=(const MyVector& o) {
     if(this != &o) {
-        if(m_capacity < o.m_size) {
-            clear();
-            m_allocator.deallocate(m_data, m_capacity);
-            m_data = m_allocator.allocate(o.m_capacity);
-            m_capacity = o.m_capacity;
-        }
-        m_size = o.m_size;
-        std::copy(o.m_data, o.m_data + m_size, m_data);
+        assign_range(o.m_data, o.m_size);
     }
     return *this;
 }
 
-template <typename T>
-MyVector<T>& MyVector<T>::operator=(MyVector&& o) noexcept {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR MyVector<T, Allocator>& MyVector<T, Allocator>::operator=(MyVector&& o) noexcept {
     if(this != &o) {
         clear();
-        m_allocator.deallocate(m_data, m_capacity);
+        if(m_data) {
+            alloc_traits::deallocate(m_allocator, m_data, m_capacity);
+        }
         m_data = o.m_data;
         m_size = o.m_size;
         m_capacity = o.m_capacity;
@@ -201,340 +237,396 @@ MyVector<T>& MyVector<T>::operator=(MyVector&& o) noexcept {
     return *this;
 }
 
-template <typename T>
-MyVector<T>& MyVector<T>::operator=(std::initializer_list<T> list) {
-    if(m_capacity < list.size()) {
-        clear();
-        m_allocator.deallocate(m_data, m_capacity);
-        m_data = m_allocator.allocate(list.size());
-        m_capacity = list.size();
-    }
-    m_size = list.size();
-    std::copy(list.begin(), list.end(), m_data);
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR MyVector<T, Allocator>& MyVector<T, Allocator>::operator=(std::initializer_list<T> list) {
+    assign_range(list.begin(), list.size());
     return *this;
 }
 
-template <typename T>
-typename MyVector<T>::size_type MyVector<T>::size() const {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::size_type MyVector<T, Allocator>::size() const {
     return m_size;
 }
 
-template <typename T>
-typename MyVector<T>::size_type MyVector<T>::capacity() const {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::size_type MyVector<T, Allocator>::capacity() const {
     return m_capacity;
 }
 
-template <typename T>
-bool MyVector<T>::empty() const {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR bool MyVector<T, Allocator>::empty() const {
     return m_size == 0;
 }
 
-template <typename T>
-void MyVector<T>::reserve(size_type n) {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR void MyVector<T, Allocator>::reserve(size_type n) {
     if(n > m_capacity) {
         allocate_space(n);
-        m_capacity = n;
     }
 }
 
-template <typename T>
-void MyVector<T>::shrink_to_fit() {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR void MyVector<T, Allocator>::shrink_to_fit() {
     if(m_capacity > m_size) {
         allocate_space(m_size);
-        m_capacity = m_size;
     }
 }
 
-template <typename T>
-typename MyVector<T>::reference MyVector<T>::operator[](size_type pos) {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::reference MyVector<T, Allocator>::operator[](size_type pos) {
     return m_data[pos];
 }
 
-template <typename T>
-typename MyVector<T>::const_reference MyVector<T>::operator[](size_type pos) const {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::const_reference MyVector<T, Allocator>::operator[](size_type pos) const {
     return m_data[pos];
 }
 
-template <typename T>
-typename MyVector<T>::reference MyVector<T>::at(size_type pos) {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::reference MyVector<T, Allocator>::at(size_type pos) {
     if(pos >= m_size) {
         throw std::out_of_range("MyVector::at");
     }
     return m_data[pos];
 }
 
-template <typename T>
-typename MyVector<T>::const_reference MyVector<T>::at(size_type pos) const {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::const_reference MyVector<T, Allocator>::at(size_type pos) const {
     if(pos >= m_size) {
         throw std::out_of_range("MyVector::at");
     }
     return m_data[pos];
 }
 
-template <typename T>
-typename MyVector<T>::reference MyVector<T>::front() {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::reference MyVector<T, Allocator>::front() {
     return m_data[0];
 }
 
-template <typename T>
-typename MyVector<T>::const_reference MyVector<T>::front() const {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::const_reference MyVector<T, Allocator>::front() const {
     return m_data[0];
 }
 
-template <typename T>
-typename MyVector<T>::reference MyVector<T>::back() {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::reference MyVector<T, Allocator>::back() {
     return m_data[m_size - 1];
 }
 
-template <typename T>
-typename MyVector<T>::const_reference MyVector<T>::back() const {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::const_reference MyVector<T, Allocator>::back() const {
     return m_data[m_size - 1];
 }
 
-template <typename T>
-typename MyVector<T>::pointer MyVector<T>::data() {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::pointer MyVector<T, Allocator>::data() {
     return m_data;
 }
 
-template <typename T>
-typename MyVector<T>::const_pointer MyVector<T>::data() const {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::const_pointer MyVector<T, Allocator>::data() const {
     return m_data;
 }
 
-template <typename T>
-void MyVector<T>::push_back(const_reference val) {
-    if(m_size == m_capacity) {
-        m_capacity = m_capacity ? m_capacity * 2 : 1;
-        allocate_space(m_capacity);
-    }
-    m_allocator.construct(m_data + m_size, val);
-    ++m_size;
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR void MyVector<T, Allocator>::push_back(const_reference val) {
+    emplace(end(), val);
 }
 
-template <typename T>
-void MyVector<T>::push_back(T&& val) {
-    if(m_size == m_capacity) {
-        m_capacity = m_capacity ? m_capacity * 2 : 1;
-        allocate_space(m_capacity);
-    }
-    m_allocator.construct(m_data + m_size, std::move(val));
-    ++m_size;
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR void MyVector<T, Allocator>::push_back(T&& val) {
+    emplace(end(), std::move(val));
 }
 
-template <typename T>
-void MyVector<T>::pop_back() {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR void MyVector<T, Allocator>::pop_back() {
     if(m_size > 0) {
-        m_allocator.destroy(m_data + m_size - 1);
+        alloc_traits::destroy(m_allocator, m_data + m_size - 1);
         --m_size;
     }
 }
 
-template <typename T>
-typename MyVector<T>::iterator MyVector<T>::insert(const_iterator pos, const_reference val) {
-    return insert(pos, 1, val);
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::iterator MyVector<T, Allocator>::insert(const_iterator pos, const_reference val) {
+    return emplace(pos, val);
 }
 
-template <typename T>
-typename MyVector<T>::iterator MyVector<T>::insert(const_iterator pos, T&& val) {
-    return insert(pos, 1, std::move(val));
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::iterator MyVector<T, Allocator>::insert(const_iterator pos, T&& val) {
+    return emplace(pos, std::move(val));
 }
 
-template <typename T>
-typename MyVector<T>::iterator MyVector<T>::insert(const_iterator pos, const size_type cnt, const_reference val) {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::iterator MyVector<T, Allocator>::insert(const_iterator pos, const size_type cnt, const_reference val) {
     if(pos < begin() || pos > end()) {
         throw std::out_of_range("MyVector::insert");
     }
-    size_type offeset = pos - begin();
-    if(m_size + cnt > m_capacity) {
-        m_capacity = m_capacity ? m_capacity * 2 : 1;
-        allocate_space(m_capacity);
-        pos = begin() + offeset;
-    }
-    if(pos < end()) {
-        std::copy_backward(const_cast<iterator>(pos), end(), end() + cnt);
-    }
-    m_size += cnt;
-    for(size_type i = 0; i < cnt; ++i) {
-        m_allocator.construct(pos + i, val);
+    size_type offset = pos - begin();
+    // val 可能引用本向量中的元素，腾挪前先复制
+    T tmp(val);
+    pointer gap = open_gap(offset, cnt);
+    size_type i = 0;
+    try {
+        for(; i < cnt; ++i) {
+            alloc_traits::construct(m_allocator, gap + i, tmp);
+        }
+    } catch(...) {
+        destroy_range(gap, gap + i);
+        close_gap(offset, cnt);
+        throw;
     }
-    return const_cast<iterator>(pos);
+    return gap;
 }
 
-template <typename T>
+template <typename T, typename Allocator>
 template <typename InputIterator>
-typename std::enable_if_t<
+MY_VECTOR_CONSTEXPR typename std::enable_if_t<
     !std::is_void_v<typename std::iterator_traits<InputIterator>::value_type> &&
     std::is_same_v<T, typename std::iterator_traits<InputIterator>::value_type>,
-    typename MyVector<T>::iterator
+    typename MyVector<T, Allocator>::iterator
 >
-MyVector<T>::insert(const_iterator pos, InputIterator first, InputIterator last) {
+MyVector<T, Allocator>::insert(const_iterator pos, InputIterator first, InputIterator last) {
     if(pos < begin() || pos > end()) {
         throw std::out_of_range("MyVector::insert");
     }
     size_type cnt = static_cast<size_type>(std::distance(first, last));
-    size_type offeset = pos - begin();
-    if(m_size + cnt > m_capacity) {
-        m_capacity = m_capacity ? m_capacity * 2 : 1;
-        allocate_space(m_capacity);
-        pos = begin() + offeset;
-    }
-    if(pos < end()) {
-        std::copy_backward(const_cast<iterator>(pos), end(), end() + cnt);
+    size_type offset = pos - begin();
+    pointer gap = open_gap(offset, cnt);
+    if constexpr(std::is_trivially_copyable_v<T> && std::is_pointer_v<InputIterator>) {
+        // 连续存放的平凡类型整块复制（批量追加的常见情形）；常量求值中仍逐个构造
+#if MY_VECTOR_HAS_CONSTEXPR
+        if(!std::is_constant_evaluated())
+#endif
+        {
+            if(cnt != 0) {
+                std::memcpy(static_cast<void*>(gap), static_cast<const void*>(first), cnt * sizeof(T));
+            }
+            return gap;
+        }
     }
-    m_size += cnt;
-    for(size_type i = 0; i < cnt; ++i) {
-        m_allocator.construct(pos + i, *first++);
+    size_type i = 0;
+    try {
+        for(; i < cnt; ++i) {
+            alloc_traits::construct(m_allocator, gap + i, *first++);
+        }
+    } catch(...) {
+        destroy_range(gap, gap + i);
+        close_gap(offset, cnt);
+        throw;
     }
-    return const_cast<iterator>(pos);
+    return gap;
 }
 
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-typename MyVector<T>::iterator MyVector<T>::emplace(const_iterator pos, Args&&... args) {
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::iterator MyVector<T, Allocator>::emplace(const_iterator pos, Args&&... args) {
     if(pos < begin() || pos > end()) {
         throw std::out_of_range("MyVector::emplace");
     }
-    size_type offeset = pos - begin();
-    if(m_size == m_capacity) {
-        m_capacity = m_capacity ? m_capacity * 2 : 1;
-        allocate_space(m_capacity);
-        pos = begin() + offeset;
+    size_type offset = pos - begin();
+    if(offset == m_size) {
+        // 尾部插入：扩容时先在新空间构造新元素再搬迁旧元素，args 引用本向量元素也安全
+        if(m_size == m_capacity) {
+            size_type new_capacity = m_capacity ? m_capacity * 2 : 1;
+            pointer new_data = alloc_traits::allocate(m_allocator, new_capacity);
+            try {
+                alloc_traits::construct(m_allocator, new_data + m_size, std::forward<Args>(args)...);
+            } catch(...) {
+                alloc_traits::deallocate(m_allocator, new_data, new_capacity);
+                throw;
+            }
+            try {
+                relocate_to(new_data, m_size, 1);
+            } catch(...) {
+                alloc_traits::destroy(m_allocator, new_data + m_size);
+                alloc_traits::deallocate(m_allocator, new_data, new_capacity);
+                throw;
+            }
+            m_data = new_data;
+            m_capacity = new_capacity;
+        } else {
+            alloc_traits::construct(m_allocator, m_data + m_size, std::forward<Args>(args)...);
+        }
+        ++m_size;
+        return m_data + offset;
     }
-    if(pos < end()) {
-        std::copy_backward(const_cast<iterator>(pos), end(), end() + 1);
+    // 中间插入先构造临时对象，避免腾挪元素后 args 失效
+    T tmp(std::forward<Args>(args)...);
+    pointer gap = open_gap(offset, 1);
+    try {
+        alloc_traits::construct(m_allocator, gap, std::move_if_noexcept(tmp));
+    } catch(...) {
+        close_gap(offset, 1);
+        throw;
     }
-    ++m_size;
-    m_allocator.construct(pos, std::forward<Args>(args)...);
-    return const_cast<iterator>(pos);
+    return gap;
 }
 
-template <typename T>
-typename MyVector<T>::iterator MyVector<T>::erase(const_iterator pos) {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::iterator MyVector<T, Allocator>::erase(const_iterator pos) {
     return erase(pos, pos + 1);
 }
 
-template <typename T>
-typename MyVector<T>::iterator MyVector<T>::erase(const_iterator first, const_iterator last) {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::iterator MyVector<T, Allocator>::erase(const_iterator first, const_iterator last) {
     if(first < begin() || last > end() || first >= last) {
         throw std::out_of_range("MyVector::erase");
     }
-    size_type cnt = last - first;
-    for(size_type i = 0; i < cnt; ++i) {
-        m_allocator.destroy(first + i);
-    }
-    if(last < end()) {
-        std::copy(const_cast<iterator>(last), end(), const_cast<iterator>(first));
+    iterator dest = begin() + (first - cbegin());
+    iterator src = begin() + (last - cbegin());
+    iterator new_end = std::move(src, end(), dest);
+    destroy_range(new_end, end());
+    m_size = new_end - begin();
+    return dest;
+}
+
+// 用末尾元素填补被删除的位置，O(1)，不保持元素顺序
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::iterator MyVector<T, Allocator>::unordered_erase(const_iterator pos) {
+    if(pos < begin() || pos >= end()) {
+        throw std::out_of_range("MyVector::unordered_erase");
+    }
+    iterator hole = begin() + (pos - cbegin());
+    if(hole != end() - 1) {
+        *hole = std::move(back());
+    }
+    pop_back();
+    return hole;
+}
+
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::size_type MyVector<T, Allocator>::remove(const_reference value) {
+    // value 可能引用本向量中的元素，先复制
+    T copy(value);
+    return remove_if([&copy](const_reference x) { return x == copy; });
+}
+
+// 一趟线性压缩删除所有满足 pred 的元素，保持其余元素的顺序，返回删除的个数
+template <typename T, typename Allocator>
+template <typename UnaryPredicate>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::size_type MyVector<T, Allocator>::remove_if(UnaryPredicate pred) {
+    size_type kept = 0;
+    while(kept < m_size && !pred(static_cast<const_reference>(m_data[kept]))) {
+        ++kept;
+    }
+    if constexpr(std::is_trivially_copyable_v<T>) {
+        // 平凡类型无条件写入、按谓词结果推进写指针，循环内没有难以预测的分支
+        for(size_type i = kept; i < m_size; ++i) {
+            T val = m_data[i];
+            m_data[kept] = val;
+            kept += !pred(static_cast<const_reference>(val));
+        }
+    } else {
+        for(size_type i = kept; i < m_size; ++i) {
+            if(!pred(static_cast<const_reference>(m_data[i]))) {
+                m_data[kept++] = std::move(m_data[i]);
+            }
+        }
     }
-    m_size -= cnt;
-    return const_cast<iterator>(first);
+    size_type removed = m_size - kept;
+    destroy_range(m_data + kept, m_data + m_size);
+    m_size = kept;
+    return removed;
 }
 
-template <typename T>
-void MyVector<T>::clear() {
-    for(size_type i = 0; i < m_size; ++i) {
-        m_allocator.destroy(m_data + i);
-    }
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR void MyVector<T, Allocator>::clear() {
+    destroy_range(m_data, m_data + m_size);
     m_size = 0;
 }
 
-template <typename T>
-void MyVector<T>::resize(size_type n) {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR void MyVector<T, Allocator>::resize(size_type n) {
     if(n > m_size) {
         if(n > m_capacity) {
-            m_capacity = n;
-            allocate_space(m_capacity);
+            allocate_space(n);
         }
-        for(size_type i = m_size; i < n; ++i) {
-            m_allocator.construct(m_data + i);
+        for(; m_size < n; ++m_size) {
+            alloc_traits::construct(m_allocator, m_data + m_size);
         }
     } else {
-        for(size_type i = n; i < m_size; ++i) {
-            m_allocator.destroy(m_data + i);
-        }
+        destroy_range(m_data + n, m_data + m_size);
+        m_size = n;
     }
-    m_size = n;
 }
 
-template <typename T>
-void MyVector<T>::resize(size_type n, const_reference val) {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR void MyVector<T, Allocator>::resize(size_type n, const_reference val) {
     if(n > m_size) {
         if(n > m_capacity) {
-            m_capacity = n;
-            allocate_space(m_capacity);
+            allocate_space(n);
         }
-        for(size_type i = m_size; i < n; ++i) {
-            m_allocator.construct(m_data + i, val);
+        for(; m_size < n; ++m_size) {
+            alloc_traits::construct(m_allocator, m_data + m_size, val);
         }
     } else {
-        for(size_type i = n; i < m_size; ++i) {
-            m_allocator.destroy(m_data + i);
-        }
+        destroy_range(m_data + n, m_data + m_size);
+        m_size = n;
     }
-    m_size = n;
 }
 
-template <typename T>
-typename MyVector<T>::iterator MyVector<T>::begin() {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::iterator MyVector<T, Allocator>::begin() {
     return m_data;
 }
 
-template <typename T>
-typename MyVector<T>::const_iterator MyVector<T>::begin() const {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::const_iterator MyVector<T, Allocator>::begin() const {
     return m_data;
 }
 
-template <typename T>
-typename MyVector<T>::iterator MyVector<T>::end() {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::iterator MyVector<T, Allocator>::end() {
     return m_data + m_size;
 }
 
-template <typename T>
-typename MyVector<T>::const_iterator MyVector<T>::end() const {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::const_iterator MyVector<T, Allocator>::end() const {
     return m_data + m_size;
 }
 
-template <typename T>
-typename MyVector<T>::const_iterator MyVector<T>::cbegin() const {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::const_iterator MyVector<T, Allocator>::cbegin() const {
     return m_data;
 }
 
-template <typename T>
-typename MyVector<T>::const_iterator MyVector<T>::cend() const {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::const_iterator MyVector<T, Allocator>::cend() const {
     return m_data + m_size;
 }
 
-template <typename T>
-typename MyVector<T>::reverse_iterator MyVector<T>::rbegin() {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::reverse_iterator MyVector<T, Allocator>::rbegin() {
     return reverse_iterator(end());
 }
 
-template <typename T>
-typename MyVector<T>::const_reverse_iterator MyVector<T>::rbegin() const {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::const_reverse_iterator MyVector<T, Allocator>::rbegin() const {
     return const_reverse_iterator(end());
 }
 
-template <typename T>
-typename MyVector<T>::reverse_iterator MyVector<T>::rend() {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::reverse_iterator MyVector<T, Allocator>::rend() {
     return reverse_iterator(begin());
 }
 
-template <typename T>
-typename MyVector<T>::const_reverse_iterator MyVector<T>::rend() const {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::const_reverse_iterator MyVector<T, Allocator>::rend() const {
     return const_reverse_iterator(begin());
 }
 
-template <typename T>
-typename MyVector<T>::const_reverse_iterator MyVector<T>::crbegin() const {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::const_reverse_iterator MyVector<T, Allocator>::crbegin() const {
     return const_reverse_iterator(end());
 }
 
-template <typename T>
-typename MyVector<T>::const_reverse_iterator MyVector<T>::crend() const {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::const_reverse_iterator MyVector<T, Allocator>::crend() const {
     return const_reverse_iterator(begin());
 }
 
-template <typename T>
-void MyVector<T>::swap(MyVector& o) noexcept {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR void MyVector<T, Allocator>::swap(MyVector& o) noexcept {
     using std::swap;
     swap(m_data, o.m_data);
     swap(m_size, o.m_size);
@@ -542,26 +634,108 @@ void MyVector<T>::swap(MyVector& o) noexcept {
     swap(m_allocator, o.m_allocator);
 }
 
-template <typename T>
-void MyVector<T>::allocate_space(size_type new_capacity) {
-    pointer new_data = m_allocator.allocate(new_capacity);
-    for (size_type i = 0; i < m_size; ++i) {
-        m_allocator.construct(new_data + i, std::move_if_noexcept(m_data[i]));
-    }
-    for (size_type i = 0; i < m_size; ++i) {
-        m_allocator.destroy(m_data + i);
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR void MyVector<T, Allocator>::allocate_space(size_type new_capacity) {
+    pointer new_data = alloc_traits::allocate(m_allocator, new_capacity);
+    try {
+        relocate_to(new_data, m_size, 0);
+    } catch(...) {
+        alloc_traits::deallocate(m_allocator, new_data, new_capacity);
+        throw;
     }
-    m_allocator.deallocate(m_data, m_capacity);
     m_data = new_data;
     m_capacity = new_capacity;
 }
 
-template <typename T>
-bool operator==(const MyVector<T>& lhs, const MyVector<T>& rhs) {
+// 把全部元素搬到 new_data，offset 处留出 cnt 个空位，然后释放原缓冲区
+// 移动构造可能抛出异常时改用拷贝；失败时析构已构造的元素后重新抛出，原缓冲区不变，new_data 由调用方释放
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR void MyVector<T, Allocator>::relocate_to(pointer new_data, size_type offset, size_type cnt) {
+    size_type i = 0;
+    try {
+        for(; i < m_size; ++i) {
+            size_type dest = i < offset ? i : i + cnt;
+            alloc_traits::construct(m_allocator, new_data + dest, std::move_if_noexcept(m_data[i]));
+        }
+    } catch(...) {
+        destroy_range(new_data, new_data + std::min(i, offset));
+        if(i > offset) {
+            destroy_range(new_data + offset + cnt, new_data + i + cnt);
+        }
+        throw;
+    }
+    destroy_range(m_data, m_data + m_size);
+    if(m_data) {
+        alloc_traits::deallocate(m_allocator, m_data, m_capacity);
+    }
+}
+
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR void MyVector<T, Allocator>::destroy_range(pointer first, pointer last) {
+    for(; first != last; ++first) {
+        alloc_traits::destroy(m_allocator, first);
+    }
+}
+
+// 用 [first, first + cnt) 替换全部元素，已有元素赋值，不足部分构造
+template <typename T, typename Allocator>
+template <typename InputIterator>
+MY_VECTOR_CONSTEXPR void MyVector<T, Allocator>::assign_range(InputIterator first, size_type cnt) {
+    if(cnt > m_capacity) {
+        clear();
+        allocate_space(cnt);
+    }
+    size_type common = std::min(cnt, m_size);
+    for(size_type i = 0; i < common; ++i) {
+        m_data[i] = *first++;
+    }
+    for(; m_size < cnt; ++m_size) {
+        alloc_traits::construct(m_allocator, m_data + m_size, *first++);
+    }
+    destroy_range(m_data + cnt, m_data + m_size);
+    m_size = cnt;
+}
+
+// 在 offset 处腾出 cnt 个未构造的位置并返回其起始地址，m_size 已计入这些位置
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::pointer MyVector<T, Allocator>::open_gap(size_type offset, size_type cnt) {
+    if(m_size + cnt > m_capacity) {
+        size_type new_capacity = std::max(m_size + cnt, m_capacity * 2);
+        pointer new_data = alloc_traits::allocate(m_allocator, new_capacity);
+        try {
+            relocate_to(new_data, offset, cnt);
+        } catch(...) {
+            alloc_traits::deallocate(m_allocator, new_data, new_capacity);
+            throw;
+        }
+        m_data = new_data;
+        m_capacity = new_capacity;
+    } else {
+        for(size_type i = m_size; i > offset; --i) {
+            alloc_traits::construct(m_allocator, m_data + i - 1 + cnt, std::move(m_data[i - 1]));
+            alloc_traits::destroy(m_allocator, m_data + i - 1);
+        }
+    }
+    m_size += cnt;
+    return m_data + offset;
+}
+
+// 撤销 open_gap：把空位之后的元素移回原处
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR void MyVector<T, Allocator>::close_gap(size_type offset, size_type cnt) {
+    for(size_type i = offset + cnt; i < m_size; ++i) {
+        alloc_traits::construct(m_allocator, m_data + i - cnt, std::move(m_data[i]));
+        alloc_traits::destroy(m_allocator, m_data + i);
+    }
+    m_size -= cnt;
+}
+
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR bool operator==(const MyVector<T, Allocator>& lhs, const MyVector<T, Allocator>& rhs) {
     if(lhs.size() != rhs.size()) {
         return false;
     }
-    for(typename MyVector<T>::size_type i = 0; i < lhs.size(); ++i) {
+    for(typename MyVector<T, Allocator>::size_type i = 0; i < lhs.size(); ++i) {
         if(lhs[i] != rhs[i]) {
             return false;
         }
@@ -569,9 +743,19 @@ bool operator==(const MyVector<T>& lhs, const MyVector<T>& rhs) {
     return true;
 }
 
-template <typename T>
-bool operator!=(const MyVector<T>& lhs, const MyVector<T>& rhs) {
+template <typename T, typename Allocator>
+MY_VECTOR_CONSTEXPR bool operator!=(const MyVector<T, Allocator>& lhs, const MyVector<T, Allocator>& rhs) {
     return !(lhs == rhs);
 }
 
-#endif
\ No newline at end of file
+template <typename T, typename Allocator, typename U>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::size_type erase(MyVector<T, Allocator>& vec, const U& value) {
+    return vec.remove_if([&value](const T& x) { return x == value; });
+}
+
+template <typename T, typename Allocator, typename UnaryPredicate>
+MY_VECTOR_CONSTEXPR typename MyVector<T, Allocator>::size_type erase_if(MyVector<T, Allocator>& vec, UnaryPredicate pred) {
+    return vec.remove_if(pred);
+}
+
+#endif
@@ -0,0 +1,177 @@
+#ifndef MY_VECTOR_PARALLEL_H
+#define MY_VECTOR_PARALLEL_H
+
+#include <cstddef>
+#include <memory>
+#include <algorithm>
+#include <thread>
+#include <exception>
+#include <utility>
+
+#include "my_vector.hpp"
+#include "../MyAllocator/my_allocator.hpp"
+
+// MyVector 的并行构造与 NUMA 放置，需要时单独包含，基础容器不依赖线程与系统调用
+template <typename Vector>
+class MyVectorParallel {
+public:
+    using value_type = typename Vector::value_type;
+    using size_type = typename Vector::size_type;
+    using pointer = typename Vector::pointer;
+
+    // 并行版本的 resize：新增元素以 args 构造，需要扩容时一次分配到 n
+    // 先构造新增元素再搬移旧元素，两步都按同样的分段交给同一批节点，任一步失败时原内容不变
+    template <typename... Args>
+    static void grow(Vector& v, size_type n, const MyParallelOptions& opt, const Args&... args) {
+        using alloc_traits = typename Vector::alloc_traits;
+        if(n <= v.m_size) {
+            v.destroy_range(v.m_data + n, v.m_data + v.m_size);
+            v.m_size = n;
+            return;
+        }
+        auto make = [&v, &args...](pointer p, size_type) {
+            alloc_traits::construct(v.m_allocator, p, args...);
+        };
+        if(n <= v.m_capacity) {
+            if(opt.policy != MyNumaPolicy::local) {
+                my_numa_set_placement(v.m_data + v.m_size, (v.m_capacity - v.m_size) * sizeof(value_type), opt.policy, opt.node);
+            }
+            construct(v, v.m_data, n, v.m_size, n, opt, make);
+            v.m_size = n;
+            return;
+        }
+        pointer new_data = alloc_traits::allocate(v.m_allocator, n);
+        // 新分配的页尚未驻留，设置策略后由各线程首次写入时落到对应节点
+        if(opt.policy != MyNumaPolicy::local) {
+            my_numa_set_placement(new_data, n * sizeof(value_type), opt.policy, opt.node);
+        }
+        try {
+            construct(v, new_data, n, v.m_size, n, opt, make);
+        } catch(...) {
+            alloc_traits::deallocate(v.m_allocator, new_data, n);
+            throw;
+        }
+        try {
+            construct(v, new_data, n, 0, v.m_size, opt, [&v](pointer p, size_type i) {
+                alloc_traits::construct(v.m_allocator, p, std::move_if_noexcept(v.m_data[i]));
+            });
+        } catch(...) {
+            v.destroy_range(new_data + v.m_size, new_data + n);
+            alloc_traits::deallocate(v.m_allocator, new_data, n);
+            throw;
+        }
+        v.destroy_range(v.m_data, v.m_data + v.m_size);
+        if(v.m_data) {
+            alloc_traits::deallocate(v.m_allocator, v.m_data, v.m_capacity);
+        }
+        v.m_data = new_data;
+        v.m_size = n;
+        v.m_capacity = n;
+    }
+
+private:
+    // 把 [0, total) 均分为若干段，每个线程构造自己那段与 [first, last) 的交集，make(p, i) 在 p 处构造第 i 个元素
+    // policy 为 local 时第 w 个线程绑定到第 w * nodes / threads 个节点，bind 时全部绑定到目标节点
+    // 任一线程抛出异常时析构所有已构造的元素，再重新抛出第一个异常
+    template <typename Make>
+    static void construct(Vector& v, pointer dst, size_type total, size_type first, size_type last, const MyParallelOptions& opt, Make make) {
+        if(first >= last) {
+            return;
+        }
+        unsigned k = my_parallel_threads(opt, total * sizeof(value_type));
+        if(k <= 1) {
+            size_type i = first;
+            try {
+                for(; i < last; ++i) {
+                    make(dst + i, i);
+                }
+            } catch(...) {
+                v.destroy_range(dst + first, dst + i);
+                throw;
+            }
+            return;
+        }
+        int nodes = my_numa_node_count();
+        bool pin = nodes > 1 && opt.policy != MyNumaPolicy::interleave;
+        MyVector<size_type> lo(k), done(k);
+        MyVector<std::exception_ptr> errors(k);
+        MyVector<std::thread> workers;
+        workers.reserve(k);
+        for(unsigned w = 0; w < k; ++w) {
+            lo[w] = std::max(first, total / k * w + std::min<size_type>(total % k, w));
+            done[w] = std::max(lo[w], std::min(last, total / k * (w + 1) + std::min<size_type>(total % k, w + 1)));
+        }
+        auto run = [&](unsigned w, bool own_thread) {
+            if(pin && own_thread) {
+                my_numa_run_on_node(opt.policy == MyNumaPolicy::bind ? opt.node : static_cast<int>(w * nodes / k));
+            }
+            size_type i = lo[w], hi = done[w];
+            try {
+                for(; i < hi; ++i) {
+                    make(dst + i, i);
+                }
+            } catch(...) {
+                errors[w] = std::current_exception();
+            }
+            done[w] = i;
+        };
+        try {
+            for(unsigned w = 0; w < k; ++w) {
+                workers.push_back(std::thread(run, w, true));
+            }
+        } catch(...) {
+            // 线程创建失败：已启动的线程照常完成，剩余分段在当前线程构造
+            for(unsigned w = static_cast<unsigned>(workers.size()); w < k; ++w) {
+                run(w, false);
+            }
+        }
+        for(std::thread& t : workers) {
+            t.join();
+        }
+        for(unsigned w = 0; w < k; ++w) {
+            if(errors[w]) {
+                for(unsigned u = 0; u < k; ++u) {
+                    v.destroy_range(dst + lo[u], dst + done[u]);
+                }
+                std::rethrow_exception(errors[w]);
+            }
+        }
+    }
+};
+
+// 并行构造 cnt 个 value
+template <typename T, typename Allocator = std::allocator<T>>
+MyVector<T, Allocator> my_parallel_vector(std::size_t cnt, const T& value, const MyParallelOptions& opt) {
+    MyVector<T, Allocator> vec;
+    MyVectorParallel<MyVector<T, Allocator>>::grow(vec, cnt, opt, value);
+    return vec;
+}
+
+// 并行 resize，新增元素值初始化或以 value 构造
+template <typename T, typename Allocator>
+void my_parallel_resize(MyVector<T, Allocator>& vec, std::size_t n, const MyParallelOptions& opt) {
+    MyVectorParallel<MyVector<T, Allocator>>::grow(vec, n, opt);
+}
+
+template <typename T, typename Allocator>
+void my_parallel_resize(MyVector<T, Allocator>& vec, std::size_t n, const T& value, const MyParallelOptions& opt) {
+    MyVectorParallel<MyVector<T, Allocator>>::grow(vec, n, opt, value);
+}
+
+// 缓冲区（含未使用的容量）在各节点上已驻留的页数，下标为节点编号
+template <typename T, typename Allocator>
+MyVector<std::size_t> my_vector_placement(const MyVector<T, Allocator>& vec) {
+    MyVector<std::size_t> pages(static_cast<std::size_t>(my_numa_node_count()));
+    if(vec.data()) {
+        my_numa_placement(vec.data(), vec.capacity() * sizeof(T), pages.data());
+    }
+    return pages;
+}
+
+// 对整个缓冲区（含未使用的容量）设置放置策略并迁移已驻留的页
+template <typename T, typename Allocator>
+bool my_vector_set_placement(MyVector<T, Allocator>& vec, MyNumaPolicy policy, int node = 0) {
+    return vec.data() && my_numa_set_placement(vec.data(), vec.capacity() * sizeof(T), policy, node);
+}
+
+#endif // MY_VECTOR_PARALLEL_H
@@ -1,7 +1,12 @@
 #include "my_vector.h"
+#include "my_vector_parallel.hpp"
 #include <iostream>
 #include <cassert>
 #include <vector> // 用于比较的 std::vector
+#include <string>
+#include <cstdint>
+#include <stdexcept>
+#include <atomic>
 
 // 辅助函数，用于输出 MyVector 的内容
 template <typename T>
@@ -34,6 +39,76 @@ void printStdVector(const std::vector<T>& vec, const std::string& message = "")
     std::cout << "]" << std::endl;
 }
 
+// 构造第 limit 个对象时抛出异常，用于检查并行构造的异常安全；计数由多个线程同时修改
+struct ThrowOnCopy {
+    static std::atomic<int> alive;
+    static std::atomic<int> limit;
+    int value;
+    ThrowOnCopy(int v = 0) : value(v) { ++alive; }
+    ThrowOnCopy(const ThrowOnCopy& o) : value(o.value) {
+        if (limit-- == 0) {
+            throw std::runtime_error("ThrowOnCopy");
+        }
+        ++alive;
+    }
+    ~ThrowOnCopy() { --alive; }
+};
+std::atomic<int> ThrowOnCopy::alive{0};
+std::atomic<int> ThrowOnCopy::limit{-1};
+
+// 第 limit 次移动构造时抛出异常，拷贝构造不会失败；扩容搬迁时应当改用拷贝
+struct ThrowOnMove {
+    static int limit;
+    int value;
+    ThrowOnMove(int v = 0) : value(v) {}
+    ThrowOnMove(const ThrowOnMove&) = default;
+    ThrowOnMove(ThrowOnMove&& o) : value(o.value) {
+        if (limit-- == 0) {
+            throw std::runtime_error("ThrowOnMove");
+        }
+        o.value = -1;
+    }
+    ThrowOnMove& operator=(const ThrowOnMove&) = default;
+    ThrowOnMove& operator=(ThrowOnMove&&) = default;
+};
+int ThrowOnMove::limit = -1;
+
+#if MY_VECTOR_HAS_CONSTEXPR
+// 编译期生成 CRC32 查找表
+constexpr MyVector<std::uint32_t> makeCrcTable() {
+    MyVector<std::uint32_t> table;
+    for (std::uint32_t n = 0; n < 256; ++n) {
+        std::uint32_t c = n;
+        for (int k = 0; k < 8; ++k) {
+            c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        }
+        table.push_back(c);
+    }
+    return table;
+}
+
+constexpr bool constexprVectorOps() {
+    MyVector<int> v = {1, 2, 3};
+    v.insert(v.begin() + 1, 2, 7);          // 1 7 7 2 3
+    v.erase(v.begin());                     // 7 7 2 3
+    v.resize(6, 9);                         // 7 7 2 3 9 9
+    v.emplace(v.end(), 4);                  // 7 7 2 3 9 9 4
+    int sum = 0;
+    for (int x : v) {
+        sum += x;
+    }
+    MyVector<int> w = v;
+    w.pop_back();
+    w.push_back(4);
+    return sum == 41 && w == v && v.size() == 7 && v.back() == 4;
+}
+
+constexpr auto crcTable = my_vector_freeze<makeCrcTable>();
+static_assert(constexprVectorOps());
+static_assert(crcTable.size() == 256);
+static_assert(crcTable[1] == 0x77073096u);
+static_assert(crcTable[255] == 0x2D02EF8Du);
+#endif
 
 int main() {
     // 默认构造函数测试
@@ -182,6 +257,31 @@ int main() {
     printMyVector(vec12, "Vector12 after insert iterator");
     std::cout << "insert iterator test passed." << std::endl;
 
+    // 扩容：一次插入超过两倍容量时直接扩到所需大小，多次扩容后旧缓冲区按分配时的大小释放
+    {
+        MyVector<int> vecGrow;
+        vecGrow.reserve(2);
+        vecGrow.push_back(1);
+        vecGrow.push_back(2);
+        vecGrow.insert(vecGrow.begin() + 1, 10, 7);
+        assert(vecGrow.size() == 12 && vecGrow.capacity() == 12);
+        assert(vecGrow[0] == 1 && vecGrow[1] == 7 && vecGrow[10] == 7 && vecGrow[11] == 2);
+        vecGrow.push_back(3);
+        assert(vecGrow.capacity() == 24 && vecGrow.back() == 3);
+        std::vector<int> blockGrow(40, 5);
+        vecGrow.insert(vecGrow.begin(), blockGrow.begin(), blockGrow.end());
+        assert(vecGrow.size() == 53 && vecGrow.capacity() == 53 && vecGrow[0] == 5 && vecGrow[40] == 1);
+        vecGrow.insert(vecGrow.end(), 2, 9);
+        assert(vecGrow.size() == 55 && vecGrow.capacity() == 106);
+        for (int i = 0; i < 200; ++i) {
+            vecGrow.push_back(i);
+        }
+        vecGrow.resize(600);
+        vecGrow.resize(1300, 4);
+        assert(vecGrow.size() == 1300 && vecGrow.capacity() == 1300 && vecGrow[599] == 0 && vecGrow[1299] == 4);
+    }
+    std::cout << "growth test passed." << std::endl;
+
 
     // emplace 测试
     vec12.emplace(vec12.begin() + 1, 55);
@@ -324,6 +424,173 @@ int main() {
     std::cout << "swap test passed." << std::endl;
 
 
+    // 非平凡类型的插入、删除与自引用插入
+    MyVector<std::string> vec25 = {"a", "b", "c"};
+    vec25.insert(vec25.begin() + 1, 3, std::string(40, 'x'));
+    vec25.erase(vec25.begin(), vec25.begin() + 2);
+    assert(vec25.size() == 4 && vec25[0] == std::string(40, 'x') && vec25[3] == "c");
+    vec25.shrink_to_fit();
+    vec25.push_back(vec25[0]);
+    vec25.insert(vec25.begin(), vec25.back());
+    assert(vec25.size() == 6 && vec25[0] == vec25[5]);
+    MyVector<std::string> vec26 = vec25;
+    vec26 = {"p", "q"};
+    assert(vec26.size() == 2 && vec26[1] == "q");
+    std::cout << "non-trivial element test passed." << std::endl;
+
+    // remove / remove_if / erase_if 测试
+    MyVector<int> vec27;
+    for (int k = 0; k < 100; ++k) {
+        vec27.push_back(k % 10);
+    }
+    assert(vec27.remove_if([](int x) { return x % 2 == 1; }) == 50);
+    assert(vec27.size() == 50 && vec27[0] == 0 && vec27[1] == 2 && vec27[49] == 8);
+    assert(vec27.remove(vec27[1]) == 10 && vec27.size() == 40);
+    assert(erase(vec27, 4) == 10 && erase_if(vec27, [](int x) { return x > 100; }) == 0);
+    assert(vec27.size() == 30 && vec27[0] == 0 && vec27[1] == 6 && vec27[2] == 8);
+    assert(erase_if(vec27, [](int) { return true; }) == 30 && vec27.empty());
+    MyVector<std::string> vec28 = {"keep", "drop", "keep", "drop", "drop", "tail"};
+    assert(vec28.remove("drop") == 3);
+    assert(vec28.size() == 3 && vec28[1] == "keep" && vec28[2] == "tail");
+    printMyVector(vec27, "vec27 after erase_if");
+    std::cout << "remove_if test passed." << std::endl;
+
+    // unordered_erase 测试
+    MyVector<std::string> vec29 = {"a", "b", "c", "d"};
+    auto it29 = vec29.unordered_erase(vec29.begin() + 1);
+    assert(*it29 == "d" && vec29.size() == 3 && vec29[2] == "c");
+    it29 = vec29.unordered_erase(vec29.end() - 1);
+    assert(it29 == vec29.end() && vec29.size() == 2);
+    bool thrown29 = false;
+    try {
+        vec29.unordered_erase(vec29.end());
+    } catch (const std::out_of_range&) {
+        thrown29 = true;
+    }
+    assert(thrown29);
+    std::cout << "unordered_erase test passed." << std::endl;
+
+    // 并行构造与 resize 测试
+    MyParallelOptions par;
+    par.threads = 4;
+    par.min_bytes_per_thread = 1;
+    MyVector<int> vec30 = my_parallel_vector(1001, 7, par);
+    assert(vec30.size() == 1001 && vec30.capacity() == 1001 && vec30[0] == 7 && vec30[1000] == 7);
+    my_parallel_resize(vec30, 5000, par);
+    assert(vec30.size() == 5000 && vec30[1000] == 7 && vec30[1001] == 0 && vec30[4999] == 0);
+    my_parallel_resize(vec30, 3, par);
+    my_parallel_resize(vec30, 4000, -1, par);
+    assert(vec30.size() == 4000 && vec30.capacity() == 5000 && vec30[2] == 7 && vec30[3] == -1);
+    par.policy = MyNumaPolicy::interleave;
+    MyVector<std::string> vec31 = my_parallel_vector(10, std::string(30, 's'), par);
+    my_parallel_resize(vec31, 37, vec31[0], par);
+    assert(vec31.size() == 37 && vec31[36] == std::string(30, 's'));
+    par.policy = MyNumaPolicy::bind;
+    my_parallel_resize(vec31, 100, par);
+    assert(vec31[9] == vec31[10 + 26] && vec31[99].empty());
+    MyVector<std::size_t> pages30 = my_vector_placement(vec30);
+    assert(pages30.size() == static_cast<std::size_t>(my_numa_node_count()));
+    my_vector_set_placement(vec30, MyNumaPolicy::interleave);
+    assert(vec30[3] == -1);
+    {
+        MyVector<ThrowOnCopy> vec32 = my_parallel_vector(20, ThrowOnCopy(1), par);
+        ThrowOnCopy::limit = 37;
+        bool thrown32 = false;
+        try {
+            my_parallel_resize(vec32, 200, ThrowOnCopy(2), par);
+        } catch (const std::runtime_error&) {
+            thrown32 = true;
+        }
+        ThrowOnCopy::limit = -1;
+        assert(thrown32 && vec32.size() == 20 && vec32[19].value == 1 && ThrowOnCopy::alive == 20);
+    }
+    assert(ThrowOnCopy::alive == 0);
+    std::cout << "parallel construction test passed." << std::endl;
+
+    // 扩容搬迁：移动构造可能抛出异常时改用拷贝，拷贝失败时原内容与容量不变
+    {
+        MyVector<ThrowOnMove> vec34;
+        vec34.reserve(4);
+        for (int i = 0; i < 4; ++i) {
+            vec34.push_back(ThrowOnMove(i));
+        }
+        ThrowOnMove::limit = 0;
+        vec34.insert(vec34.begin() + 1, 3, ThrowOnMove(9));
+        const ThrowOnMove five(5);
+        vec34.push_back(five);
+        vec34.push_back(five);
+        assert(vec34.size() == 9 && vec34.capacity() == 16);
+        int expect34[] = {0, 9, 9, 9, 1, 2, 3, 5, 5};
+        for (int i = 0; i < 9; ++i) {
+            assert(vec34[i].value == expect34[i]);
+        }
+        MyVector<ThrowOnMove> small34(2, ThrowOnMove(1));
+        small34.emplace(small34.begin() + 1, five);
+        assert(small34.size() == 3 && small34[1].value == 5 && small34[2].value == 1);
+        ThrowOnMove::limit = -1;
+
+        MyVector<ThrowOnCopy> vec35;
+        vec35.reserve(4);
+        for (int i = 0; i < 4; ++i) {
+            vec35.push_back(ThrowOnCopy(i));
+        }
+        // 第三次拷贝（搬迁第二个元素）失败
+        ThrowOnCopy::limit = 2;
+        bool thrown35 = false;
+        try {
+            vec35.insert(vec35.begin() + 2, 2, ThrowOnCopy(7));
+        } catch (const std::runtime_error&) {
+            thrown35 = true;
+        }
+        assert(thrown35 && vec35.size() == 4 && vec35.capacity() == 4 && ThrowOnCopy::alive == 4);
+        // 尾部追加：新元素已构造，搬迁第一个元素时失败
+        ThrowOnCopy::limit = 1;
+        thrown35 = false;
+        try {
+            vec35.push_back(ThrowOnCopy(8));
+        } catch (const std::runtime_error&) {
+            thrown35 = true;
+        }
+        ThrowOnCopy::limit = -1;
+        assert(thrown35 && vec35.size() == 4 && vec35.capacity() == 4 && ThrowOnCopy::alive == 4);
+        for (int i = 0; i < 4; ++i) {
+            assert(vec35[i].value == i);
+        }
+    }
+    assert(ThrowOnCopy::alive == 0);
+    std::cout << "throwing move test passed." << std::endl;
+
+    // 批量追加：平凡类型的指针区间整块复制
+    MyVector<std::uint64_t> vec33;
+    vec33.reserve(1000);
+    std::uint64_t block33[100];
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < 100; ++i) {
+            block33[i] = round * 100 + i;
+        }
+        const std::uint64_t* first33 = block33;
+        vec33.insert(vec33.end(), first33, first33 + 100);
+    }
+    assert(vec33.size() == 1000 && vec33.capacity() == 1000);
+    for (std::size_t i = 0; i < vec33.size(); ++i) {
+        assert(vec33[i] == i);
+    }
+    vec33.insert(vec33.begin() + 1, block33, block33 + 2);
+    assert(vec33.size() == 1002 && vec33[0] == 0 && vec33[1] == 900 && vec33[2] == 901 && vec33[3] == 1);
+    vec33.insert(vec33.end(), block33, block33);
+    assert(vec33.size() == 1002);
+    std::cout << "bulk insert test passed." << std::endl;
+
+#if MY_VECTOR_HAS_CONSTEXPR
+    // constexpr 测试
+    std::uint32_t crc = 0xFFFFFFFFu;
+    for (char ch : std::string("123456789")) {
+        crc = crcTable[(crc ^ static_cast<unsigned char>(ch)) & 0xFF] ^ (crc >> 8);
+    }
+    assert((crc ^ 0xFFFFFFFFu) == 0xCBF43926u);
+    std::cout << "constexpr test passed." << std::endl;
+#endif
+
     std::cout << "\nAll tests passed!" << std::endl;
 
     return 0;